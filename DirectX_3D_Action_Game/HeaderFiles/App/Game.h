@@ -9,6 +9,7 @@
 #include "Engine/Graphics.h"
 #include "Engine/Input.h"
 #include "Engine/Audio.h"
+#include "Engine/JobSystem.h"
 #include "Scene/SceneManager.h"
 #include "ECS/Components/PlayerComponent.h" // PlayerType̒`p
 
@@ -34,6 +35,7 @@ public:
     Input* GetInput() const { return pInput.get(); }
     Audio* GetAudio() const { return pAudio.get(); }
     SceneManager* GetSceneManager() const { return pSceneManager.get(); }
+    JobSystem* GetJobSystem() const { return pJobs.get(); }
     HWND GetWindowHandle() const { return m_hWnd; }
 
     // --- Q[isf[^Ǘ ---
@@ -78,6 +80,7 @@ private:
     std::unique_ptr<Input> pInput;
     std::unique_ptr<Audio> pAudio;
     std::unique_ptr<SceneManager> pSceneManager;
+    std::unique_ptr<JobSystem> pJobs;          // Ȃǂ̕񏈗p[J[
 
     // Q[f[^
     PlayerType m_selectedPlayerType = PlayerType::AssaultStriker;
@@ -12,6 +12,7 @@
 #include <Windows.h>
 #include <vector> // ǉ
 #include <string> // ǉ
+#include <cstdint>
 #include "Engine/Graphics.h"
 
 //萔E}N`
@@ -29,6 +30,15 @@ namespace Config {
 	constexpr const char* WINDOW_TITLE = "DirectX 3D Action Game (ECS)";
 	//FPSݒ
 	constexpr int TARGET_FPS = 60;
+	// ǉ: EQ[WbŇŒXebv (Hz)
+	// `FPSƂ͓ƗBd30ɂCPUׂ𔼕ɂł
+	constexpr int FIXED_TICK_RATE = 60;
+	// 1t[Œǂ̂߂ɉ񂷍őXebv (𒴂͎̂Ă)
+	constexpr int MAX_FIXED_STEPS = 5;
+	// ǉ: WuVXẽ[J[Xbh (0Ȃ _RA-1ACXbhɉ)
+	constexpr unsigned JOB_THREADS = 0;
+	// ǉ: ̃V[h (0ȂNƂɎv猈߂BOɏoV[hƓWJČł)
+	constexpr uint64_t RANDOM_SEED = 0;
 
 }
 
@@ -4,14 +4,37 @@
 =====================================================================*/
 #pragma once
 #include <DirectXMath.h>
+#include <cstdint>
+#include "Engine/GeometryGenerator.h" // ShapeType (ʕ̌`)
 
 enum class ColliderType {
     Type_None,
     Type_Box,       //  (AABB)
     Type_Capsule,   // JvZ
-    Type_Sphere     // 
+    Type_Sphere,    // 
+    Type_Hull       // ʕ (GeometryGenerator ̌`̒_Blʑ́E_C^Ȃ)
 };
 
+// Փ˃C[ (ő32)
+// ǂ̃C[m邩 PhysicsSystem ̏Փ˃}gNXŌ߂
+namespace CollisionLayer {
+    enum : uint8_t {
+        Static = 0,     // EǁEu (wȂ͂)
+        Kinematic,      //  (MovingSystemBÓIObhɂ͓Ȃ)
+        Player,
+        Enemy,
+        PlayerPart,
+        EnemyPart,
+        AttackBox,
+        AttackSphere,
+        RecoveryBox,
+        RecoverySphere,
+        PlayerBullet,
+        EnemyBullet,
+        Count
+    };
+}
+
 struct ColliderComponent {
     ColliderType type = ColliderType::Type_Box;
 
@@ -19,12 +42,18 @@ struct ColliderComponent {
     DirectX::XMFLOAT3 center = { 0.0f, 0.0f, 0.0f }; // ItZbg
 
     // Boxpf[^
-    DirectX::XMFLOAT3 size = { 1.0f, 1.0f, 1.0f };   // EEs
+    DirectX::XMFLOAT3 size = { 1.0f, 1.0f, 1.0f };   // EEs (Hullł͒_Ɋ|{)
+
+    // Hullpf[^ (bVƓ`𓖂蔻ɂ)
+    ShapeType hullShape = ShapeType::CUBE;
 
     // Capsule/Spherepf[^
     float radius = 0.5f;
     float height = 1.0f; // Capsulêݎgp
 
+    // Փ˃C[ (CollisionLayer)
+    uint8_t layer = CollisionLayer::Static;
+
     // pwp[֐͂ĂOKł
     void SetBox(float width, float h, float depth) {
         type = ColliderType::Type_Box;
@@ -41,4 +70,10 @@ struct ColliderComponent {
         type = ColliderType::Type_Sphere;
         radius = r;
     }
+
+    void SetHull(ShapeType shape, float sx = 1.0f, float sy = 1.0f, float sz = 1.0f) {
+        type = ColliderType::Type_Hull;
+        hullShape = shape;
+        size = { sx, sy, sz };
+    }
 };
@@ -3,6 +3,9 @@
 //Tv:G̃p[^ixG͈͂Ȃǁj
 =====================================================================*/
 #pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+#include "Engine/Random.h"
 // G̎
 enum class EnemyType {
     Normal,
@@ -24,6 +27,13 @@ enum class EnemyState {
     BossBitLaser,    // rbgĎˌ
     BossRapidFire    // ǉ: {X_
 };
+// ǉ: vl̍XVpx (AIScheduler ƉʓǂŌ߂)
+enum class AILod : uint8_t {
+    Near,   // Xebv
+    Mid,    // Xebv1
+    Far,    // ɂ܂΂
+    Count
+};
 struct EnemyComponent {
     EnemyType type = EnemyType::Normal;
     // {Xe[^X
@@ -44,6 +54,9 @@ struct EnemyComponent {
     float attackCooldownTimer = 0.0f;
     float attackInterval = 3.0f;
     float optimalRange = 15.0f;   // zIȌ틗ipj
+    // ǉ: e}bvőI񂾗ʒu (ށE荞݂ł֌)
+    DirectX::XMFLOAT3 tacticalGoal = { 0.0f, 0.0f, 0.0f };
+    bool hasTacticalGoal = false;
 
     // E
     float knockbackTimer = 0.0f;
@@ -55,4 +68,20 @@ struct EnemyComponent {
     float thinkInterval = 0.0f;   // Ɏvl܂ł̎
     // ǉ: {XptF[YǗ
     int bossPhase = 1;
+
+    // ǉ: vl̊Ԉ
+    // vlȂXebvAO񌈂߂Ƒňړ͑
+    AILod aiLod = AILod::Near;
+    float aiElapsed = 0.0f;                             // O̎vľoߎ
+    DirectX::XMFLOAT3 moveDir = { 0.0f, 0.0f, 0.0f };   // vlŌ߂ړ
+    float moveSpeedNow = 0.0f;                          // vlŌ߂ړx (0Ȃ~܂)
+
+    // ǉ: ށE荞݂ŎgĂoH (PathService ̃L[B0 ȂgĂȂ)
+    uint64_t pathKey = 0;
+    uint16_t pathWaypoint = 0;                          // ɌȂp̔ԍ
+    DirectX::XMFLOAT3 pathGoal = { 0.0f, 0.0f, 0.0f };  // oH̖ڕW_ (pathKey  0 łȂL)
+
+    // ǉ: vlp̗ (GƂ̗BEnemySystem ŏɌɍ)
+    // GƂɎ̂ŁAǂ̃XbhŎvlĂV[hȂ瓯ʂɂȂ
+    Random rng;
 };
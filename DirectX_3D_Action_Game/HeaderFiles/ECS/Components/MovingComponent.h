@@ -6,4 +6,7 @@ struct MovingComponent {
     DirectX::XMFLOAT3 moveVec; // ړ (U)
     float speed = 1.0f;
     float time = 0.0f;
+
+    // ǉ: ÕXebv̑x (MovingSystemvZBɏ̂^Ԃ̂Ɏg)
+    DirectX::XMFLOAT3 velocity = { 0.0f, 0.0f, 0.0f };
 };
@@ -0,0 +1,33 @@
+/*===================================================================
+//ファイル:PatternEmitterComponent.h
+//概要:弾幕パターンを撃つ発射装置（ボスが持つ）
+//      EnemySystem が Start で撃ち始め、標的を毎ステップ書き込む。
+//      撃つのは ProjectileSystem (終わったら active が false になる)
+=====================================================================*/
+#pragma once
+#include "Game/BulletPattern.h"
+#include <DirectXMath.h>
+
+struct PatternEmitterComponent {
+    BulletPatternID pattern = BulletPatternID::RingBarrage;
+    bool active = false;
+    float remaining = 0.0f;         // パターンの残り時間
+    float cadenceTimer = 0.0f;      // 前の斉射からの時間
+    float angle = 0.0f;             // 基準の角度 (Y軸回り)
+    float spinAngle = 0.0f;         // 発射口の並びの角度
+
+    // 狙う標的 (EnemySystem が毎ステップ書く)
+    bool hasTarget = false;
+    DirectX::XMFLOAT3 target = { 0.0f, 0.0f, 0.0f };
+
+    // パターンを最初から撃ち始める
+    // baseAngle: 基準の角度の初期値 / spin: 発射口の並びの初期値
+    void Start(BulletPatternID id, float baseAngle, float spin) {
+        pattern = id;
+        active = true;
+        remaining = GetBulletPattern(id).duration;
+        cadenceTimer = 0.0f;
+        angle = baseAngle;
+        spinAngle = spin;
+    }
+};
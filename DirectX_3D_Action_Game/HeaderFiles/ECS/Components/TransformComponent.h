@@ -14,4 +14,35 @@ struct TransformComponent {
 	DirectX::XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
 	DirectX::XMFLOAT3 rotation = { 0.0f, 0.0f, 0.0f };
 	DirectX::XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+
+	// ǉ: ŒXebvԗp
+	// ŒXebṽVXeœ(vC[EGEe) interpolate=true ɂĂƁA
+	// World eXebvO̒l prev ɕۑA`摤 prev ԂĎg
+	DirectX::XMFLOAT3 prevPosition = { 0.0f, 0.0f, 0.0f };
+	DirectX::XMFLOAT3 prevRotation = { 0.0f, 0.0f, 0.0f };
+	bool interpolate = false;
+	bool hasPrev = false; //  prev ̂ŕԂȂ
+
+	// Ԃʒu (alpha=0őOXebv, 1Ō)
+	DirectX::XMFLOAT3 InterpolatedPosition(float alpha) const {
+		if (!interpolate || !hasPrev) return position;
+		return {
+			prevPosition.x + (position.x - prevPosition.x) * alpha,
+			prevPosition.y + (position.y - prevPosition.y) * alpha,
+			prevPosition.z + (position.z - prevPosition.z) * alpha
+		};
+	}
+	// Ԃ] (px̍ -΁` Ɋۂ߂ċ߂)
+	DirectX::XMFLOAT3 InterpolatedRotation(float alpha) const {
+		if (!interpolate || !hasPrev) return rotation;
+		auto lerpAngle = [alpha](float a, float b) {
+			float d = DirectX::XMScalarModAngle(b - a);
+			return a + d * alpha;
+		};
+		return {
+			lerpAngle(prevRotation.x, rotation.x),
+			lerpAngle(prevRotation.y, rotation.y),
+			lerpAngle(prevRotation.z, rotation.z)
+		};
+	}
 };
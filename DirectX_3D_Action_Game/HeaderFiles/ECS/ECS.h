@@ -15,6 +15,7 @@
 #include <deque>
 #include <typeindex>
 #include <utility>
+#include <functional>
 
 /*----------------------------------------------
 //ComponentPool<T>:f[^z
@@ -75,6 +76,7 @@ public:
 		for (auto& pair : componentPools) {
 			pair.second->OnEntityDestroyed(entity);
 		}
+		for (auto& callback : destroyedCallbacks) callback(entity);
 	}
 
 	// -----------------------------------------------------------------
@@ -94,6 +96,22 @@ public:
 
 		//}XNI
 		entityComponentMasks[entity].set(componentID);
+
+		for (auto& listener : addedCallbacks) {
+			if (listener.first == componentID) listener.second(entity);
+		}
+	}
+
+	//ǉ: R|[lg̒ǉEEntity폜̒ʒm
+	//ĂEntity񂵂System (̃RC_[ꗗȂ) o^
+	//ʒm͒ǉE폜̒ɌĂ΂̂ŁA󂯎鑤 IDςނɂĂ
+	using EntityCallback = std::function<void(EntityID)>;
+	template <typename T>
+	void OnComponentAdded(EntityCallback callback) {
+		addedCallbacks.emplace_back(ComponentType<T>::GetID(), std::move(callback));
+	}
+	void OnEntityDestroyed(EntityCallback callback) {
+		destroyedCallbacks.push_back(std::move(callback));
 	}
 
 	//R|[lg擾
@@ -125,4 +143,6 @@ private:
 	std::deque<EntityID> freeEntities;
 	std::vector<ComponentMask> entityComponentMasks;//NĂ邩
 	std::unordered_map<const char*, std::shared_ptr<IComponentPool>> componentPools;
+	std::vector<std::pair<std::uint32_t, EntityCallback>> addedCallbacks;
+	std::vector<EntityCallback> destroyedCallbacks;
 };
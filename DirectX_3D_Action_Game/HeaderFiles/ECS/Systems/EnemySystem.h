@@ -1,9 +1,167 @@
 #pragma once
 #include "ECS/System.h"
+#include "Engine/SpatialHash.h"
+#include "Game/AIPerception.h"
+#include "Game/AIScheduler.h"
+#include "Game/NavGrid.h"
+#include "Game/FlowField.h"
+#include "Game/PathService.h"
+#include "Game/SightService.h"
+#include "Game/InfluenceMap.h"
+#include "Game/EnemyStateBuckets.h"
+#include <DirectXMath.h>
+#include <vector>
+
+class JobSystem;
+struct EnemyComponent;
+struct TransformComponent;
+struct PatternEmitterComponent;
 
 class EnemySystem : public System {
 public:
+    void Init(World* world) override;
     void Update(float dt) override;
     // ǉ: oߎԂvϐ
     float timeAccumulator = 0.0f;
-};
\ No newline at end of file
+
+    // ĂG̈ʒu (t[̍ŏɍ蒼B߂̓GT̂Ɏg)
+    const SpatialHash& GetEnemyHash() const { return enemyHash; }
+    // _vC[̈ꗗ (t[̍ŏɍ蒼)
+    const AIPerception& GetPerception() const { return perception; }
+    // vl̊Ԉ (\Z⋗̐ݒς)
+    AIScheduler& GetScheduler() { return scheduler; }
+    // ǂĂ񂾒ʍsObhƁAWI֌
+    const NavGrid& GetNavGrid() const { return navGrid; }
+    const FlowField& GetFlowField() const { return flowField; }
+    // ށE荞ݗp̌oHT (\Zς)
+    PathService& GetPathService() { return pathService; }
+    // ̓GWIւ̌ʂ (TTL Ȃǂ̐ݒς)
+    SightService& GetSightService() { return sightService; }
+    // ̓G̗ʒuIїp̉e}bv (d݂1Xebv̎Ԃς)
+    InfluenceMap& GetInfluenceMap() { return influenceMap; }
+    // ԂƂ̓G̗ (Ԃςڂ)
+    const EnemyStateBuckets& GetStateBuckets() const { return stateBuckets; }
+
+private:
+    // GmŔ
+    static constexpr float SEPARATION_RADIUS = 2.0f;
+    // ށE荞݂Ŗڎw_܂ł̋
+    static constexpr float RETREAT_LOOKAHEAD = 6.0f;
+    static constexpr float STRAFE_LOOKAHEAD = 4.0f;
+    // oHŉ荞łԂ́AOɌ߂ڕW_g
+    // (ڕW_ɒAڎw傫ꂽ猈ߒ)
+    static constexpr float PATH_GOAL_ARRIVE_DIST = 1.5f;
+    static constexpr float PATH_GOAL_KEEP_COS = 0.7f;   // 45x
+    // ̓GƁAeoE_ (ʂ̐Œׂ)
+    static constexpr float RANGED_FIRE_RANGE = 30.0f;
+    static constexpr float MUZZLE_HEIGHT = 1.0f;
+    static constexpr float TARGET_CORE_HEIGHT = 0.5f;
+    // e}bvőI񂾗ʒuɒƌȂ
+    static constexpr float TACTICAL_ARRIVE_DIST = 1.0f;
+
+    // GG܂Ƃ߂ĎvlEړ鎞̂܂̑傫
+    static constexpr size_t THINK_GRAIN = 8;
+    static constexpr size_t MOVE_GRAIN = 64;
+    static constexpr size_t STATE_GRAIN = 32;
+    // slotOf  minionsEbosses ɂȂG
+    static constexpr uint32_t NO_SLOT = 0xFFFFFFFF;
+
+    // ̃XebvœGG1̕
+    // R|[lg͏W߂鎞ɈĂ (̎vl Registry Ȃ)
+    struct MinionSlot {
+        EntityID id;
+        EnemyComponent* enemy;
+        TransformComponent* trans;
+        int attackPower;
+        int targetIndex;        // perception ̕WIԍ
+        float distToTarget;
+        float thinkDt = 0.0f;   // OvlĂ̎ (ԈĂΐXebv)
+        bool thinking = false;  // ̃XebvŔԂ
+    };
+    struct BossSlot {
+        EntityID id;
+        int targetIndex;
+        // 牺 PrepareBoss Ŗ߂
+        EnemyComponent* enemy = nullptr;
+        TransformComponent* trans = nullptr;
+        PatternEmitterComponent* emitter = nullptr;
+        EntityID targetID = ECSConfig::INVALID_ID;
+        DirectX::XMFLOAT3 targetPos = {};
+    };
+    // ԂƂ̎vl̍Ɨp (Xbh)
+    struct ThinkScratch {
+        std::vector<uint32_t> slots;            // ܂̒̔Ԃ̗G
+        std::vector<float> dirX, dirY, dirZ;    // ǐՂ̌
+    };
+
+    // vlɌ߂AWorld ⋤L̂̂鏈
+    // vl̓XbhƂ̗ɐςނɂāAS̎vlIĂ珇ɍs
+    struct EnemyCommand {
+        enum class Type : uint8_t {
+            FireBullet,     // e (position  direction )
+            MeleeAttack,    // ߐڍU̓蔻o (position )
+            RequestPath,    // oH𗊂 (pathKey)
+            TouchPath,      // oH܂gĂ (pathKey)
+        };
+        Type type;
+        EntityID id;
+        DirectX::XMFLOAT3 position;
+        DirectX::XMFLOAT3 direction;
+        int damage;
+        uint64_t pathKey;
+    };
+
+    // ʍsObh (ǂς) Ɨ (WIZڂ) 蒼
+    void UpdateNavigation();
+    // Ԃ̗GG[J[ŕɎvl (scheduler Ă΂)
+    void ThinkBatch(const uint32_t* slots, size_t count);
+    // Ԃ̗񂲂ƂɁAԂ̗GG̈ړ߂ (Ŝ܂Ƃ܂̌1)
+    void ThinkStates();
+    void UpdateBosses(float dt);
+    void PrepareBoss(BossSlot& b, float dt);
+    void ThinkBossIdle(BossSlot& b);
+    void ThinkBossRingBarrage(BossSlot& b, float dt);
+    void ThinkBossRapidFire(BossSlot& b, float dt);
+    void ThinkBossBitLaser(BossSlot& b);
+    // vl͎̃R|[lgAȊO out ɐς
+    void DecideMinion(const MinionSlot& m, std::vector<EnemyCommand>& out);
+    // ԂƂ̐p[v (slots ͓Ԃ̗̓G)
+    void ThinkChase(const uint32_t* slots, size_t count, ThinkScratch& s, std::vector<EnemyCommand>& out);
+    void ThinkStrafing(const uint32_t* slots, size_t count, std::vector<EnemyCommand>& out);
+    void ThinkRetreat(const uint32_t* slots, size_t count, std::vector<EnemyCommand>& out);
+    void ThinkAttack(const uint32_t* slots, size_t count);
+    void ThinkCooldown(const uint32_t* slots, size_t count);
+    bool TowardTacticalGoal(EnemyComponent& enemy, const DirectX::XMFLOAT3& position, DirectX::XMVECTOR& outDir);
+    void FinishThink(const MinionSlot& m, DirectX::XMVECTOR moveDir, float currentMoveSpeed);
+    // XbhƂ̗܂ɕגĎs
+    void ApplyCommands();
+    void MoveMinions(float dt);
+    // position  goal ւ܂sȂ΁AoHɉ outDir ɏ true
+    bool SteerAround(EntityID id, EnemyComponent& enemy, const DirectX::XMFLOAT3& position,
+                     const DirectX::XMFLOAT3& goal, DirectX::XMVECTOR& outDir, std::vector<EnemyCommand>& out);
+
+    template<class Func>
+    void RunParallel(size_t count, size_t grain, Func&& func);
+
+    SpatialHash enemyHash;
+    AIPerception perception;
+    AIScheduler scheduler;
+    std::vector<MinionSlot> minions;
+    std::vector<BossSlot> bosses;
+    std::vector<uint32_t> slotOf;               // EntityID  minionsEbosses ̔ԍ
+    EnemyStateBuckets stateBuckets;
+
+    JobSystem* pJobs = nullptr;
+    std::vector<std::vector<EnemyCommand>> commands;   // XbhƂ̗
+    std::vector<EnemyCommand> applyList;               // גp
+    std::vector<ThinkScratch> thinkScratch;            // XbhƂ̍Ɨp
+
+    NavGrid navGrid;
+    uint32_t navStaticVersion = 0;  // navGrid  PhysicsSystem::GetStaticVersion
+    FlowField flowField;
+    int flowTargetIndex = -1;       // ꂪĂWI (perception ̔ԍ)
+    PathService pathService;
+    SightService sightService;
+    InfluenceMap influenceMap;
+    uint32_t rngSerial = 0;         // GƂ̗ɐUʂԍ
+};
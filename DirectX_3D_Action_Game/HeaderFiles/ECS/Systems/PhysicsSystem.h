@@ -1,7 +1,15 @@
 #pragma once
 #include "ECS/System.h"
 #include "ECS/ECS.h"
+#include "ECS/Components/ColliderComponent.h"
+#include "Engine/Collision.h"
+#include "Engine/ConvexCollision.h"
 #include <DirectXMath.h>
+#include <vector>
+#include <cfloat>
+#include <unordered_map>
+
+class JobSystem;
 
 struct OBB {
 	DirectX::XMFLOAT3 center;//SW
@@ -9,18 +17,413 @@ struct OBB {
 	DirectX::XMFLOAT4X4 orientation;//]iEEs̔j
     DirectX::XMFLOAT4X4 worldMatrix;
 };
+// -----------------------------------------------------------------
+// RC_[LbV (EntityIDňSoAz)
+// [hOBBEtsEAABBEOڋt[1񂾂vZĂA
+// e͂ǂށB(Transform/Collider)ςČvZ
+// -----------------------------------------------------------------
+struct ColliderCache {
+    // vZ
+    std::vector<DirectX::XMFLOAT4X4> world;       // ] * sړ
+    std::vector<DirectX::XMFLOAT4X4> invWorld;    // world̋ts
+    std::vector<DirectX::XMFLOAT3> extents;       // OBB̔TCY
+    std::vector<DirectX::XMFLOAT3> aabbMin;       // [hAABB
+    std::vector<DirectX::XMFLOAT3> aabbMax;
+    std::vector<float> sphereRadius;              // OBB̊Oڋa
+    std::vector<float> capRadius;                 // JvZƂČ̔a
+    std::vector<float> capHalfLen;                // JvZc̔̒
+    std::vector<uint8_t> valid;                   // Collider+TransformAType_NonełȂ
+
+    // ύXop (OvZ̓)
+    std::vector<DirectX::XMFLOAT3> position;      // = OBB̒S
+    std::vector<DirectX::XMFLOAT3> rotation;
+    std::vector<DirectX::XMFLOAT3> scale;
+    std::vector<ColliderType> type;
+    std::vector<DirectX::XMFLOAT3> size;
+    std::vector<float> radius;
+    std::vector<float> height;
+    std::vector<ShapeType> hullShape;
+    std::vector<uint8_t> layer;                   // Փ˃C[ (t[ǂݒ)
+    std::vector<uint32_t> frame;                  // ŌɊmFt[ԍ
+    std::vector<uint8_t> isStatic;                // ÓIȎՕƂ staticBoxes ɓo^ς
+
+    void Resize(size_t n);
+};
+
+// -----------------------------------------------------------------
+// X[v (EntityIDň)
+// Î~̂͐ϕEڒnCEo~߁A
+// xt/̃VXeɓ/GƋN
+// -----------------------------------------------------------------
+struct SleepState {
+    std::vector<uint8_t> sleeping;
+    std::vector<float> restTime;                  // Î~Ă鎞
+    std::vector<DirectX::XMFLOAT3> restPosition;  // Î~̊ʒu (炸ꂽN)
+
+    void Resize(size_t n);
+};
+
+// ڐGLbV1 (o,  ̃yA)
+// ҂قƂǓĂȂ΁AO̔茋ʂ̂܂܎g
+struct ContactEntry {
+    DirectX::XMFLOAT3 posA;     // 肵̈ʒu
+    DirectX::XMFLOAT3 posB;
+    DirectX::XMFLOAT3 rotB;     // ̉] (gȂ)
+    DirectX::XMFLOAT3 push;     // o (hit)
+    float gap = 0.0f;           // Ă (miss)
+    uint32_t frame = 0;
+    bool hit = false;
+};
+
+// ̏ (ԂƂɎԂv)
+enum class PhysicsPhase : uint8_t {
+    Integrate,      // ̉^EϕERC_[LbV/Obh̍XVEn
+    Walls,          // LN^[Rg[[ (ǂɉĊ点B Gl~[ƕ)
+    Ground,         // ڒnCƃGl~[̐ڒn
+    EnemyContacts,  // Gl~[ƃLN^[Ep[c̉
+    Player,         // vC[̐ڒnE
+    Triggers,       // gK[̏dȂ蔻 (Enter/Stay/Exit)
+    Attack,         // Ũqbg
+    Recovery,       // 񕜔̃qbg
+    Sphere,         // Ũqbg
+    Bullet,         // ȇ|ƃqbg
+    Count
+};
+inline constexpr const char* PHYSICS_PHASE_NAMES[] = {
+    "Integrate", "Walls", "Ground", "EnemyContacts", "Player",
+    "Triggers", "Attack", "Recovery", "Sphere", "Bullet",
+};
+static_assert(sizeof(PHYSICS_PHASE_NAMES) / sizeof(PHYSICS_PHASE_NAMES[0]) == (size_t)PhysicsPhase::Count);
+
+// ̓v (fobO\pAXebv)
+struct PhysicsCounters {
+    uint32_t sleepingBodies = 0;
+    uint32_t awakeBodies = 0;
+    uint32_t contactCacheHits = 0;
+    uint32_t contactCacheMisses = 0;
+
+    uint32_t integratedBodies = 0;      // xϕ
+    uint32_t groundRays = 0;            // ڒnC̖{
+    uint32_t characterSweeps = 0;       // Rg[[̑|
+    uint32_t broadphaseCandidates = 0;  // ObhŌ (|EoE)
+    uint32_t narrowphaseTests = 0;      // `󓯎m̔ (ꊇ͑Ώۂ̐)
+    uint32_t hits = 0;                  //  (Eǂւ̑|EgK[̏dȂEe̐ڐG)
+    uint32_t pushes = 0;                // o (ERg[[̕ǂ̉o)
+
+    float phaseMs[(size_t)PhysicsPhase::Count] = {};
+    float totalMs = 0.0f;
+};
+
+// ߂̃Xebv̓v (Oobt@BfobO\̃Otp)
+struct PhysicsStatsHistory {
+    static constexpr int SIZE = 120;
+    float totalMs[SIZE] = {};
+    float phaseMs[(size_t)PhysicsPhase::Count][SIZE] = {};
+    int head = 0;       // ɏʒu (= ԌÂl̈ʒu)
+    int count = 0;      //  (ő SIZE)
+
+    void Push(const PhysicsCounters& counters);
+    float AverageTotal() const;
+    float PeakTotal() const;
+    float AveragePhase(PhysicsPhase phase) const;
+};
+
+// gK[̏dȂCxg (ÕXebvƂ̍)
+enum class TriggerPhase : uint8_t {
+    Enter,      // dȂn߂
+    Stay,       // dȂ葱Ă
+    Exit,       // ꂽ (ǂ炩ꍇ܂ށB݂͎̑󂯎鑤ŊmF)
+};
+struct TriggerEvent {
+    EntityID triggerID;         // U/񕜔AUA񕜃X|bg
+    EntityID otherID;           // Ώ (Collider + Status )
+    TriggerPhase phase;
+};
+
 class PhysicsSystem : public System {
 public:
+    //  (Փ˃}gNX̐ݒ)
+    void Init(World* world) override;
+    // 񏈗Ɏg[J[ւ (Init  Game ̂̂gBnullptr ȂSCXbh)
+    // Game ȂŕeXgg
+    void SetJobSystem(JobSystem* jobs) { pJobs = jobs; }
     // XV
     void Update(float dt) override;
     OBB GetOBB(EntityID id);
+    // ߂̃Xebv̓v
+    const PhysicsCounters& GetCounters() const { return counters; }
+    //  PhysicsStatsHistory::SIZE Xebv̏
+    const PhysicsStatsHistory& GetStatsHistory() const { return statsHistory; }
+    // ߂̃XebṽgK[Cxg (gK[IDID ̏B̃Xebv܂ŗL)
+    const std::vector<TriggerEvent>& GetTriggerEvents() const { return triggerEvents; }
+    // ÓIRC_[ (E) OBBBGetStaticVersion ςgς
+    // (G̒ʍsObhȂǁAǂ̔zû͂č蒼)
+    const Collision::OBBSoA& GetStaticBoxes() const { return staticBoxes; }
+    uint32_t GetStaticVersion() const { return staticVersion; }
+    //  fromto ɑ|AŏɓÓIRC_[ (܂) ܂ł̋Ԃ
+    // (̊OœeȂǂɎgBcandidates ̓XbhƂɕʂ̂̂n)
+    bool SweepSphereStatic(const DirectX::XMFLOAT3& from, const DirectX::XMFLOAT3& to, float radius,
+        float& outDist, std::vector<uint32_t>& candidates) const {
+        return SweepStatic(from, to, radius, -FLT_MAX, outDist, candidates);
+    }
 private:
+    // o1̌ (ɋ߂ĂAIDɓKp)
+    struct ContactRecord {
+        EntityID entityID;
+        EntityID otherID;
+        uint64_t key;               // ڐGLbṼL[
+        ContactEntry entry;         // LbVɏe (g񂵂ꍇ͑O̓e)
+        bool reused;                // ڐGLbVg񂵂
+    };
+
     // Փ˔Ɖ̊֐
     void CheckAndResolve(EntityID playerID, EntityID otherID);
+    // ov邩𒲂ׂ (ǂݎ̂݁BXbhĂł悢)
+    // posA ͉ǒ݈ʒu (LbVɓĂꍇ̂ňœn)
+    // ߂l: s (pȂ)Bo out.entry.hit
+    bool FindContact(EntityID entityID, EntityID otherID, const DirectX::XMFLOAT3& posA, ContactRecord& out) const;
+    // FindContact ̌ʂڐGLbVƓvɏAĂΉo
+    void CommitContact(const ContactRecord& record);
+    // JvZ vs ̔̂ (oʂƁAĂꍇ͂̋Ԃ)
+    // 肪ȂOBBƂ̌AEJvZEʕȂ GJK/EPA
+    bool ContactNarrowPhase(EntityID entityID, EntityID otherID, const DirectX::XMFLOAT3& posA,
+        DirectX::XMFLOAT3& outPush, float& outGap) const;
+    // LbVʌ` (ȊȎ GJK Ŕ肷鎞Ɏg)
+    Collision::ConvexShape ConvexShapeOf(EntityID id) const;
+    // ȊǑ`́AL攻 OBB 菬̂ GJK œm߂
+    bool NeedsConvexCheck(EntityID id) const {
+        return colliderCache.type[id] != ColliderType::Type_Box;
+    }
+    // ڐG̏ (_[WEoEx̕␳)
+    void ResolveContact(EntityID entityID, EntityID otherID, const DirectX::XMFLOAT3& push);
+
+    // ڐGLbV (L[: oID << 32 | ID)
+    std::unordered_map<uint64_t, ContactEntry> contactCache;
 
-    void CheckAttackHit(EntityID attackID, EntityID targetID);
-    void CheckRecoveryHit(EntityID, EntityID);
-    void CheckAttackSphereHit(EntityID attackID, EntityID targetID);
+    // X[v
+    SleepState sleep;
+    // Î~ĂΎԂi߂Ė点AĂΊʒu蒼
+    void UpdateSleep(EntityID id, bool resting, const DirectX::XMFLOAT3& position, float dt);
+    void WakeBody(EntityID id);
+    void WakeAll();
+
+    PhysicsCounters counters;
+    PhysicsStatsHistory statsHistory;
+
+    // Փ˃}gNX (ǂ̃C[m邩BInit1񂾂ݒ肷)
+    void ConfigureLayers();
+    Collision::LayerMatrix layerMatrix;
+    uint32_t triggerLayers = 0;     // dȂo邾ŉoȂC[
+
+    // ȏΏۂ (R|[lgɃLbṼC[Ŕ)
+    bool ShouldResolve(EntityID id, EntityID otherID) const {
+        const ColliderCache& c = colliderCache;
+        if (!c.valid[otherID]) return false;
+        if (triggerLayers & (1u << c.layer[otherID])) return false;
+        return layerMatrix.Collides(c.layer[id], c.layer[otherID]);
+    }
+
+    // qbg̏ (dȂ蔻 SphereOverlapBatch ōς܂ĂĂ)
+    void ApplyAttackHit(EntityID attackID, EntityID targetID);
+    void ApplyRecoveryHit(EntityID, EntityID);
+    void ApplyAttackSphereHit(EntityID attackID, EntityID targetID);
     /*void CheckRecoverySphereHit(EntityID recoveryID, EntityID targetID);*/
-    void CheckBulletHit(EntityID bulletID, EntityID targetID);
+    void ApplyBulletHit(EntityID bulletID, EntityID targetID);
+
+    // ---------------------------------------------------------
+    // RC_[ꗗ
+    // Collider + Transform EntityID () ĂAe
+    // MAX_ENTITIES ł͂Ȃ̈ꗗ񂷁BRegistry ̒ǉE폜̒ʒm
+    // dirtyColliders ɐς݁AXebv̓ł܂Ƃ߂Ĕf
+    // ---------------------------------------------------------
+    static constexpr uint8_t COLLIDER_DIRTY = 1;    // Collider / Transform t (ꗗɓ邩mߒ)
+    static constexpr uint8_t COLLIDER_REMOVED = 2;  // Entity (IDō蒼ĂĂLbV̂Ă)
+    void MarkColliderDirty(EntityID id, uint8_t flags);
+    // ς񂾒ǉE폜ꗗɔf
+    void SyncColliders();
+    // ꗗ̃RC_[mFÂČvZ (ϕ̌1)
+    void RefreshColliders();
+
+    std::vector<EntityID> colliderIDs;          //  (IDɏ鏊̏ԂςȂ)
+    std::vector<uint8_t> colliderListed;        // EntityIDň (colliderIDs ɓĂ邩)
+    std::vector<EntityID> dirtyColliders;
+    std::vector<uint8_t> colliderDirty;         // EntityIDň (dirtyColliders ɐς񂾗R)
+    std::vector<EntityID> addedColliders;       // SyncColliders ̍Ɨp
+
+    // 1̊̕mFƍČvZ (oœɂĂ)
+    void RefreshCollider(EntityID id);
+    // t[mFȂ炻̏ŊmF (t[rŐꂽ̗p)
+    void EnsureCollider(EntityID id) {
+        if (colliderCache.frame[id] != cacheFrame) RefreshCollider(id);
+    }
+
+    ColliderCache colliderCache;
+    uint32_t cacheFrame = 0;
+
+    // nʌOBBSoAɋlߒ (t[1)
+    // ÓIȏ BuildStaticGrid ŋl߂̂܂܎gA̓ւ
+    void BuildGroundBoxes();
+
+    // ڒnC̈ꊇpobt@ (t[g)
+    // [0, staticGroundCount) ÓIȏAȍ~
+    Collision::OBBSoA groundBoxes;
+    size_t staticGroundCount = 0;
+    std::vector<Collision::RayQuery> groundRays;
+    std::vector<Collision::RayHit> groundHits;
+    std::vector<EntityID> groundRayOwners;
+
+    // U//e̓Ώ (Collider + Status ) OBBSoAɋl߂
+    void BuildTargetBoxes();
+
+    Collision::OBBSoA targetBoxes;
+
+    // ---------------------------------------------------------
+    // i[tF[Y
+    //  (ǂݎ̂) [J[ŕSăXbhʃobt@ɏA
+    // ܂ɕגĂ烁CXbhœKpB
+    // _[WEmbNobNEł̏Ԃ̓VOXbh̎ƓɂȂ
+    // ---------------------------------------------------------
+    // U//U̔1 (XebvŏW߂Ăꊇ肷)
+    struct OverlapQuery {
+        EntityID id;
+        EntityID ownerID;           // ɂ͓ĂȂ (Ȃ ECSConfig::INVALID_ID)
+        DirectX::XMFLOAT3 center;
+        float radius;
+        uint8_t layer;
+        bool flat = false;          // true ȂXZʂ̉~ (Ώۂ̒SƂ̐Ŕ)
+    };
+    // dȂg (query: OverlapQuery ̔ԍ, target: targetBoxes ̔ԍ)
+    struct OverlapHit {
+        uint32_t query;
+        uint32_t target;
+    };
+    // ȇ|1
+    struct BulletSweep {
+        EntityID bulletID;
+        DirectX::XMFLOAT3 from;
+        DirectX::XMFLOAT3 to;
+        uint8_t layer;
+    };
+    // e̐ڐGCxg (Xebv̎ɏ)
+    struct BulletContact {
+        float toi;                  // Xebv̓B (0`1)
+        EntityID bulletID;
+        EntityID targetID;          // ǂȂ ECSConfig::INVALID_ID
+        DirectX::XMFLOAT3 point;    // ڐG̒e̒S
+    };
+    // XbhƂ̍Ɨpobt@ƌ
+    struct WorkerScratch {
+        std::vector<uint8_t> hitMask;
+        std::vector<float> penetration;     // SphereOverlapBatch / SweepSphereBatch ̏o
+        std::vector<uint32_t> candidates;   // ÓIObȟ
+        std::vector<ContactRecord> contacts;
+        std::vector<OverlapHit> overlaps;
+        std::vector<BulletContact> bulletContacts;
+        // v (Xebv̍Ō counters ֑)
+        uint32_t sweepCount = 0;
+        uint32_t candidateCount = 0;
+        uint32_t testCount = 0;
+        uint32_t hitCount = 0;
+        uint32_t pushCount = 0;
+    };
+
+    // XbhԂ̍Ɨpobt@pӂAʂɂ
+    void PrepareScratch(size_t targetCount);
+    // [0, count) [J[ŕS (WuVXeȂ΂̏ŏ)
+    template <class Func>
+    void RunParallel(size_t count, size_t grain, Func&& func);
+    // 1̉̕oÄʒui߂Ȃ珇ɍs (ǂݎ̂)
+    // ͓IObhŋ߂ɂ̂
+    void CollectContacts(EntityID id, WorkerScratch& scratch) const;
+    // U//ȔdȂɒׁA(query, target) ɕׂĕԂ
+    const std::vector<OverlapHit>& FindOverlaps(const std::vector<OverlapQuery>& queries);
+
+    JobSystem* pJobs = nullptr;
+    std::vector<WorkerScratch> scratch;
+    std::vector<EntityID> resolveIDs;           // o肷Gl~[
+    std::vector<ContactRecord> mergedContacts;
+    std::vector<OverlapQuery> overlapQueries;
+    std::vector<OverlapHit> mergedOverlaps;
+
+    // gK[̏dȂ𒲂ׁAOƂ̍Cxg
+    void UpdateTriggers();
+    std::vector<uint64_t> triggerPairs;         // ȌdȂ (gK[ID << 32 | ID, )
+    std::vector<uint64_t> currentTriggerPairs;
+    std::vector<TriggerEvent> triggerEvents;
+    std::vector<BulletSweep> bulletSweeps;
+
+    // ---------------------------------------------------------
+    // AՓ˔ (CCD)
+    // ---------------------------------------------------------
+    // ȂRC_[ (EǁENX^) 
+    bool IsStaticBlocker(EntityID id) const { return colliderCache.layer[id] == CollisionLayer::Static; }
+    // ÓIRC_[̃Obh蒼 (Eړ)
+    void BuildStaticGrid();
+    //  fromto ɑ|AŏɓÓIOBB (܂) ܂ł̋Ԃ
+    // n_ŊɏdȂĂOBBƁAʂ minTopY ȉOBB͖
+    // candidates ̓Obh̍Ɨp (XbhƂɕʂ̂̂n)
+    // outNormal nƓʂ̖@Ԃ
+    bool SweepStatic(const DirectX::XMFLOAT3& from, const DirectX::XMFLOAT3& to, float radius,
+        float minTopY, float& outDist, std::vector<uint32_t>& candidates,
+        DirectX::XMFLOAT3* outNormal = nullptr) const;
+
+    Collision::OBBSoA staticBoxes;
+    Collision::UniformGrid staticGrid;
+    bool staticsDirty = true;
+    uint32_t staticVersion = 0;                 // staticBoxes 蒼
+
+    // ---------------------------------------------------------
+    //  (Kinematic)
+    // MovingSystem ̂ŐÓIObhɂ͓ꂸAXebv̕lߒB
+    // ɏĂ镨̂͏̑xԂꏏɉ^
+    // ---------------------------------------------------------
+    bool IsKinematic(EntityID id) const { return colliderCache.layer[id] == CollisionLayer::Kinematic; }
+    // OBBlߒ (Ȃ̂ŃObh͍炸`ɒׂ)
+    void BuildKinematicBoxes();
+    // ÕXebvœɏĂ̂̈ړʂ
+    // ɐGꂻȖĂ镨̂N
+    void CarryRiders(float dt);
+    // ڒnČʂAɏĂ邩L^
+    void SetGroundedOn(EntityID id, const Collision::RayHit& hit);
+
+    std::vector<EntityID> kinematicIDs;
+    Collision::OBBSoA kinematicBoxes;
+    std::vector<EntityID> groundedOn;           // Ă铮 (EntityIDňBȂ INVALID_ID)
+    std::vector<EntityID> riders;               // groundedOn Lȕ
+
+    // ϕÖʒu (EntityIDňBȇ|̎n_)
+    std::vector<DirectX::XMFLOAT3> stepStart;
+
+    // ---------------------------------------------------------
+    // LN^[Rg[[ (vC[EGl~[)
+    // ÕXebvŗʒuÃVXëʒu܂
+    // ɋ|AʂɉĊ点 (ő CONTROLLER_ITERATIONS )B
+    // ͐ڒnCō킹ALN^[mEp[cƂ̉
+    // IObhŋ߂ɂ鑊肾𔻒肷
+    // ---------------------------------------------------------
+    static constexpr int CONTROLLER_ITERATIONS = 3;
+    struct CharacterMove {
+        EntityID id;
+        DirectX::XMFLOAT3 from;         // ÕXebv̈ʒu ( to ɍ킹)
+        DirectX::XMFLOAT3 to;           // ̃VXëʒu
+        float radius;
+        float minTopY;                  // ʂȉ̔͏Ƃďz (͐ڒnCC)
+        DirectX::XMFLOAT3 result;       // 点̈ʒu
+        DirectX::XMFLOAT3 normals[CONTROLLER_ITERATIONS]; //  (x̕␳Ɏg)
+        int normalCount;
+    };
+    // 1̑̕|ƊAÓIRC_[̉o (ǂݎ̂݁BXbhĂł悢)
+    void SlideCharacter(CharacterMove& move, WorkerScratch& scratch) const;
+    // ʂ Transform ɏAʂɌx
+    void ApplyCharacterMove(const CharacterMove& move);
+    // RC_[ (LN^[Ep[c) ̃Obh蒼 (Xebv)
+    void BuildDynamicGrid();
+
+    std::vector<CharacterMove> characterMoves;
+    std::vector<DirectX::XMFLOAT3> settledPosition; // ÕXebv̍Ō̈ʒu (EntityIDň)
+    std::vector<uint32_t> settledFrame;             // settledPosition t[ԍ
+    Collision::OBBSoA dynamicBoxes;
+    Collision::UniformGrid dynamicGrid;
+
+    std::vector<BulletContact> bulletContacts;
 };
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*===================================================================
+// ファイル: ProjectileSystem.h
+// 概要: 弾幕の発射と、プールに入れた弾の移動・当たり判定
+//       PatternEmitterComponent のパターンに沿って斉射ごとにまとめて撃ち、
+//       弾はエンティティを作らず ProjectilePool に詰める。
+//       壁 (PhysicsSystem の静的コライダー) とプレイヤーに対して掃引し、
+//       当たった順にダメージを与える。描画は RenderSystem がまとめて行う
+=====================================================================*/
+#pragma once
+#include "ECS/System.h"
+#include "ECS/Component.h"
+#include "Game/ProjectilePool.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+class JobSystem;
+struct PatternEmitterComponent;
+struct BulletPatternDesc;
+
+// 1ステップ分の集計 (デバッグ表示用)
+struct ProjectileStats {
+    uint32_t spawned = 0;       // 撃った弾
+    uint32_t alive = 0;         // ステップの終わりに残っている弾
+    uint32_t peakAlive = 0;     // これまでの最大
+    uint32_t wallHits = 0;
+    uint32_t targetHits = 0;
+    uint32_t dropped = 0;       // 満杯で撃てなかった弾 (累計)
+    float ms = 0.0f;
+};
+
+class ProjectileSystem : public System {
+public:
+    void Init(World* world) override;
+    void Update(float dt) override;
+
+    const ProjectilePool& GetPool() const { return pool; }
+    const ProjectileStats& GetStats() const { return stats; }
+
+private:
+    // 当たり対象 (プレイヤー)。球とカプセルは芯の線分 a-b と半径で表す
+    struct Target {
+        EntityID id;
+        DirectX::XMFLOAT3 a, b;
+        float radius;
+    };
+    // 弾の接触 (targetID が INVALID_ID なら壁)
+    struct Hit {
+        float toi;              // ステップ内の時刻 (0-1)
+        uint32_t bullet;        // プールの番号
+        EntityID targetID;
+        DirectX::XMFLOAT3 point;
+    };
+    struct WorkerScratch {
+        std::vector<uint32_t> candidates;   // 静的グリッドの検索用
+        std::vector<Hit> hits;
+    };
+
+    // 番の来た発射装置から撃つ
+    void RunEmitters(float dt);
+    void FireVolley(const PatternEmitterComponent& emitter, const BulletPatternDesc& desc, const DirectX::XMFLOAT3& origin);
+    void CollectTargets();
+    // 全弾を掃引して接触を集め、時刻順に処理する
+    void SweepAndHit();
+    // プレイヤーに当てる (無敵中で素通りしたら false)
+    bool ApplyHit(EntityID targetID, uint32_t bullet, const DirectX::XMFLOAT3& point);
+
+    template<class Func>
+    void RunParallel(size_t count, size_t grain, Func&& func);
+
+    ProjectilePool pool;
+    std::vector<Target> targets;
+    std::vector<Hit> hits;
+    std::vector<WorkerScratch> scratch;
+    JobSystem* pJobs = nullptr;
+    ProjectileStats stats;
+};
@@ -54,8 +54,20 @@ private:
 	MeshComponent debugMeshSphere;
 
 
+	// ǉ: e̒e (ProjectilePool) ܂Ƃ߂ĕ`CX^X`
+	ComPtr<ID3D11VertexShader> pInstancedVS;
+	ComPtr<ID3D11InputLayout> pInstancedLayout;
+	ComPtr<ID3D11Buffer> pInstanceBuffer;       // Iobt@ (e1 = XMFLOAT4)
+	MeshComponent projectileMesh;
+	// e̕`XP[ (bV͔a0.5BGeBeB̒eƓ Scale 0.3 = a0.15)
+	static constexpr float PROJECTILE_DRAW_SCALE = 0.3f;
+
+
 	XMMATRIX CalculateWorldMatrix(const TransformComponent& t);
+	// ǉ: ŒXebvԂ̕Ԃ𔽉f`pTransform
+	TransformComponent GetRenderTransform(EntityID id, const TransformComponent& t, float alpha);
 	void UpdateConstantBuffer(ID3D11DeviceContext* context, XMMATRIX wvp);
 	void CreateDebugMesh(const MeshData& data, MeshComponent& outMesh);
+	void DrawProjectiles(ID3D11DeviceContext* context, const XMMATRIX& viewProj, float alpha);
 };
 
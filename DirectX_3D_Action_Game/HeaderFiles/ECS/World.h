@@ -10,15 +10,16 @@
 #pragma once
 #include "ECS/ECS.h"
 #include "ECS/System.h"
+#include "Engine/Random.h"
 #include <vector>
 #include <memory>
 
 class World {
 public:
-	World() {
-		registry = std::make_unique<Registry>();
-	}
+	World();
 	~World() {
+		for (auto* sys : fixedSystems)delete sys;
+		fixedSystems.clear();
 		for (auto* sys : systems)delete sys;
 		systems.clear();
 	}
@@ -78,10 +79,37 @@ public:
 		systems.push_back(sys);
 		return sys;
 	}
-	//ꊇXV
-	void Update(float dt) {
-		for (auto* sys : systems) sys->Update(dt);
+	//ǉ: ŒXebvŉSystem̓o^
+	//EQ[WbNȂǁAt[[gɌʂEꂽȂ
+	template <typename T, typename...Args>
+	T* AddFixedSystem(Args&&...args) {
+		T* sys = new T(std::forward<Args>(args)...);
+		fixedSystems.push_back(sys);
+		return sys;
+	}
+	//ǉ: o^ςSystem̎擾 (Ȃnullptr)
+	//System̌ (̃gK[CxgȂ) ǂނ̂Ɏg
+	template <typename T>
+	T* GetSystem() const {
+		for (auto* sys : fixedSystems) {
+			if (auto* found = dynamic_cast<T*>(sys)) return found;
+		}
+		for (auto* sys : systems) {
+			if (auto* found = dynamic_cast<T*>(sys)) return found;
+		}
+		return nullptr;
 	}
+	//ꊇXV
+	//ŒXebvSystem𗭂܂ԕ񂵂ĂAʏSystem1
+	void Update(float dt);
+
+	//ŒXebv̐ݒ
+	void SetFixedTickRate(int hz);
+	float GetFixedDeltaTime() const { return fixedDeltaTime; }
+	//`Ԃ̌W (0=OXebv, 1=ŐVXebv)
+	float GetInterpolationAlpha() const { return interpolationAlpha; }
+	//OUpdateŉ񂵂ŒXebv
+	int GetLastFixedStepCount() const { return lastFixedStepCount; }
 	//ꊇ`
 	void Draw() {
 		for (auto* sys : systems) sys->Draw();
@@ -90,7 +118,29 @@ public:
 	//Registryւ̒ڃANZX
 	Registry* GetRegistry() { return registry.get(); }
 
+	//ǉ: 
+	//V[̃V[hprƂɕʂ̗ (V[hȂ瓯WJɂȂ)
+	//GetRandom ̗̓CXbhpB[J[GƂ̗ MakeRandom ōĎ
+	void SetRandomSeed(uint64_t seed);
+	uint64_t GetRandomSeed() const { return randomSeed; }
+	Random& GetRandom(RandomStream stream) { return randoms[(size_t)stream]; }
+	Random MakeRandom(RandomStream stream, uint32_t index) const {
+		return Random(randomSeed, Random::MakeStream(stream, index));
+	}
+
 private:
+	//eŒXebv̑OɁAԑΏۂTransform prev ɕۑ
+	void SnapshotTransforms();
+
 	std::unique_ptr<Registry> registry;
 	std::vector<System*> systems;
+	std::vector<System*> fixedSystems;
+
+	float fixedDeltaTime = 1.0f / 60.0f;
+	float accumulator = 0.0f;
+	float interpolationAlpha = 1.0f;
+	int lastFixedStepCount = 0;
+
+	uint64_t randomSeed = 0;
+	Random randoms[(size_t)RandomStream::Count];
 };
\ No newline at end of file
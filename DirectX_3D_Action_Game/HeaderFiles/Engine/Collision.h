@@ -0,0 +1,138 @@
+/*===================================================================
+// t@C: Collision.h
+// Tv: SIMDꊇՓ˃NGi錾j
+//       OBB]ETCYWJς݂SoAzŕێA
+//       SSE(4) / AVX(8) Pʂł܂Ƃ߂Ĕ肷
+=====================================================================*/
+#pragma once
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Collision {
+
+    // ID (qbgȂ)
+    constexpr uint32_t INVALID_ID = 0xFFFFFFFF;
+
+    // -----------------------------------------------------------------
+    // OBBSoAz
+    // ]s̊es (= [JX/Y/Z̃[h) WJĕێB
+    // [JW = dot(p - center, ) ŋ܂̂ŋts͕sv
+    // -----------------------------------------------------------------
+    struct OBBSoA {
+        std::vector<float> cx, cy, cz;      // S
+        std::vector<float> r00, r01, r02;   // [JX
+        std::vector<float> r10, r11, r12;   // [JY
+        std::vector<float> r20, r21, r22;   // [JZ
+        std::vector<float> ex, ey, ez;      // TCY
+        std::vector<uint32_t> ids;          // ĂяoID (EntityIDȂ)
+
+        void Clear();
+        void Reserve(size_t n);
+        // 擪 n c (ɑւ鎞Ɏg)
+        void Truncate(size_t n);
+        size_t Size() const { return ids.size(); }
+
+        // rotation  Transform Ɠ (pitch, yaw, roll) ̃WA
+        void Add(uint32_t id, const DirectX::XMFLOAT3& center,
+            const DirectX::XMFLOAT3& extents, const DirectX::XMFLOAT3& rotation);
+        // vZς݂̃[hs񂩂] (3s) g
+        void Add(uint32_t id, const DirectX::XMFLOAT3& center,
+            const DirectX::XMFLOAT3& extents, const DirectX::XMFLOAT4X4& world);
+    };
+
+    // C (direction ͐Kς݂ł邱)
+    // radius > 0 Ȃ狅̑|ƂĈAOBBe radius 点Ĕ肷
+    // (pEӂł͎ۂ̋菭AێIȋߎ)
+    struct RayQuery {
+        DirectX::XMFLOAT3 origin;
+        DirectX::XMFLOAT3 direction;
+        float maxDist;
+        float radius = 0.0f;
+    };
+
+    // Č (ł߂qbg)
+    struct RayHit {
+        float distance = 0.0f;        // qbg (qbgȂȂ maxDist)
+        uint32_t id = INVALID_ID;     // qbgOBBID
+        int index = -1;               // qbgOBB̔zCfbNX
+        bool hit = false;
+    };
+
+    // P̔ (XJ[ŁBSIMD̒[ƌؗp)
+    // BoundingOrientedBox::Intersects ƓAn_Ȃ畉̋Ԃ
+    bool RaycastOBB(const OBBSoA& boxes, size_t index, const RayQuery& ray, float& outDist);
+
+    // _猩ĈԊOɂOBB̖ʂ̖@ ([h, PʃxNg)
+    // |œ̋̒SnƁAԂʂ̌܂
+    DirectX::XMFLOAT3 OBBFaceNormal(const OBBSoA& boxes, size_t index, const DirectX::XMFLOAT3& point);
+
+    // ꊇC: rays[i] ̍Ŋqbg hits[i] ɏ
+    void RaycastBatch(const OBBSoA& boxes, const RayQuery* rays, RayHit* hits, size_t rayCount);
+
+    //  vs OBB P̔ (XJ[)
+    // ŋߓ_܂ł̋^2 < radius^2 ȂqbgBoutPenetration = radius - 
+    bool SphereOverlapOBB(const OBBSoA& boxes, size_t index, const DirectX::XMFLOAT3& center, float radius, float& outPenetration);
+
+    //  vs OBB ꊇ
+    // outHit[i] ɃqbgtO(0/1)AoutPenetration[i] ɂ߂荞ݗʂ (z boxes.Size() ȏ)
+    // ߂l: qbg
+    size_t SphereOverlapBatch(const OBBSoA& boxes, const DirectX::XMFLOAT3& center, float radius,
+        uint8_t* outHit, float* outPenetration);
+
+    // | vs OBB ꊇ (Ŋ肾łȂAmaxDist ȓœSOBBԂ)
+    // outHit[i] ɃqbgtO(0/1)AoutToi[i] ɍŏɐG鋗 (n_ŏdȂĂ0)
+    // ߂l: qbg
+    size_t SweepSphereBatch(const OBBSoA& boxes, const RayQuery& ray, uint8_t* outHit, float* outToi);
+
+    // JvZ (c segStartsegEnd, a radius) vs OBB ̐ڐG ()
+    // boxWorld / boxInvWorld ͔̉]+sړ̍sƂ̋tAextents ͔TCY
+    // 󂢐ڐG͍ŋߓ_痣Ac̒Ȃԋ߂ʂ̌ɉo
+    // outPush: o ([h,  = ߂荞ݗ)
+    // outGap : cƔ̋ - a (c̒Ȃ -a)
+    bool CapsuleOBBContact(const DirectX::XMFLOAT3& segStart, const DirectX::XMFLOAT3& segEnd, float radius,
+        const DirectX::XMFLOAT4X4& boxWorld, const DirectX::XMFLOAT4X4& boxInvWorld, const DirectX::XMFLOAT3& extents,
+        DirectX::XMFLOAT3& outPush, float& outGap);
+
+    // -----------------------------------------------------------------
+    // Փ˃C[̑gݍ킹\ (32~32, Ώ)
+    // sƂɁu鑊背C[ṽrbg
+    // -----------------------------------------------------------------
+    class LayerMatrix {
+    public:
+        void Clear() { for (uint32_t& row : rows) row = 0; }
+        void Set(uint8_t a, uint8_t b, bool collide) {
+            if (collide) { rows[a] |= (1u << b); rows[b] |= (1u << a); }
+            else { rows[a] &= ~(1u << b); rows[b] &= ~(1u << a); }
+        }
+        bool Collides(uint8_t a, uint8_t b) const { return (rows[a] >> b) & 1u; }
+        uint32_t Row(uint8_t a) const { return rows[a]; }
+    private:
+        uint32_t rows[32] = {};
+    };
+
+    // -----------------------------------------------------------------
+    // XZʂ̈lObh (ȂOBB̍L攻p)
+    // OBBSoA ̃CfbNXAAABBdȂZɓo^Ă
+    // -----------------------------------------------------------------
+    class UniformGrid {
+    public:
+        // boxes ̑SOBBo^ (Zꍇ̓Z傫)
+        void Build(const OBBSoA& boxes, float cellSize);
+        void Clear();
+
+        //  ab  radius 点͈͂̃Zɂ outIndices ɏ (dȂE)
+        // Build ͓ǂݎ݂̂Ȃ̂ŁAXbh瓯ɌĂł悢
+        void QuerySegment(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b, float radius,
+            std::vector<uint32_t>& outIndices) const;
+
+    private:
+        float cellSize = 1.0f;
+        float invCellSize = 1.0f;
+        int originX = 0, originZ = 0;       // Z̔ԍ
+        int cellsX = 0, cellsZ = 0;
+        std::vector<uint32_t> cellStart;    // ZƂ items Jnʒu (cellsX*cellsZ+1)
+        std::vector<uint32_t> items;        // OBBSoA ̃CfbNX
+    };
+}
@@ -0,0 +1,63 @@
+/*===================================================================
+// ファイル: ConvexCollision.h
+// 概要: サポート関数による凸形状の当たり判定（宣言部）
+//       GJK で最近点距離/重なりを、EPA でめり込みの深さと向きを求める。
+//       球・カプセルは「芯 (点/線分) + 丸み(半径)」として扱い、
+//       芯同士の距離から半径を引くことで、GJKの反復を芯の形だけで済ませる
+=====================================================================*/
+#pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+
+namespace Collision {
+
+    // -----------------------------------------------------------------
+    // 凸形状 (芯の形 + 丸み)
+    // 判定の間だけ使う軽い値なので、毎回作って捨ててよい
+    // (Hull の頂点は呼び出し側が持ち続けること)
+    // -----------------------------------------------------------------
+    struct ConvexShape {
+        enum class Core : uint8_t {
+            Point,      // 球 (中心 + radius)
+            Segment,    // カプセル (ローカルY軸方向の線分 + radius)
+            Box,        // 箱 (half が半サイズ)
+            Hull        // 頂点の凸包 (points * half を回転して center に置く)
+        };
+        Core core = Core::Point;
+        DirectX::XMFLOAT3 center = { 0.0f, 0.0f, 0.0f };
+        DirectX::XMFLOAT3 axis[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }; // ローカルX/Y/Z軸のワールド方向
+        DirectX::XMFLOAT3 half = { 0.0f, 0.0f, 0.0f };  // Box: 半サイズ / Segment: half.y が芯の半分の長さ / Hull: 頂点に掛ける倍率
+        const DirectX::XMFLOAT3* points = nullptr;      // Hull: ローカル頂点
+        uint32_t pointCount = 0;
+        float radius = 0.0f;                            // 丸み (芯から表面までの距離)
+
+        static ConvexShape Sphere(const DirectX::XMFLOAT3& center, float radius);
+        // axisY: 芯の向き (単位ベクトル)
+        static ConvexShape Capsule(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& axisY, float halfLen, float radius);
+        // world: 回転 * 平行移動 (回転部分の上3行を軸として使う)
+        static ConvexShape Box(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT3& halfExtents);
+        static ConvexShape Hull(const DirectX::XMFLOAT4X4& world, const DirectX::XMFLOAT3& scale,
+            const DirectX::XMFLOAT3* points, uint32_t pointCount);
+
+        // 芯の中で dir 方向に一番遠い点 (丸みは含まない)
+        DirectX::XMFLOAT3 Support(const DirectX::XMFLOAT3& dir) const;
+    };
+
+    // 接触判定の結果
+    struct ConvexContact {
+        float distance = 0.0f;                          // 表面同士の距離 (離れていれば正、めり込んでいれば -深さ)
+        DirectX::XMFLOAT3 normal = { 0.0f, 1.0f, 0.0f };// B から A へ向かう単位ベクトル (A をこの向きに -distance 動かすと離れる)
+        int gjkIterations = 0;
+        int epaIterations = 0;                          // 芯が重なっていた時だけ
+    };
+
+    // GJK: 芯同士の最近点 (丸みは見ない)
+    // 離れていれば true を返し、outDist に距離、outPointA/B に最近点を書く
+    // 芯が重なっていれば false
+    bool GjkClosestPoints(const ConvexShape& a, const ConvexShape& b,
+        float& outDist, DirectX::XMFLOAT3& outPointA, DirectX::XMFLOAT3& outPointB, int* outIterations = nullptr);
+
+    // 表面同士の距離とめり込みを求める (GJK、芯が重なっていれば EPA)
+    // 戻り値: 表面が重なっているか (out.distance < 0)
+    bool ConvexOverlap(const ConvexShape& a, const ConvexShape& b, ConvexContact& out);
+}
@@ -36,6 +36,9 @@ public:
 
     // ǉ: VF[_[쐬Eݒ
     bool CreateVertexShader(const std::wstring& filename, ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppInputLayout);
+    // ǉ: ̓CAEgw肵č (CX^XƂ̃f[^𑫂Ȃ)
+    bool CreateVertexShader(const std::wstring& filename, const D3D11_INPUT_ELEMENT_DESC* layout, UINT layoutCount,
+        ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppInputLayout);
     bool CreatePixelShader(const std::wstring& filename, ID3D11PixelShader** ppPixelShader);
     // ǉ: WIgVF[_쐬
     bool CreateGeometryShader(const std::wstring& filename, ID3D11GeometryShader** ppGeometryShader);
@@ -43,6 +46,8 @@ public:
     // ǉ: obt@쐬
     bool CreateVertexBuffer(const std::vector<Vertex>& vertices, ID3D11Buffer** ppBuffer);
     bool CreateIndexBuffer(const std::vector<UINT>& indices, ID3D11Buffer** ppBuffer);
+    // ǉ: t[ Map ŏ钸_obt@ (byteWidth oCg)
+    bool CreateDynamicVertexBuffer(UINT byteWidth, ID3D11Buffer** ppBuffer);
 
     void InitUI(HWND hWnd);
 	void BeginUI();
@@ -33,10 +33,19 @@ public:
     // t[̏IɃZbg邽߂̊֐ (UpdateŌĂ)
     void ResetMouseWheel() { m_mouseWheelDelta = 0.0f; }
 
+    // ǉ: ŒXebvp̃b`
+    // ŒXebv̓t[Ƃ0`񑖂̂ŁAu/uԂ
+    // ɑXebv܂ŕێAŏ̃Xebv1񂾂
+    void BeginFixedStep() { m_inFixedStep = true; }
+    void EndFixedStep();
+
 private:
     HWND m_hWnd = nullptr; // Wϊpɕێ
     std::array<bool, 256> currentKeys;
     std::array<bool, 256> previousKeys;
+    std::array<bool, 256> latchedDown;  // ŒXebv́uuԁv
+    std::array<bool, 256> latchedUp;    // ŒXebv́uuԁv
+    bool m_inFixedStep = false;
 
     float m_mouseWheelDelta = 0.0f;
 };
@@ -0,0 +1,57 @@
+/*===================================================================
+// t@C: JobSystem.h
+// Tv: [J[XbhŔ͈͂𕪊ĕsȈՃWuVXe
+//       ĂяõXbh0ԂƂĈꏏɏASI܂Ŗ߂Ȃ
+=====================================================================*/
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+class JobSystem {
+public:
+    // {: [begin, end)  threadIndex Ԃ̃Xbhŏ
+    using RangeFunc = std::function<void(size_t begin, size_t end, unsigned threadIndex)>;
+
+    // workerCount: ĂяoȊÕXbh (0Ȃ _RA-1)
+    explicit JobSystem(unsigned workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Ăяo܂߂Xbh (XbhƂ̃obt@͂̐pӂ)
+    unsigned GetThreadCount() const { return (unsigned)workers.size() + 1; }
+
+    // [0, count)  grain ̂܂ɕĕɏ
+    // ܂͎̎sƂɕς̂ŁAʂ̓Xbhʃobt@ɏ
+    // Ăяoŏ߂Ă܂Ƃ߂邱
+    // maxThreads > 0 ȂgXbh𐧌 (vp)
+    void ParallelFor(size_t count, size_t grain, const RangeFunc& func, unsigned maxThreads = 0);
+
+private:
+    void WorkerLoop(unsigned threadIndex);
+    // ܂oď ([J[ƌĂяőʕ)
+    void RunChunks(unsigned threadIndex);
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wakeCv;     // d
+    std::condition_variable doneCv;     // SI
+
+    // s̎d (mutex ŕیAnextChunk ̂݃Ag~bN)
+    const RangeFunc* job = nullptr;
+    size_t jobCount = 0;
+    size_t jobGrain = 1;
+    unsigned jobThreads = 0;            // Q郏[J[
+    std::atomic<size_t> nextChunk{ 0 };
+    unsigned running = 0;               // ܂IĂȂ[J[
+    uint64_t generation = 0;            // d̒ʂԍ (Nꂽ[J[Vd)
+    bool quit = false;
+};
@@ -0,0 +1,86 @@
+/*===================================================================
+// ファイル: Random.h
+// 概要: 軽量な乱数生成器 (PCG32)
+//       rand() の代わりに使う。状態は16バイトで、同じシードとストリーム番号
+//       からは必ず同じ列が出る。ストリーム番号が違えば同じシードでも別の列に
+//       なるので、システムごと・スレッドごと・敵ごとに独立した列を持たせられる
+//       (1つの Random を複数スレッドで同時に使わないこと)
+=====================================================================*/
+#pragma once
+#include <cstdint>
+#include <chrono>
+
+// 乱数列の用途 (World がシードからこの数だけ列を作る)
+enum class RandomStream : uint32_t {
+    Spawn,      // 敵の配置・種類の抽選、ステージの生成
+    Enemy,      // 敵の思考 (敵ごとの列は番号に通し番号を入れる)
+    Effect,     // パーティクルの飛び方
+    Ambient,    // 背景の演出
+    UI,         // タイトルなど画面演出のちらつき
+    Worker,     // ジョブのスレッドごとの列 (番号にスレッド番号を入れる)
+    Count
+};
+
+class Random {
+public:
+    Random() = default;
+    Random(uint64_t seed, uint64_t stream) { Seed(seed, stream); }
+
+    // 用途と番号からストリーム番号を作る
+    static uint64_t MakeStream(RandomStream stream, uint32_t index = 0) {
+        return ((uint64_t)stream << 32) | index;
+    }
+
+    // 時計からシードを作る (固定シードが指定されていない時)
+    static uint64_t SeedFromClock() {
+        uint64_t x = (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        // splitmix64 で下位ビットの偏りを散らす
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    void Seed(uint64_t seed, uint64_t stream) {
+        state = 0;
+        inc = (stream << 1) | 1u;
+        NextU32();
+        state += seed;
+        NextU32();
+    }
+    // 一度も Seed していなければ false
+    bool IsSeeded() const { return inc != 0; }
+
+    uint32_t NextU32() {
+        const uint64_t old = state;
+        state = old * 6364136223846793005ull + inc;
+        const uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+        const uint32_t rot = (uint32_t)(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+    }
+
+    // [0, n) の整数 (rand() % n の代わり。割り算を使わない)
+    uint32_t UInt(uint32_t n) {
+        return (uint32_t)(((uint64_t)NextU32() * n) >> 32);
+    }
+    // [lo, hi) の整数
+    int Int(int lo, int hi) {
+        return lo + (int)UInt((uint32_t)(hi - lo));
+    }
+    // [0, 1) の実数
+    float Float() {
+        return (float)(NextU32() >> 8) * (1.0f / 16777216.0f);
+    }
+    // [lo, hi) の実数
+    float Float(float lo, float hi) {
+        return lo + (hi - lo) * Float();
+    }
+    // percent % の確率で true
+    bool Chance(uint32_t percent) {
+        return UInt(100) < percent;
+    }
+
+private:
+    uint64_t state = 0;
+    uint64_t inc = 0;       // 奇数 (0 なら未初期化)
+};
@@ -0,0 +1,93 @@
+/*===================================================================
+// ファイル: SpatialHash.h
+// 概要: 点の空間ハッシュ（XZ平面）
+//       毎フレーム Clear → Add → Build で作り直し、半径内の近傍を調べる。
+//       セル座標をハッシュしてバケットに振り分けるので、広さに上限がない
+=====================================================================*/
+#pragma once
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+class SpatialHash {
+public:
+    // 登録を全部消す (確保したメモリは残す)
+    void Clear();
+    // 点を登録する (Build するまで検索には出てこない)
+    void Add(uint32_t id, const DirectX::XMFLOAT3& position);
+    // 登録した点をバケットごとに並べ直す
+    // cellSize は検索半径と同じくらいにすると、1回の検索で見るセルが 3×3 で済む
+    void Build(float cellSize);
+
+    size_t Size() const { return ids.size(); }
+
+    // center から XZ平面上で radius 未満の点ごとに func(id, position, distSq) を呼ぶ
+    // 呼ばれる順番はバケット順 (同じバケット内は Add した順) で、毎回同じになる
+    // Build 後は読み取りのみなので、複数スレッドから同時に呼んでよい
+    template<class Func>
+    void ForEachInRadius(const DirectX::XMFLOAT3& center, float radius, Func&& func) const;
+
+private:
+    // 1回の検索で見るセル数の上限 (これを超える広い検索は全件を調べる)
+    static constexpr int MAX_QUERY_CELLS = 25;
+
+    static int CellOf(float v, float invSize) { return (int)std::floor(v * invSize); }
+    uint32_t BucketOf(int cx, int cz) const {
+        return ((uint32_t)cx * 73856093u ^ (uint32_t)cz * 19349663u) & mask;
+    }
+
+    float cellSize = 1.0f;
+    float invCellSize = 1.0f;
+    uint32_t mask = 0;                          // バケット数-1 (バケット数は2のべき乗)
+
+    // Build 後: バケット順に並べた点
+    std::vector<uint32_t> bucketStart;          // バケットごとの開始位置 (バケット数+1個)
+    std::vector<uint32_t> ids;
+    std::vector<DirectX::XMFLOAT3> positions;
+
+    // Build 前: Add された順
+    std::vector<uint32_t> pendingIds;
+    std::vector<DirectX::XMFLOAT3> pendingPositions;
+    std::vector<uint32_t> pendingBuckets;       // Build の作業用
+};
+
+template<class Func>
+void SpatialHash::ForEachInRadius(const DirectX::XMFLOAT3& center, float radius, Func&& func) const {
+    if (ids.empty()) return;
+    const float radiusSq = radius * radius;
+
+    auto visit = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            const DirectX::XMFLOAT3& p = positions[i];
+            const float dx = p.x - center.x;
+            const float dz = p.z - center.z;
+            const float dSq = dx * dx + dz * dz;
+            if (dSq < radiusSq) func(ids[i], p, dSq);
+        }
+    };
+
+    const int x0 = CellOf(center.x - radius, invCellSize), x1 = CellOf(center.x + radius, invCellSize);
+    const int z0 = CellOf(center.z - radius, invCellSize), z1 = CellOf(center.z + radius, invCellSize);
+    if ((x1 - x0 + 1) * (z1 - z0 + 1) > MAX_QUERY_CELLS) {
+        visit(0, (uint32_t)ids.size());
+        return;
+    }
+
+    // 別のセルが同じバケットに入っていることがあるので、同じバケットは1回だけ見る
+    uint32_t visited[MAX_QUERY_CELLS];
+    int visitedCount = 0;
+    for (int z = z0; z <= z1; ++z) {
+        for (int x = x0; x <= x1; ++x) {
+            const uint32_t bucket = BucketOf(x, z);
+            bool seen = false;
+            for (int v = 0; v < visitedCount; ++v) {
+                if (visited[v] == bucket) { seen = true; break; }
+            }
+            if (seen) continue;
+            visited[visitedCount++] = bucket;
+            visit(bucketStart[bucket], bucketStart[bucket + 1]);
+        }
+    }
+}
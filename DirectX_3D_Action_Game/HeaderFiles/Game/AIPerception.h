@@ -0,0 +1,48 @@
+/*===================================================================
+// ファイル: AIPerception.h
+// 概要: 敵AIの知覚（狙えるプレイヤーの一覧）
+//       フレームの最初に1回だけレジストリを調べて小さな配列にまとめ、
+//       敵ごとの「一番近い標的」「標的への向き」はこの配列から答える。
+//       隠密・視界などの「狙えるかどうか」のルールは IsTargetable に足す
+=====================================================================*/
+#pragma once
+#include "ECS/Component.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+class Registry;
+
+// 知覚している標的1つ分
+struct PerceivedTarget {
+    EntityID id = ECSConfig::INVALID_ID;
+    DirectX::XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+    float yaw = 0.0f;       // 向き (TransformComponent::rotation.y)
+    uint8_t team = 0;       // 陣営 (今はプレイヤー側の 0 のみ)
+    bool alive = false;     // HPが残っている
+    bool active = false;    // 操作中のキャラクター (PlayerComponent::isActive)
+};
+
+class AIPerception {
+public:
+    // レジストリからプレイヤーを集め直す (フレームに1回)
+    void Update(Registry* registry);
+
+    const std::vector<PerceivedTarget>& GetTargets() const { return targets; }
+
+    // from から XZ平面で一番近い、狙える標的の番号 (いなければ -1)
+    // 距離が同じならIDの小さい方 (以前の全ID走査と同じ結果になる)
+    int FindNearest(const DirectX::XMFLOAT3& from, float* outDistSq = nullptr) const;
+    const PerceivedTarget& GetTarget(int index) const { return targets[index]; }
+
+    // from から標的への単位ベクトル (3D)
+    DirectX::XMVECTOR DirectionTo(const DirectX::XMFLOAT3& from, int index) const;
+    // XZ平面上の距離^2
+    float DistanceSqTo(const DirectX::XMFLOAT3& from, int index) const;
+
+    // 狙えるかどうか (隠密・視界などのルールはここに足す)
+    static bool IsTargetable(const PerceivedTarget& t) { return t.alive && t.active; }
+
+private:
+    std::vector<PerceivedTarget> targets;   // ID順
+};
@@ -0,0 +1,125 @@
+/*===================================================================
+// ファイル: AIScheduler.h
+// 概要: 敵AIの思考を複数ステップに分散させるスケジューラ
+//       距離と画面内かどうかで更新頻度 (AILod) を決め、
+//       エンティティIDで順番をずらして、同じステップに思考が集中しないようにする。
+//       1ステップに思考できる数には予算があり、間に合わなかった分は
+//       次のステップに優先して回す。予算は時間ではなく思考の数で数えるので、
+//       誰が思考するかはマシンの負荷に左右されない (同じシードなら同じ結果になる)
+=====================================================================*/
+#pragma once
+#include "ECS/Component.h"
+#include "ECS/Components/EnemyComponent.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+class Registry;
+
+// 1ステップ分の集計 (デバッグ表示用)
+struct AISchedulerStats {
+    uint32_t submitted = 0;                         // 思考の候補になった敵
+    uint32_t thinks[(int)AILod::Count] = {};        // LODごとの思考した数
+    uint32_t deferred = 0;                          // 予算切れで次に回した数
+    double thinkUs = 0.0;                           // 思考に使った時間 (表示用。どの敵が思考するかには使わない)
+};
+
+class AIScheduler {
+public:
+    // LODごとの思考の間隔 (ステップ数)
+    static constexpr uint32_t LOD_PERIOD[(int)AILod::Count] = { 1, 4, 12 };
+    // 予算を使い切っても、Near 以外をこれだけは思考する (後回しが進まなくならないように)
+    static constexpr size_t MIN_THINKS = 16;
+    // Near 以外はこの数ずつまとめて渡す
+    static constexpr size_t BATCH_SIZE = 32;
+
+    float nearDistance = 15.0f;     // これより近ければ画面外でも毎ステップ
+    float farDistance = 45.0f;      // 画面内でもこれより遠ければ Far
+    // 1ステップに思考する数の上限 (Near の分も含む。0 なら無制限)
+    // 1回の思考はおよそ 0.7us (2000体・-O2 で計測) なので、512 でおよそ 0.4ms
+    uint32_t thinkBudget = 512;
+
+    // ステップの最初に呼ぶ (カメラを取り直し、候補を空にする)
+    void BeginStep(Registry* registry);
+
+    // 位置と標的までの距離から更新頻度を決める
+    AILod Classify(const DirectX::XMFLOAT3& position, float distToTarget) const;
+
+    // 思考の候補を登録する (今回が番でなければ何もしない)
+    // slot: 呼び出し側の番号 (Run でそのまま返す) / elapsed: 前回の思考からの経過時間
+    void Submit(uint32_t slot, EntityID id, AILod lod, float elapsed, float dt);
+
+    // 番の来た候補を thinkBatch(slots, count) でまとめて処理する
+    // Near は必ず (1回にまとめて)、それ以外は待たされている割合の大きい順に
+    // 予算の数まで BATCH_SIZE ずつ。まとまりの中は呼び出し側で並列に処理してよい
+    template<class Func>
+    void Run(Func&& thinkBatch);
+
+    const AISchedulerStats& GetStats() const { return stats; }
+
+private:
+    // 画面内か (前回描画したカメラの視錐台で、少し余裕を持たせて判定)
+    bool IsOnScreen(const DirectX::XMFLOAT3& position) const;
+
+    struct Entry {
+        uint32_t slot;
+        EntityID id;
+        AILod lod;
+        float overdue;              // 経過時間 / 間隔 (大きいほど待たされている)
+    };
+    std::vector<Entry> nearEntries; // 予算に関係なく毎回思考する
+    std::vector<Entry> entries;     // 予算の範囲で思考する
+    std::vector<uint32_t> batch;    // thinkBatch に渡す slot の並び
+
+    uint64_t step = 0;
+
+    // カメラ (ビュー空間で判定する)
+    bool hasCamera = false;
+    DirectX::XMFLOAT4X4 view;
+    float tanHalfX = 1.0f, tanHalfY = 1.0f;
+    float farZ = 1000.0f;
+
+    AISchedulerStats stats;
+};
+
+template<class Func>
+void AIScheduler::Run(Func&& thinkBatch) {
+    using Clock = std::chrono::steady_clock;
+
+    // 長く待たされているものから (同じなら ID 順)
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.overdue != b.overdue) return a.overdue > b.overdue;
+        return a.id < b.id;
+        });
+
+    // 予算は思考した数で数える (Near の分も含む)。時間は表示のために計るだけ
+    const Clock::time_point start = Clock::now();
+    batch.clear();
+    for (const Entry& e : nearEntries) {
+        batch.push_back(e.slot);
+        ++stats.thinks[(int)e.lod];
+    }
+    if (!batch.empty()) thinkBatch(batch.data(), batch.size());
+
+    // Near 以外に回せる数 (使い切っていても MIN_THINKS だけは思考する)
+    size_t allowed = entries.size();
+    if (thinkBudget > 0) {
+        const size_t left = (thinkBudget > nearEntries.size()) ? thinkBudget - nearEntries.size() : 0;
+        allowed = std::min(entries.size(), std::max(left, MIN_THINKS));
+    }
+    size_t done = 0;
+    while (done < allowed) {
+        const size_t end = std::min(allowed, done + BATCH_SIZE);
+        batch.clear();
+        for (size_t i = done; i < end; ++i) {
+            batch.push_back(entries[i].slot);
+            ++stats.thinks[(int)entries[i].lod];
+        }
+        thinkBatch(batch.data(), batch.size());
+        done = end;
+    }
+    stats.deferred = (uint32_t)(entries.size() - done);
+    stats.thinkUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
@@ -0,0 +1,49 @@
+/*===================================================================
+// ファイル: BulletPattern.h
+// 概要: 弾幕パターンの定義（データで書く）
+//       1回の斉射で何発を、どの範囲へ、どの間隔で撃つか、
+//       基準の角度の回転や狙い方を BulletPatternDesc にまとめる。
+//       ボスの攻撃は BulletPatternID で指定し、撃つのは ProjectileSystem
+=====================================================================*/
+#pragma once
+#include <cstdint>
+
+// 弾の向きの決め方
+enum class AimMode : uint8_t {
+    Ring,       // 基準の角度から水平に広げる (上下だけ標的の高さに合わせる)
+    AtTarget,   // 発射口から標的へ向け、その左右に広げる (標的がいなければ撃たない)
+};
+
+struct BulletPatternDesc {
+    // 1回の斉射
+    int ringCount = 1;              // 1つの発射口から撃つ数
+    float spread = 0.0f;            // 広げる角度 (ラジアン。2π 以上なら一周を等分)
+    float cadence = 0.1f;           // 斉射の間隔 (秒)
+    float rotationSpeed = 0.0f;     // 基準の角度の回転 (ラジアン/秒)
+    AimMode aim = AimMode::Ring;
+
+    // 発射口 (emitterCount 個を半径 emitterRadius の円に並べ、emitterSpin で回す)
+    int emitterCount = 1;
+    float emitterRadius = 0.0f;
+    float emitterSpin = 0.0f;       // ラジアン/秒
+    float spawnHeight = 1.0f;       // 足元からの高さ
+
+    // 弾
+    float speed = 10.0f;
+    float lifeTime = 5.0f;
+    int damage = 10;
+    float aimHeight = 0.5f;         // 標的の足元からどの高さを狙うか
+
+    float duration = 3.0f;          // パターン全体の長さ (秒)
+};
+
+// ボスの攻撃パターン (フェーズで変わるものは別の番号にする)
+enum class BulletPatternID : uint8_t {
+    RingBarrage,    // 回転する4方向の弾
+    RapidFire,      // 狙い撃ち
+    RapidFireP2,    // 狙い撃ち (第2形態: 間隔が短い)
+    BitLaser,       // 周りのビットから一斉に狙い撃ち
+    Count
+};
+
+const BulletPatternDesc& GetBulletPattern(BulletPatternID id);
@@ -0,0 +1,41 @@
+/*===================================================================
+// ファイル: EnemyStateBuckets.h
+// 概要: 敵を状態 (EnemyState) ごとのIDの列に分けて持っておく
+//       列はステップをまたいで持ち続け、状態が変わった時だけ移す
+//       (抜く時は末尾と入れ替える)。毎ステップ並べ直さずに
+//       「追跡中の敵だけ」「ボスの待機中だけ」を順に処理できる。
+//       見かけなくなった敵 (倒された・消された) は RemoveUnseen で抜く
+=====================================================================*/
+#pragma once
+#include "ECS/Component.h"
+#include "ECS/Components/EnemyComponent.h"
+#include <vector>
+#include <cstdint>
+
+class EnemyStateBuckets {
+public:
+    static constexpr int STATE_COUNT = (int)EnemyState::BossRapidFire + 1;
+
+    // ステップの最初に呼ぶ (見かけた印を新しくする)
+    void BeginStep();
+    // id の状態を state にする (列が変わる時だけ移す)。このステップで見かけた印も付ける
+    void Set(EntityID id, EnemyState state);
+    // このステップで一度も Set されなかった敵を抜く
+    void RemoveUnseen();
+
+    const std::vector<EntityID>& Get(EnemyState state) const { return ids[(int)state]; }
+    // このステップで列を移った数 (デバッグ表示用)
+    uint32_t GetTransitions() const { return transitions; }
+
+private:
+    static constexpr uint8_t NONE = 0xFF;
+
+    void Remove(EntityID id);
+
+    std::vector<EntityID> ids[STATE_COUNT];
+    std::vector<uint8_t> stateOf;   // EntityID で引く (NONE ならどの列にもいない)
+    std::vector<uint32_t> indexOf;  // 列の中の位置
+    std::vector<uint32_t> seen;     // 最後に Set されたステップ
+    uint32_t stamp = 0;
+    uint32_t transitions = 0;
+};
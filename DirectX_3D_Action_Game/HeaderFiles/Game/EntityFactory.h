@@ -21,6 +21,7 @@
 #include "ECS/Components/PlayerPartComponent.h"
 #include "ECS/Components/PhysicsComponent.h"
 #include "ECS/Components/BulletComponent.h"
+#include "ECS/Components/PatternEmitterComponent.h"
 #include "ECS/Components/ParticleComponent.h"
 #include "ECS/Components/EnemyPartComponent.h"
 #include "App/Game.h"
@@ -65,10 +66,12 @@ namespace EntityFactory {
         mesh.indexCount = (UINT)data.indices.size();
         mesh.stride = sizeof(Vertex);
 
-        // GPUobt@쐬
-        Graphics* g = Game::GetInstance()->GetGraphics();
-        g->CreateVertexBuffer(data.vertices, mesh.pVertexBuffer.GetAddressOf());
-        g->CreateIndexBuffer(data.indices, mesh.pIndexBuffer.GetAddressOf());
+        // GPUobt@쐬 (Game Ȃ (eXgȂ) ͍Ȃ)
+        Graphics* g = Game::GetInstance() ? Game::GetInstance()->GetGraphics() : nullptr;
+        if (g) {
+            g->CreateVertexBuffer(data.vertices, mesh.pVertexBuffer.GetAddressOf());
+            g->CreateIndexBuffer(data.indices, mesh.pIndexBuffer.GetAddressOf());
+        }
 
         // ColliderComponentݒ
         auto& col = world->GetComponent<ColliderComponent>(id);
@@ -82,6 +85,9 @@ namespace EntityFactory {
         else if (colType == ColliderType::Type_Sphere) {
             col.SetSphere(cx); // cx𔼌aƂĎg
         }
+        else if (colType == ColliderType::Type_Hull) {
+            col.SetHull(shape, cx, cy, cz); // bV̒_ cx,cy,cz |ʕ
+        }
     }
 
     // ֐
@@ -92,6 +98,10 @@ namespace EntityFactory {
              .rotation = params.rotation,
              .scale = params.scale
         };
+        // ǉ: ŒXebvœLN^[͕`掞ɕԂ
+        transformData.interpolate =
+            params.type == "Player" || params.type == "Enemy" || params.type == "EnemyRanged" ||
+            params.type == "Enemy2" || params.type == "Boss";
         // 2. x[XEntity쐬 & Transformo^
         EntityID id = world->CreateEntity()
             .AddComponent<TransformComponent>(transformData) // f[^n
@@ -100,7 +110,7 @@ namespace EntityFactory {
         // 2. ^CvʃR|[lg\
         if (params.type == "Player") {
             world->AddComponent<MeshComponent>(id);
-            world->AddComponent<ColliderComponent>(id);
+            world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Player });
             world->AddComponent<PlayerComponent>(id, PlayerComponent{ .type = params.playerType,.moveSpeed = 5.0f });
             world->AddComponent<StatusComponent>(id, StatusComponent{ .hp = 100, .maxHp = 100, .attackPower = 5 });
             world->AddComponent<ActionComponent>(id, ActionComponent{ .attackCooldown = 1.0f, .duration = 0.5f });
@@ -586,7 +596,7 @@ namespace EntityFactory {
         // ====================================================
         else if (params.type == "Enemy") {
             world->AddComponent<MeshComponent>(id);
-            world->AddComponent<ColliderComponent>(id);
+            world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Enemy });
             world->AddComponent<EnemyComponent>(id, EnemyComponent{ .moveSpeed = 3.5f, .attackRange = 1.5f, .isRanged = false, .weight = 1.0f ,.isImmovable = false });
             world->AddComponent<StatusComponent>(id, StatusComponent{ .hp = 30, .maxHp = 30, .attackPower = 10 });
             world->AddComponent<PhysicsComponent>(id, PhysicsComponent{ .velocity = {0,0,0}, .useGravity = true });
@@ -648,7 +658,7 @@ namespace EntityFactory {
         // ====================================================
         else if (params.type == "EnemyRanged") {
             world->AddComponent<MeshComponent>(id);
-            world->AddComponent<ColliderComponent>(id);
+            world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Enemy });
             world->AddComponent<EnemyComponent>(id, EnemyComponent{ .moveSpeed = 2.5f, .attackRange = 15.0f, .isRanged = true, .weight = 3.0f,.isImmovable = false });
             world->AddComponent<StatusComponent>(id, StatusComponent{ .hp = 30, .maxHp = 30, .attackPower = 15 });
             world->AddComponent<PhysicsComponent>(id, PhysicsComponent{ .velocity = {0,0,0}, .useGravity = true });
@@ -695,7 +705,7 @@ namespace EntityFactory {
             // ====================================================
         else if (params.type == "Enemy2") {
                 world->AddComponent<MeshComponent>(id);
-                world->AddComponent<ColliderComponent>(id);
+                world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Enemy });
                 world->AddComponent<EnemyComponent>(id, EnemyComponent{ .moveSpeed = 2.0f, .attackRange = 3.0f, .isRanged = false, .weight = 10.0f,.isImmovable = false });
                 world->AddComponent<StatusComponent>(id, StatusComponent{ .hp = 200, .maxHp = 200, .attackPower = 25 });
                 world->AddComponent<PhysicsComponent>(id, PhysicsComponent{ .velocity = {0,0,0}, .useGravity = true });
@@ -751,9 +761,11 @@ namespace EntityFactory {
                 // ====================================================
         else if (params.type == "Boss") {
                     world->AddComponent<MeshComponent>(id);
-                    world->AddComponent<ColliderComponent>(id);
+                    world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Enemy });
                     // sݒ (weight=, isImmovable=true)
                     world->AddComponent<EnemyComponent>(id, EnemyComponent{ .type = EnemyType::Boss, .moveSpeed = 0.0f, .attackRange = 40.0f, .isRanged = true,.attackInterval = 5.0f,.weight = 1000.0f, .isImmovable = true });
+                    // ǉ: e̔ˑu (̂ ProjectileSystem)
+                    world->AddComponent<PatternEmitterComponent>(id);
                     world->AddComponent<StatusComponent>(id, StatusComponent{ .hp = 1000, .maxHp = 1000, .attackPower = 40 });
                     world->AddComponent<PhysicsComponent>(id, PhysicsComponent{ .velocity = {0,0,0}, .useGravity = false });
 
@@ -855,8 +867,8 @@ namespace EntityFactory {
             world->AddComponent<ColliderComponent>(id);
 
             // `: DOUBLE_PYRAMID (_C^/NX^^)
-            // 蔻: Type_Box (^)
-            AttachMeshAndCollider(id, world, ShapeType::DOUBLE_PYRAMID, params.color, ColliderType::Type_Box, 1.0f, 2.0f, 1.0f);
+            // C: 蔻ڂƓ_C^ (Type_Hull)BƊp̉ȂŉԂ
+            AttachMeshAndCollider(id, world, ShapeType::DOUBLE_PYRAMID, params.color, ColliderType::Type_Hull, 1.0f, 1.0f, 1.0f);
 
             DebugLog("[Factory] Created Crystal/HealSpot ID: %d", id);
         }
@@ -876,7 +888,7 @@ namespace EntityFactory {
     inline void CreateAttackHitbox(World* world, EntityID ownerID, DirectX::XMFLOAT3 pos, DirectX::XMFLOAT3 scale, int damage) {
         EntityID id = world->CreateEntity()
             .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = scale })
-            .AddComponent<ColliderComponent>()
+            .AddComponent<ColliderComponent>(ColliderComponent{ .layer = CollisionLayer::AttackBox })
             .AddComponent<AttackBoxComponent>(AttackBoxComponent{ .ownerID = (int)ownerID, .damage = damage, .lifeTime = 0.1f })
             .Build();
 
@@ -891,7 +903,7 @@ namespace EntityFactory {
     inline void CreateRecoveryHitbox(World* world, EntityID ownerID, DirectX::XMFLOAT3 pos, DirectX::XMFLOAT3 scale, int healAmount) {
         EntityID id = world->CreateEntity()
             .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = scale })
-            .AddComponent<ColliderComponent>()
+            .AddComponent<ColliderComponent>(ColliderComponent{ .layer = CollisionLayer::RecoveryBox })
             .AddComponent<RecoveryBoxComponent>(RecoveryBoxComponent{ .ownerID = (int)ownerID, .healAmount = healAmount, .lifeTime = 0.5f })
             .Build();
 
@@ -918,7 +930,7 @@ namespace EntityFactory {
 
         // ڂƓ蔻
         world->AddComponent<MeshComponent>(id);
-        world->AddComponent<ColliderComponent>(id);
+        world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::AttackSphere });
 
         // Aa0.5
         AttachMeshAndCollider(id, world, ShapeType::SPHERE, Colors::White, ColliderType::Type_Sphere, 0.5f, 0.0f, 0.0f);
@@ -940,7 +952,7 @@ namespace EntityFactory {
 
         // ڂƓ蔻
         world->AddComponent<MeshComponent>(id);
-        world->AddComponent<ColliderComponent>(id);
+        world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::RecoverySphere });
 
         // ΂̋Aa0.5 (Scale1.0̂Ƃ)
         // ł ShapeType::SPHERE (a1) Ȃ̂ Scale𒲐
@@ -952,12 +964,12 @@ namespace EntityFactory {
     inline void CreateEnemyBullet(World* world, DirectX::XMFLOAT3 pos, DirectX::XMFLOAT3 dir, int damage) {
         // ȐԂ
         EntityID id = world->CreateEntity()
-            .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = {0.3f, 0.3f, 0.3f} })
+            .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = {0.3f, 0.3f, 0.3f}, .interpolate = true })
             .AddComponent<BulletComponent>(BulletComponent{ .damage = damage, .lifeTime = 5.0f, .isActive = true })
             .Build();
 
         world->AddComponent<MeshComponent>(id);
-        world->AddComponent<ColliderComponent>(id);
+        world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::EnemyBullet });
 
         // bVƓ蔻 ()
         AttachMeshAndCollider(id, world, ShapeType::SPHERE, Colors::Red, ColliderType::Type_Sphere, 0.3f, 0.0f, 0.0f);
@@ -978,7 +990,7 @@ namespace EntityFactory {
     inline void CreatePlayerBullet(World* world, DirectX::XMFLOAT3 pos, DirectX::XMFLOAT3 dir, int damage) {
         // Ȕe
         EntityID id = world->CreateEntity()
-            .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = {0.4f, 0.4f, 0.8f} }) // ג
+            .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = {0.4f, 0.4f, 0.8f}, .interpolate = true }) // ג
             // `: damage, lifeTime, isActive, fromPlayer
             .AddComponent<BulletComponent>(BulletComponent{
                 .damage = damage,
@@ -989,7 +1001,7 @@ namespace EntityFactory {
             .Build();
 
         world->AddComponent<MeshComponent>(id);
-        world->AddComponent<ColliderComponent>(id);
+        world->AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::PlayerBullet });
 
         // `͋AJvZۂ邽߂Sphere
         // FType Cɍ킹ăGhO[
@@ -1007,10 +1019,11 @@ namespace EntityFactory {
     }
     // ǉ: GtFNg֐
     inline void CreateExplosion(World* world, DirectX::XMFLOAT3 pos, int count, DirectX::XMFLOAT4 color) {
+        Random& rng = world->GetRandom(RandomStream::Effect);
         for (int i = 0; i < count; ++i) {
-            float speed = 5.0f + (rand() % 100) / 10.0f;
-            float angleY = (rand() % 360) * 3.14f / 180.0f;
-            float angleV = ((rand() % 180) - 90) * 3.14f / 180.0f;
+            float speed = rng.Float(5.0f, 15.0f);
+            float angleY = rng.Float(0.0f, DirectX::XM_2PI);
+            float angleV = rng.Float(-DirectX::XM_PIDIV2, DirectX::XM_PIDIV2);
 
             float vx = cosf(angleV) * sinf(angleY) * speed;
             float vy = sinf(angleV) * speed;
@@ -1019,7 +1032,7 @@ namespace EntityFactory {
             EntityID id = world->CreateEntity()
                 .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = {0.5f, 0.5f, 0.5f} })
                 .AddComponent<ParticleComponent>(ParticleComponent{
-                    .lifeTime = 0.5f + (rand() % 50) / 100.0f,
+                    .lifeTime = rng.Float(0.5f, 1.0f),
                     .velocity = {vx, vy, vz},
                     .useGravity = false, // ͔юU
                     .scaleSpeed = -2.0f,
@@ -1034,15 +1047,16 @@ namespace EntityFactory {
     }
     // ǉ: GtFNg (ɍ)
     inline void CreateSmoke(World* world, DirectX::XMFLOAT3 pos, int count, DirectX::XMFLOAT4 color) {
+        Random& rng = world->GetRandom(RandomStream::Effect);
         for (int i = 0; i < count; ++i) {
-            float vx = (rand() % 100 - 50) / 20.0f;
-            float vy = (rand() % 100) / 20.0f + 1.0f; // ㏸
-            float vz = (rand() % 100 - 50) / 20.0f;
+            float vx = rng.Float(-2.5f, 2.5f);
+            float vy = rng.Float(1.0f, 6.0f); // ㏸
+            float vz = rng.Float(-2.5f, 2.5f);
 
             EntityID id = world->CreateEntity()
                 .AddComponent<TransformComponent>(TransformComponent{ .position = pos, .scale = {0.8f, 0.8f, 0.8f} })
                 .AddComponent<ParticleComponent>(ParticleComponent{
-                    .lifeTime = 1.0f + (rand() % 10) / 10.0f, // 
+                    .lifeTime = rng.Float(1.0f, 2.0f), // 
                     .velocity = {vx, vy, vz},
                     .useGravity = false,
                     .scaleSpeed = -0.3f, // 菬Ȃ
@@ -1080,11 +1094,12 @@ namespace EntityFactory {
     }
     // ǉ: qbgGtFNg (ΉԂU炷)
     inline void CreateHitEffect(World* world, DirectX::XMFLOAT3 pos, int count, DirectX::XMFLOAT4 color) {
+        Random& rng = world->GetRandom(RandomStream::Effect);
         for (int i = 0; i < count; ++i) {
             // _ȑx (-5.0 ~ +5.0)
-            float vx = (rand() % 100 - 50) / 10.0f;
-            float vy = (rand() % 100) / 10.0f + 2.0f; // ɒ˂
-            float vz = (rand() % 100 - 50) / 10.0f;
+            float vx = rng.Float(-5.0f, 5.0f);
+            float vy = rng.Float(2.0f, 12.0f); // ɒ˂
+            float vz = rng.Float(-5.0f, 5.0f);
 
             EntityID id = world->CreateEntity()
                 .AddComponent<TransformComponent>(TransformComponent{
@@ -1092,7 +1107,7 @@ namespace EntityFactory {
                     .scale = {0.2f, 0.2f, 0.2f} // 
                     })
                 .AddComponent<ParticleComponent>(ParticleComponent{
-                    .lifeTime = 0.5f + (rand() % 10) / 20.0f, // 0.5~1.0bŏ
+                    .lifeTime = rng.Float(0.5f, 1.0f), // 0.5~1.0bŏ
                     .velocity = {vx, vy, vz},
                     .useGravity = true,  // d͂ŗ
                     .scaleSpeed = -0.5f  // XɏȂ
@@ -0,0 +1,57 @@
+/*===================================================================
+// ファイル: FlowField.h
+// 概要: 標的へ向かう流れ場（全ての敵で1枚を共有する）
+//       NavGrid 上で標的のセルからダイクストラ法で距離を広げ、
+//       セルごとに「次に進む隣のセル」を持っておく。
+//       標的がセルを移った時だけ作り直し、敵は自分のセルを引くだけ (O(1))
+//       「標的まで見通せるか」は敵が立っているセルだけ、初めて引かれた時に調べて覚える
+=====================================================================*/
+#pragma once
+#include "Game/NavGrid.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+
+class FlowField {
+public:
+    // 標的のセルかグリッドが変わっていれば作り直す (作り直したら true)
+    bool Update(const NavGrid& grid, const DirectX::XMFLOAT3& goal);
+
+    // 回り道が必要なら true を返し、outDir に進む向き (XZ平面の単位ベクトル) を書く
+    // 標的まで見通せる・流れ場の外・たどり着けないセルでは false (呼び出し側でまっすぐ進む)
+    // 見通しのメモは atomic なので、複数のスレッドから同時に呼んでもよい
+    bool Sample(const DirectX::XMFLOAT3& position, DirectX::XMFLOAT3& outDir) const;
+
+    // 直近の作り直しにかかった時間と、たどり着けるセル数 (デバッグ表示用)
+    double GetLastBuildUs() const { return lastBuildUs; }
+    uint32_t GetReachableCells() const { return reachableCells; }
+
+private:
+    static constexpr uint8_t NO_NEXT = 0xFF;
+    static constexpr uint32_t UNREACHED = 0xFFFFFFFF;
+    // 距離のバケツ数 (一歩のコストの最大 14 より大きければ、輪にして使い回せる)
+    static constexpr uint32_t BUCKET_COUNT = 16;
+
+    // 見通しのメモ
+    enum : uint8_t { VIS_UNKNOWN = 0, VIS_YES = 1, VIS_NO = 2 };
+
+    void Rebuild();
+
+    const NavGrid* grid = nullptr;
+    uint32_t gridVersion = 0;
+    int goalX = -1, goalZ = -1;
+
+    std::vector<uint32_t> cost;     // 標的までの距離 (縦横10 / 斜め14)
+    std::vector<uint8_t> next;      // 進む隣のセル (8近傍の番号)
+    // 標的のセルまで見通せるか (VIS_*)。Sample から書くので atomic
+    std::unique_ptr<std::atomic<uint8_t>[]> visible;
+    size_t visibleCapacity = 0;
+
+    // ダイクストラ法の作業用 (距離 % BUCKET_COUNT ごとのセル番号)
+    std::vector<uint32_t> buckets[BUCKET_COUNT];
+
+    double lastBuildUs = 0.0;
+    uint32_t reachableCells = 0;
+};
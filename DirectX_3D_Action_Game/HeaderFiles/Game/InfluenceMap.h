@@ -0,0 +1,100 @@
+/*===================================================================
+// ファイル: InfluenceMap.h
+// 概要: 遠距離の敵の立ち位置選び用の影響マップ（全ての敵で1枚を共有する）
+//       NavGrid のセルを COARSE 個ずつまとめた粗いグリッドに、
+//         threat: プレイヤーの近さと向き (正面ほど危ない)
+//         crowd : 雑魚敵の混み具合
+//         cover : 周りの壁の多さ (壁際ほど隠れやすい)
+//       を持つ。cover は壁が変わった時だけ作り、threat と crowd は
+//       毎ステップ cellsPerStep 個ずつ順番に書き直す (敵の数によらず一定の手間)。
+//       敵は FindPosition で周りのセルを比べるだけで、他の敵や壁を直接調べない
+=====================================================================*/
+#pragma once
+#include "Game/NavGrid.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+// 1ステップ分の集計 (デバッグ表示用)
+struct InfluenceMapStats {
+    uint32_t cells = 0;         // 粗いセルの数
+    uint32_t refreshed = 0;     // このステップで書き直したセル
+    uint32_t sources = 0;       // 脅威の元 (プレイヤー)
+};
+
+class InfluenceMap {
+public:
+    // NavGrid のセルいくつ分を1マスにするか
+    static constexpr int COARSE = 4;
+    // プレイヤーの脅威が届く距離と、正面からの角度による重み (背後はこの割合)
+    static constexpr float THREAT_RADIUS = 20.0f;
+    static constexpr float THREAT_BEHIND = 0.3f;
+    // 1マスにこの数の敵がいたら crowd は最大
+    static constexpr float CROWD_FULL = 4.0f;
+    // 立ち位置を探す範囲 (マス)
+    static constexpr int SEARCH_RADIUS = 2;
+
+    // 立ち位置の点数の重み
+    struct Weights {
+        float range = 2.0f;     // 理想の距離からのずれ (理想の距離で割った値に掛ける)
+        float threat = 1.5f;
+        float crowd = 1.0f;
+        float cover = 0.6f;
+        float travel = 0.05f;   // 遠いマスほど少し減点 (同点なら近い方)
+    };
+
+    uint32_t cellsPerStep = 128;    // 1ステップに書き直すマスの数
+    Weights weights;
+
+    // ステップの最初に呼ぶ (グリッドが作り直されていれば作り直す。脅威の元と混み具合は空にする)
+    void BeginStep(const NavGrid& grid);
+    // 脅威の元 (yaw はプレイヤーの向き。TransformComponent::rotation.y)
+    void AddThreat(const DirectX::XMFLOAT3& position, float yaw);
+    // 雑魚敵1体分の混み具合
+    void AddAgent(const DirectX::XMFLOAT3& position);
+    // 順番の来たマスの threat と crowd を書き直す
+    void Refresh();
+
+    bool IsValid() const { return width > 0; }
+
+    // from の周りで、target から preferredRange 離れた一番良いマスの中心を outPos に書く
+    // 今いるマスが一番良ければ (あるいはマップの外なら) false
+    // 書き換えないので、BeginStep・Add*・Refresh と重ならなければ複数のスレッドから呼んでよい
+    bool FindPosition(const DirectX::XMFLOAT3& from, const DirectX::XMFLOAT3& target, float preferredRange,
+                      DirectX::XMFLOAT3& outPos) const;
+
+    // マスの値 (デバッグ表示用。マップの外は 0)
+    float ThreatAt(const DirectX::XMFLOAT3& p) const;
+    float CrowdAt(const DirectX::XMFLOAT3& p) const;
+    float CoverAt(const DirectX::XMFLOAT3& p) const;
+
+    const InfluenceMapStats& GetStats() const { return stats; }
+
+private:
+    struct Source {
+        float x, z;
+        float forwardX, forwardZ;
+    };
+
+    void Rebuild();
+    bool CoarseOf(const DirectX::XMFLOAT3& p, int& outX, int& outZ) const;
+    int Index(int x, int z) const { return z * width + x; }
+    DirectX::XMFLOAT3 Center(int x, int z) const;
+    float ComputeThreat(float x, float z) const;
+
+    const NavGrid* grid = nullptr;
+    uint32_t gridVersion = 0;
+    int width = 0, height = 0;
+    float cellSize = 0.0f;
+    float originX = 0.0f, originZ = 0.0f;
+
+    std::vector<float> threat;
+    std::vector<float> crowd;
+    std::vector<float> cover;
+    std::vector<uint8_t> walkable;  // 半分以上のセルが通れるマス
+    std::vector<uint16_t> agentCount;   // このステップの敵の数 (Refresh で crowd に写す)
+    std::vector<Source> sources;
+    uint32_t cursor = 0;            // 次に書き直すマス
+
+    InfluenceMapStats stats;
+};
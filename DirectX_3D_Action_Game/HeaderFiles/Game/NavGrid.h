@@ -0,0 +1,68 @@
+/*===================================================================
+// ファイル: NavGrid.h
+// 概要: 敵の移動用の通行グリッド（XZ平面）
+//       静的コライダーのうち、歩く高さを塞ぐ箱 (壁・柱) を
+//       エージェントの半径だけ太らせてセルに焼き込む
+=====================================================================*/
+#pragma once
+#include "Engine/Collision.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+class NavGrid {
+public:
+    // セル数の上限 (超える場合はセルを大きくする)
+    static constexpr int MAX_CELLS = 256 * 256;
+
+    // 8近傍 (0-3: 縦横, 4-7: 斜め) と、移動コスト (縦横10 / 斜め14)
+    static constexpr int NEIGHBOR_X[8] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+    static constexpr int NEIGHBOR_Z[8] = { 0, 0, 1, -1, 1, 1, -1, -1 };
+    static constexpr uint32_t NEIGHBOR_COST[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+
+    // 作り方の設定
+    struct Settings {
+        float cellSize = 1.0f;
+        float agentRadius = 0.5f;   // 壁からこれより近いセルは通れない
+        float walkY = 0.0f;         // 歩く面の高さ
+        float stepHeight = 0.3f;    // 上面がこれ以下の箱は床として無視する
+        float agentHeight = 2.0f;   // 下面がこれ以上の箱は頭上なので無視する
+    };
+
+    // statics (静的コライダー) から作り直す
+    void Build(const Collision::OBBSoA& statics, const Settings& settings);
+
+    bool IsValid() const { return width > 0; }
+    int Width() const { return width; }
+    int Height() const { return height; }
+    int CellCount() const { return width * height; }
+    float CellSize() const { return cellSize; }
+    // Build するたびに増える (使う側はこれで作り直しを知る)
+    uint32_t Version() const { return version; }
+
+    // ワールド座標のセル (範囲外なら false)
+    bool CellOf(const DirectX::XMFLOAT3& p, int& outX, int& outZ) const;
+    int Index(int x, int z) const { return z * width + x; }
+    bool InBounds(int x, int z) const { return x >= 0 && z >= 0 && x < width && z < height; }
+    // 範囲外は塞がっている扱い
+    bool IsBlocked(int x, int z) const { return !InBounds(x, z) || blocked[Index(x, z)] != 0; }
+    // セルから進める隣のビット (bit k = NEIGHBOR k 番へ進める)
+    // 斜めは角を削らないよう、両隣が空いている時だけ進める
+    uint8_t StepMask(int x, int z) const { return stepMask[Index(x, z)]; }
+    DirectX::XMFLOAT3 CellCenter(int x, int z, float y) const {
+        return { originX + (x + 0.5f) * cellSize, y, originZ + (z + 0.5f) * cellSize };
+    }
+
+    // セル a から b まで、塞がったセルを通らずにまっすぐ行けるか
+    // (線分が触れるセルを全部調べる。角をかすめる場合も塞がっている扱い)
+    bool LineOfSight(int ax, int az, int bx, int bz) const;
+
+private:
+    float cellSize = 1.0f;
+    float invCellSize = 1.0f;
+    float originX = 0.0f, originZ = 0.0f;   // セル(0,0)の左下
+    int width = 0, height = 0;
+    std::vector<uint8_t> blocked;
+    std::vector<uint8_t> stepMask;
+    uint32_t version = 0;
+};
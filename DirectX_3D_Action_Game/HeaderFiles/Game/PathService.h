@@ -0,0 +1,111 @@
+/*===================================================================
+// ファイル: PathService.h
+// 概要: NavGrid 上のA*経路探索（全ての敵で共有する）
+//       経路は (開始セル, 目標セル) をキーにキャッシュし、同じキーの依頼は使い回す。
+//       開始セルも目標セルも SHARE_CELLS 単位に丸めるので、近くから近くへ向かう敵同士は
+//       同じ経路を引ける (動いている敵も、丸めたセルを出るまでは同じキーのまま)。
+//       探索は1ステップあたりの展開数に上限があり、終わらなければ次のステップで続ける。
+//       見つかった経路は見通しの利く所を飛ばして、曲がり角だけの点列にしておく
+=====================================================================*/
+#pragma once
+#include "Game/NavGrid.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
+
+// 1ステップ分の集計 (デバッグ表示用)
+struct PathServiceStats {
+    uint32_t requests = 0;      // 依頼の数
+    uint32_t cacheHits = 0;     // キャッシュ (探索中を含む) で済んだ数
+    uint32_t completed = 0;     // 探索が終わった数
+    uint32_t expansions = 0;    // 展開したセルの数
+    uint32_t pending = 0;       // 探索待ち (ステップの終わり)
+    uint32_t cached = 0;        // キャッシュにある経路の数
+};
+
+class PathService {
+public:
+    enum class Status : uint8_t {
+        None,       // キャッシュにない
+        Pending,    // 探索待ち・探索中
+        Ready,      // 経路あり
+        Failed,     // たどり着けない
+    };
+
+    // 開始・目標セルをこのセル数の格子に丸める (近い依頼をまとめる)
+    static constexpr int SHARE_CELLS = 2;
+    // 丸めたセルが塞がっていたら、この範囲で空いているセルを探す
+    static constexpr int SNAP_SEARCH_RADIUS = 3;
+
+    uint32_t maxExpansionsPerStep = 4000;   // 1ステップに展開するセルの上限
+    uint32_t keepSteps = 300;               // これだけ使われなかった経路は捨てる
+
+    // ステップの最初に呼ぶ (グリッドが作り直されていればキャッシュを捨てる)
+    void BeginStep(const NavGrid& grid);
+    // 探索待ちの依頼を予算の範囲で進める
+    void Process();
+
+    // start から goal への経路のキーを求める (キャッシュには触らない)
+    // グリッドの外・目標の近くに空きセルがない時は 0
+    uint64_t KeyFor(const DirectX::XMFLOAT3& start, const DirectX::XMFLOAT3& goal) const;
+    // key の経路を頼む (キャッシュになければ探索待ちに並べる)
+    void Request(uint64_t key);
+    // key の経路をまだ使っている (捨てられないようにする)
+    void Touch(uint64_t key);
+    // key の経路が goal へ向かうもので、まだキャッシュに残っているか
+    bool IsCurrent(uint64_t key, const DirectX::XMFLOAT3& goal) const;
+    Status GetStatus(uint64_t key) const;
+
+    // key の経路に沿って、position から次に向かう向き (XZ平面の単位ベクトル) を求める
+    // waypoint: 呼び出し側が持つ「次の曲がり角」の番号 (進んだら更新する)
+    // 経路がまだない・たどり着けない・着いた時は false
+    // KeyFor・IsCurrent・GetStatus と同じくキャッシュを書き換えないので、
+    // Request・Touch・Process と重ならなければ複数のスレッドから呼んでよい
+    bool Steer(uint64_t key, const DirectX::XMFLOAT3& position, uint16_t& waypoint, DirectX::XMFLOAT3& outDir) const;
+
+    const PathServiceStats& GetStats() const { return stats; }
+
+private:
+    struct Path {
+        Status status = Status::Pending;
+        std::vector<uint32_t> corners;  // 曲がり角のセル番号 (最後が目標)
+        uint64_t lastUsed = 0;          // 最後に使われたステップ
+    };
+
+    static uint64_t MakeKey(uint32_t startIndex, uint32_t goalIndex) {
+        return ((uint64_t)(startIndex + 1) << 32) | (uint64_t)(goalIndex + 1);
+    }
+    static uint32_t StartOf(uint64_t key) { return (uint32_t)(key >> 32) - 1; }
+    static uint32_t GoalOf(uint64_t key) { return (uint32_t)key - 1; }
+
+    // position を共有用の格子に丸めたセル (空いていなければ近くを探す)
+    bool SnapCell(const DirectX::XMFLOAT3& position, uint32_t& outIndex) const;
+
+    // 探索中の依頼を展開数 budget まで進める (終わったら true)
+    bool StepSearch(uint32_t& budget);
+    void BeginSearch(uint64_t key);
+    void FinishSearch(bool found);
+    // 見通しの利く所を飛ばして曲がり角だけにする
+    void Smooth(const std::vector<uint32_t>& cells, std::vector<uint32_t>& outCorners) const;
+
+    const NavGrid* grid = nullptr;
+    uint32_t gridVersion = 0;
+    uint64_t step = 0;
+
+    std::unordered_map<uint64_t, Path> paths;
+    std::deque<uint64_t> queue;     // 探索待ちのキー (依頼された順)
+
+    // A* の作業用 (セルごと。stamp が今の探索番号の時だけ値が有効)
+    uint64_t searchKey = 0;         // 探索中のキー (0 なら探索していない)
+    uint32_t searchId = 0;
+    std::vector<uint32_t> stamp;
+    std::vector<uint32_t> gCost;
+    std::vector<uint32_t> parent;
+    std::vector<uint8_t> closed;
+    std::vector<uint64_t> open;     // (推定コスト, セル番号) のヒープ
+    std::vector<uint32_t> cellPath; // 経路の復元用
+
+    PathServiceStats stats;
+};
@@ -0,0 +1,46 @@
+/*===================================================================
+// ファイル: ProjectilePool.h
+// 概要: エンティティを作らない弾の置き場（SoA・容量固定）
+//       弾幕の弾は数が多く寿命が短いので、ECSのエンティティやメッシュは作らず
+//       ここに位置・速度・寿命だけを詰める。配列は最初に容量分だけ確保し、
+//       消えた弾は末尾と入れ替えて詰める (撃っても消してもメモリ確保は起きない)
+=====================================================================*/
+#pragma once
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+class ProjectilePool {
+public:
+    // 同時に存在できる弾の数 (超えた分は撃たれない)
+    static constexpr uint32_t CAPACITY = 4096;
+    // 当たり判定の半径
+    static constexpr float RADIUS = 0.3f;
+
+    ProjectilePool();
+
+    // 1発追加する (満杯なら false)
+    bool Spawn(const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT3& velocity, float lifeTime, int damage);
+    // 前の位置を残して進め、寿命を減らす
+    void Integrate(float dt);
+    // i 番目を消す印を付ける (RemoveDead でまとめて詰める)
+    void Kill(uint32_t i) { life[i] = 0.0f; }
+    bool IsAlive(uint32_t i) const { return life[i] > 0.0f; }
+    // 寿命の尽きた弾を詰める
+    void RemoveDead();
+    void Clear();
+
+    uint32_t Size() const { return (uint32_t)position.size(); }
+    // 満杯で撃てなかった数 (累計)
+    uint32_t GetDropped() const { return dropped; }
+
+    // SoA (番号は Size() 未満。RemoveDead で入れ替わる)
+    std::vector<DirectX::XMFLOAT3> position;
+    std::vector<DirectX::XMFLOAT3> prevPosition;  // 前のステップの位置 (掃引と描画の補間)
+    std::vector<DirectX::XMFLOAT3> velocity;
+    std::vector<float> life;
+    std::vector<int> damage;
+
+private:
+    uint32_t dropped = 0;
+};
@@ -0,0 +1,75 @@
+/*===================================================================
+// ファイル: SightService.h
+// 概要: 遠距離の敵から標的への見通し (壁に遮られていないか) を調べる
+//       依頼はステップの間に溜めて、Resolve で1回にまとめて
+//       PhysicsSystem の静的コライダーのグリッドに対して掃引する。
+//       結果は敵ごとに覚えておき、敵か標的が別のセルへ移るか、
+//       TTL が切れるか、壁の配置が変わるまで使い回す
+=====================================================================*/
+#pragma once
+#include "ECS/Component.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+class PhysicsSystem;
+class JobSystem;
+
+// 1ステップ分の集計 (デバッグ表示用)
+struct SightServiceStats {
+    uint32_t requests = 0;      // 依頼の数
+    uint32_t cacheHits = 0;     // 覚えていた結果で済んだ数
+    uint32_t rays = 0;          // 実際に飛ばしたレイの数
+    uint32_t blocked = 0;       // そのうち壁に遮られた数
+};
+
+class SightService {
+public:
+    // 結果を使い回す範囲 (目と標的がこの大きさのセルから出なければ同じ結果)
+    static constexpr float CELL_SIZE = 2.0f;
+    // レイの太さ (敵の弾より少し細くして、壁の角をかすめる程度は通す)
+    static constexpr float RAY_RADIUS = 0.05f;
+    // 一度に飛ばすレイのかたまり
+    static constexpr size_t RAY_GRAIN = 32;
+
+    uint32_t ttlSteps = 20;     // セルが変わらなくても、これだけ経ったら調べ直す
+
+    // ステップの最初に呼ぶ (staticVersion が変わっていれば全部忘れる)
+    void BeginStep(uint32_t staticVersion);
+    // id の敵の eye から target が見えるかを知りたい (覚えていなければレイを並べる)
+    void Request(EntityID id, const DirectX::XMFLOAT3& eye, const DirectX::XMFLOAT3& target);
+    // 並べたレイをまとめて飛ばす (jobs があればワーカーで分ける)
+    // physics がなければ遮るものはないので、全部見えている扱い
+    void Resolve(const PhysicsSystem* physics, JobSystem* jobs);
+    // 直近の結果 (このステップで Request していれば、Resolve の後は最新)
+    // 書き換えないので、Request・Resolve と重ならなければ複数のスレッドから呼んでよい
+    bool IsVisible(EntityID id) const { return id < entries.size() && entries[id].visible != 0; }
+
+    const SightServiceStats& GetStats() const { return stats; }
+
+private:
+    struct Entry {
+        uint64_t eyeCell = 0;
+        uint64_t targetCell = 0;
+        uint64_t expires = 0;       // このステップまで使える (0 なら結果なし)
+        uint8_t visible = 0;
+    };
+    struct Ray {
+        EntityID id;
+        DirectX::XMFLOAT3 eye;
+        DirectX::XMFLOAT3 target;
+        uint64_t eyeCell;
+        uint64_t targetCell;
+    };
+
+    static uint64_t CellKey(const DirectX::XMFLOAT3& p);
+
+    std::vector<Entry> entries;     // EntityID で引く
+    std::vector<Ray> rays;          // このステップで飛ばすレイ
+    std::vector<std::vector<uint32_t>> candidates;  // スレッドごとの検索用
+    std::vector<uint32_t> blockedCount;             // スレッドごとの集計
+    uint32_t staticVersion = 0;
+    uint64_t step = 0;
+
+    SightServiceStats stats;
+};
@@ -0,0 +1,37 @@
+/*===================================================================
+//t@C:InstancedVS.hlsl
+//Tv:CX^X`p̒_VF[_[ie̒e܂Ƃ߂ĕ`j
+//      _͒PʃbVAʒuƑ傫̓CX^XƂ̃f[^
+=====================================================================*/
+
+// 萔obt@iView * Projection sj
+cbuffer CBuf : register(b0)
+{
+    matrix transform;
+};
+
+// ̓f[^iXbg0: bV̒_ / Xbg1: CX^Xj
+struct VSIn
+{
+    float3 pos : POSITION;
+    float4 color : COLOR;
+    float4 instance : INSTANCE; // xyz: ʒu, w: 傫
+};
+
+// o̓f[^iSimplePS Ɠ`j
+struct VSOut
+{
+    float4 pos : SV_POSITION;
+    float4 color : COLOR;
+};
+
+VSOut main(VSIn input)
+{
+    VSOut output;
+
+    float3 worldPos = input.pos * input.instance.w + input.instance.xyz;
+    output.pos = mul(float4(worldPos, 1.0f), transform);
+    output.color = input.color;
+
+    return output;
+}
@@ -16,6 +16,7 @@ Game::Game() {
     instance = this;
     pSceneManager = std::make_unique<SceneManager>();
     pInput = std::make_unique<Input>();
+    pJobs = std::make_unique<JobSystem>(Config::JOB_THREADS);
 }
 
 Game::~Game() {
@@ -102,6 +103,7 @@ void Game::Draw() {
 
 void Game::Shutdown() {
     pSceneManager.reset();
+    pJobs.reset(); // V[(VXe)Ă烏[J[~߂
     pAudio.reset();
     pGraphics.reset();
 }
@@ -15,6 +15,8 @@
 #include "ECS/Components/RecoverySphereComponent.h"
 #include "ECS/Components/StatusComponent.h"
 #include "ECS/Components/BulletComponent.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "ECS/World.h"
 #include "Game/EntityFactory.h"
 #include "App/Game.h"
 #include <DirectXMath.h>
@@ -77,9 +79,7 @@ void ActionSystem::Update(float dt) {
 
     // vC[āA񕜃X|bgꍇ
     if (playerID != ECSConfig::INVALID_ID) {
-        auto& pTrans = registry->GetComponent<TransformComponent>(playerID);
-
-        // SGeBeB񕜃X|bgT
+        // ڂ̍XV (S񕜃X|bg)
         for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
             if (!registry->HasComponent<RecoverySphereComponent>(id)) continue;
 
@@ -97,37 +97,42 @@ void ActionSystem::Update(float dt) {
             // o: NN
             sphere.rotationAngle += 2.0f * dt;
             sTrans.rotation.y = sphere.rotationAngle;
+        }
 
-            //  (XZ)
-            float dx = pTrans.position.x - sTrans.position.x;
-            float dz = pTrans.position.z - sTrans.position.z;
-            float distSq = dx * dx + dz * dz;
-            float hitR = 1.0f + sphere.radius;
+        // C: ͈͓ǂ͕̃gK[CxgŎ󂯎
+        // (PhysicsSystem ÕXebvŋ߂ Enter/StayBXZʂ̋ < 1.0 + a)
+        PhysicsSystem* physics = pWorld->GetSystem<PhysicsSystem>();
+        const std::vector<TriggerEvent> noEvents;
+        for (const TriggerEvent& ev : physics ? physics->GetTriggerEvents() : noEvents) {
+            if (ev.phase == TriggerPhase::Exit) continue;
+            if (ev.otherID != playerID) continue; // 쒆̃L񕜂
+            if (!registry->HasComponent<RecoverySphereComponent>(ev.triggerID)) continue;
 
-            if (distSq < hitR * hitR) {
-                // ͈͓ɂ
-                if (registry->HasComponent<StatusComponent>(playerID)) {
-                    auto& status = registry->GetComponent<StatusComponent>(playerID);
+            auto& sphere = registry->GetComponent<RecoverySphereComponent>(ev.triggerID);
+            if (!sphere.isActive || sphere.capacity <= 0) continue;
 
-                    // uHPĂvu^NɎcʂvȂ
-                    if (status.hp < status.maxHp && sphere.capacity > 0) {
+            // ͈͓ɂ
+            if (registry->HasComponent<StatusComponent>(playerID)) {
+                auto& status = registry->GetComponent<StatusComponent>(playerID);
 
-                        // 1t[̉񕜗 (dtˑɂŒlŏ)
-                        int healRate = 1;
+                // uHPĂvu^NɎcʂvȂ
+                if (status.hp < status.maxHp && sphere.capacity > 0) {
 
-                        // cʃ`FbN
-                        if (sphere.capacity < healRate) healRate = sphere.capacity;
+                    // 1t[̉񕜗 (dtˑɂŒlŏ)
+                    int healRate = 1;
 
-                        // 񕜎s
-                        status.hp += healRate;
-                        if (status.hp > status.maxHp) status.hp = status.maxHp;
+                    // cʃ`FbN
+                    if (sphere.capacity < healRate) healRate = sphere.capacity;
 
-                        // ^N
-                        sphere.capacity -= healRate;
+                    // 񕜎s
+                    status.hp += healRate;
+                    if (status.hp > status.maxHp) status.hp = status.maxHp;
 
-                        // 񕜃GtFNg (AĐȂ悤ɐ䂪KvȈՓI)
-                        // if (Game::GetInstance()->GetAudio()) Game::GetInstance()->GetAudio()->Play("SE_HEAL");
-                    }
+                    // ^N
+                    sphere.capacity -= healRate;
+
+                    // 񕜃GtFNg (AĐȂ悤ɐ䂪KvȈՓI)
+                    // if (Game::GetInstance()->GetAudio()) Game::GetInstance()->GetAudio()->Play("SE_HEAL");
                 }
             }
 
@@ -80,8 +80,10 @@ void CameraSystem::Update(float dt) {
             // ---------------------------------------------------------
             // 5. svZ (Ǐ])
             // ---------------------------------------------------------
+            // C: ŒXebvԂԂʒuǂ (`Ƒ)
             auto& targetTrans = registry->GetComponent<TransformComponent>(camera.targetEntityID);
-            XMVECTOR targetPos = XMVectorSet(targetTrans.position.x, targetTrans.position.y, targetTrans.position.z, 0.0f);
+            XMFLOAT3 targetRenderPos = targetTrans.InterpolatedPosition(pWorld->GetInterpolationAlpha());
+            XMVECTOR targetPos = XMVectorSet(targetRenderPos.x, targetRenderPos.y, targetRenderPos.z, 0.0f);
 
             // _
             XMVECTOR focus = targetPos + XMVectorSet(0.0f, camera.lookAtOffset, 0.0f, 0.0f);
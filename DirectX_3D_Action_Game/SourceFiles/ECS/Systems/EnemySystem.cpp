@@ -6,30 +6,91 @@
 #include "ECS/Systems/EnemySystem.h"
 #include "ECS/World.h"
 #include "ECS/Components/TransformComponent.h"
-#include "ECS/Components/PlayerComponent.h"
 #include "ECS/Components/EnemyComponent.h"
 #include "ECS/Components/StatusComponent.h"
 #include "ECS/Components/PhysicsComponent.h"
+#include "ECS/Components/PatternEmitterComponent.h"
+#include "ECS/Systems/PhysicsSystem.h"
 #include "Game/EntityFactory.h"
+#include "Engine/JobSystem.h"
 #include "App/Main.h"
 #include <DirectXMath.h>
 #include <vector>
 #include <cmath>
-#include <limits>
 #include <algorithm>
 
 using namespace DirectX;
 
-float DistSq(const XMFLOAT3& a, const XMFLOAT3& b) {
-    float dx = a.x - b.x;
-    float dz = a.z - b.z;
-    return dx * dx + dz * dz;
+// ʍsObh̐ݒ (GameScene ̏ubN͏ʂ y=-0.5)
+static const NavGrid::Settings NAV_SETTINGS = {
+    .cellSize = 1.0f,
+    .agentRadius = 0.5f,
+    .walkY = -0.5f,
+    .stepHeight = 0.3f,
+    .agentHeight = 2.0f,
+};
+
+void EnemySystem::Init(World* world) {
+    System::Init(world);
+    // [J[GameĂ (ȂΑSCXbhŏ)
+    pJobs = Game::GetInstance() ? Game::GetInstance()->GetJobSystem() : nullptr;
+    commands.resize(pJobs ? pJobs->GetThreadCount() : 1);
+    thinkScratch.resize(commands.size());
+    slotOf.assign(ECSConfig::MAX_ENTITIES, NO_SLOT);
+}
+
+// GGvlŏ (̏1񂸂BStun ͏W߂鎞ɏ)
+static constexpr EnemyState MINION_STATES[] = {
+    EnemyState::Chase, EnemyState::Strafing, EnemyState::Retreat, EnemyState::Attack, EnemyState::Cooldown,
+};
+// {X̏ (̏1񂸂)
+static constexpr EnemyState BOSS_STATES[] = {
+    EnemyState::BossIdle, EnemyState::BossRingBarrage, EnemyState::BossRapidFire, EnemyState::BossBitLaser,
+};
+
+static bool IsBossState(EnemyState state) {
+    for (EnemyState s : BOSS_STATES) {
+        if (s == state) return true;
+    }
+    return false;
+}
+
+template<class Func>
+void EnemySystem::RunParallel(size_t count, size_t grain, Func&& func) {
+    if (pJobs) pJobs->ParallelFor(count, grain, func);
+    else if (count > 0) func(size_t(0), count, 0u);
 }
 
 void EnemySystem::Update(float dt) {
     timeAccumulator += dt;
     auto registry = pWorld->GetRegistry();
 
+    // ---------------------------------------------------------
+    // ĂG̈ʒuԃnbVɂ܂Ƃ߂
+    // (GƂɑSID𒲂גA߂̃Z)
+    // ---------------------------------------------------------
+    enemyHash.Clear();
+    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+        if (!registry->HasComponent<EnemyComponent>(id)) continue;
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+        if (registry->HasComponent<StatusComponent>(id) && registry->GetComponent<StatusComponent>(id).hp <= 0) continue;
+        enemyHash.Add(id, registry->GetComponent<TransformComponent>(id).position);
+    }
+    enemyHash.Build(SEPARATION_RADIUS);
+
+    // _vC[W߂ (GƂɑSID𒲂גȂ)
+    perception.Update(registry);
+
+    UpdateNavigation();
+    sightService.BeginStep(navStaticVersion);
+
+    scheduler.BeginStep(registry);
+    for (const MinionSlot& m : minions) slotOf[m.id] = NO_SLOT;
+    for (const BossSlot& b : bosses) slotOf[b.id] = NO_SLOT;
+    minions.clear();
+    bosses.clear();
+    stateBuckets.BeginStep();
+
     for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
         if (!registry->HasComponent<EnemyComponent>(id)) continue;
         if (!registry->HasComponent<TransformComponent>(id)) continue;
@@ -41,6 +102,11 @@ void EnemySystem::Update(float dt) {
         auto& enemy = registry->GetComponent<EnemyComponent>(id);
         auto& trans = registry->GetComponent<TransformComponent>(id);
 
+        // VoGɂ͗U (ID͎g񂳂̂Œʂԍ)
+        if (!enemy.rng.IsSeeded()) {
+            enemy.rng = pWorld->MakeRandom(RandomStream::Enemy, ++rngSerial);
+        }
+
         // 0. mbNobNEX^
         if (enemy.knockbackTimer > 0.0f) {
             enemy.knockbackTimer -= dt;
@@ -52,349 +118,688 @@ void EnemySystem::Update(float dt) {
                     phy.velocity.z *= 0.9f;
                 }
             }
+            enemy.moveSpeedNow = 0.0f;
+            stateBuckets.Set(id, enemy.state);
             continue;
         }
         else if (enemy.state == EnemyState::Stun) {
             enemy.state = (enemy.type == EnemyType::Boss) ? EnemyState::BossIdle : EnemyState::Chase;
         }
+        // {X͕K{Xp̏ԂɂĂ (o Chase ̂܂)
+        if (enemy.type == EnemyType::Boss && !IsBossState(enemy.state)) enemy.state = EnemyState::BossIdle;
+        stateBuckets.Set(id, enemy.state);
 
         // 1. ^[Qbg
-        EntityID targetID = ECSConfig::INVALID_ID;
-        float minDistSq = std::numeric_limits<float>::max();
-        XMVECTOR enemyPos = XMLoadFloat3(&trans.position);
-
-        for (EntityID pID = 0; pID < ECSConfig::MAX_ENTITIES; ++pID) {
-            if (!registry->HasComponent<PlayerComponent>(pID)) continue;
-            auto& pStat = registry->GetComponent<StatusComponent>(pID);
-            auto& pComp = registry->GetComponent<PlayerComponent>(pID);
-
-            if (pStat.hp > 0 && pComp.isActive) {
-                auto& pTrans = registry->GetComponent<TransformComponent>(pID);
-                float d = DistSq(trans.position, pTrans.position);
-                if (d < minDistSq) {
-                    minDistSq = d;
-                    targetID = pID;
-                }
-            }
-        }
+        float minDistSq = 0.0f;
+        const int targetIndex = perception.FindNearest(trans.position, &minDistSq);
+        const float distToTarget = (targetIndex >= 0) ? std::sqrt(minDistSq) : 0.0f;
 
-        if (targetID == ECSConfig::INVALID_ID && enemy.type != EnemyType::Boss) return;
-
-        // ϐ𓝈 (distToTarget, targetPosVec)
-        float distToTarget = 0.0f;
-        XMVECTOR targetPosVec = enemyPos; // Ȃꍇ͎̈ʒu
-        XMFLOAT3 targetPosF = trans.position;
+        // {X͎GGƕāAWߏIĂ珈 (WIȂłe𑱂)
+        if (enemy.type == EnemyType::Boss) {
+            slotOf[id] = (uint32_t)bosses.size();
+            bosses.push_back({ id, targetIndex });
+            continue;
+        }
 
-        if (targetID != ECSConfig::INVALID_ID) {
-            auto& targetTrans = registry->GetComponent<TransformComponent>(targetID);
-            targetPosVec = XMLoadFloat3(&targetTrans.position);
-            targetPosF = targetTrans.position;
-            distToTarget = std::sqrt(minDistSq);
+        // WIȂG͉Ȃ
+        if (targetIndex < 0) {
+            enemy.moveSpeedNow = 0.0f;
+            continue;
         }
 
         // ---------------------------------------------------------
-        // {XpAI
+        // GG: vl̓XPW[ɉ (߂G͖XebvAG͊Ԉ)
         // ---------------------------------------------------------
-        if (enemy.type == EnemyType::Boss) {
-            enemy.attackCooldownTimer -= dt;
+        enemy.aiElapsed += dt;
+        enemy.aiLod = scheduler.Classify(trans.position, distToTarget);
+        int attackPower = 10;
+        if (registry->HasComponent<StatusComponent>(id)) {
+            attackPower = registry->GetComponent<StatusComponent>(id).attackPower;
+        }
+        const uint32_t slot = (uint32_t)minions.size();
+        slotOf[id] = slot;
+        minions.push_back({ id, &enemy, &trans, attackPower, targetIndex, distToTarget });
+        scheduler.Submit(slot, id, enemy.aiLod, enemy.aiElapsed, dt);
+        influenceMap.AddAgent(trans.position);
+
+        // Ă鋗ɂ鉓̓ǴAWIĂ邩𒲂ׂĂ炤
+        if (enemy.isRanged && distToTarget < RANGED_FIRE_RANGE) {
+            XMFLOAT3 eye = trans.position;
+            eye.y += MUZZLE_HEIGHT;
+            XMFLOAT3 core = perception.GetTarget(targetIndex).position;
+            core.y += TARGET_CORE_HEIGHT;
+            sightService.Request(id, eye, core);
+        }
+    }
 
-            if (registry->HasComponent<StatusComponent>(id)) {
-                auto& st = registry->GetComponent<StatusComponent>(id);
-                if (st.hp < st.maxHp / 2) enemy.bossPhase = 2;
-            }
+    // |ꂽEꂽGԂ̗񂩂甲
+    stateBuckets.RemoveUnseen();
+
+    // ʂ̃C͎vl̑OɑS܂Ƃ߂Ĕ΂ (oĂ錋ʂ̓C΂Ȃ)
+    sightService.Resolve(pWorld->GetSystem<PhysicsSystem>(), pJobs);
+    // e}bv͌܂̃}X (G̐ɂ炸)
+    influenceMap.Refresh();
+
+    // ---------------------------------------------------------
+    // {XpAI (ʂ̏̌A{X̏Ԃ̗񂲂Ƃ1񂸂)
+    // ---------------------------------------------------------
+    UpdateBosses(dt);
+
+    // ---------------------------------------------------------
+    // Ԃ̗GGvl (\Z𒴂͎̃Xebv)
+    // vl̓[J[ŕɍsAeU̐͌ł܂Ƃ߂čs
+    // ---------------------------------------------------------
+    scheduler.Run([&](const uint32_t* slots, size_t count) {
+        ThinkBatch(slots, count);
+    });
+    ThinkStates();
+    ApplyCommands();
+
+    // vlɗ܂ꂽoH\Z͈̔͂ŒT (̎vlŎg)
+    pathService.Process();
+
+    // ---------------------------------------------------------
+    // SĂ̎GGAvlŌ߂Ƒœ
+    // ---------------------------------------------------------
+    MoveMinions(dt);
+}
 
-            if (enemy.state != EnemyState::BossIdle &&
-                enemy.state != EnemyState::BossRingBarrage &&
-                enemy.state != EnemyState::BossBitLaser &&
-                enemy.state != EnemyState::BossRapidFire)
-            {
-                enemy.state = EnemyState::BossIdle;
-            }
+void EnemySystem::UpdateNavigation() {
+    // ǂ̔zuςʍsObh蒼 (Xe[W̓ǂݍݒȂ)
+    if (auto* physics = pWorld->GetSystem<PhysicsSystem>()) {
+        if (physics->GetStaticVersion() != navStaticVersion) {
+            navStaticVersion = physics->GetStaticVersion();
+            navGrid.Build(physics->GetStaticBoxes(), NAV_SETTINGS);
+        }
+    }
+    pathService.BeginStep(navGrid);
 
-            if (enemy.state == EnemyState::BossIdle) {
-                if (enemy.attackCooldownTimer <= 0.0f) {
-                    int pattern = rand() % 100;
-                    if (enemy.bossPhase == 1) {
-                        if (pattern < 60) {
-                            enemy.state = EnemyState::BossRingBarrage;
-                            enemy.attackTimer = 3.0f;
-                        }
-                        else {
-                            enemy.state = EnemyState::BossRapidFire;
-                            enemy.attackTimer = 2.0f;
-                        }
-                    }
-                    else {
-                        if (pattern < 30) {
-                            enemy.state = EnemyState::BossRingBarrage;
-                            enemy.attackTimer = 3.0f;
-                        }
-                        else if (pattern < 60) {
-                            enemy.state = EnemyState::BossRapidFire;
-                            enemy.attackTimer = 1.5f;
-                        }
-                        else {
-                            enemy.state = EnemyState::BossBitLaser;
-                            enemy.attackTimer = 2.0f;
-                        }
-                    }
-                    enemy.stateTimer = 0.0f;
-                }
-            }
-            else if (enemy.state == EnemyState::BossRingBarrage) {
-                enemy.attackTimer -= dt;
-                trans.rotation.y += dt * 2.0f;
-                enemy.stateTimer += dt;
-
-                if (enemy.stateTimer > 0.1f) {
-                    enemy.stateTimer = 0.0f;
-                    XMFLOAT3 spawnPos = trans.position;
-                    spawnPos.y += 1.0f;
-
-                    float dirY = 0.0f;
-                    if (targetID != ECSConfig::INVALID_ID) {
-                        float targetY = targetPosF.y + 0.5f;
-                        float dy = targetY - spawnPos.y;
-                        // std::max ̃G[: (std::max)(...)
-                        float hDist = (std::max)(distToTarget, 0.1f);
-                        dirY = dy / hDist;
-                    }
-                    else {
-                        dirY = -0.2f;
-                    }
+    // e}bv̋Ђ̌͑_WIS (݋͓GW߂鎞ɑ)
+    influenceMap.BeginStep(navGrid);
+    for (const PerceivedTarget& t : perception.GetTargets()) {
+        if (AIPerception::IsTargetable(t)) influenceMap.AddThreat(t.position, t.yaw);
+    }
 
-                    for (int i = 0; i < 4; ++i) {
-                        float angle = trans.rotation.y + (XM_PIDIV2 * i);
-                        XMVECTOR vDir = XMVectorSet(sinf(angle), dirY, cosf(angle), 0.0f);
-                        vDir = XMVector3Normalize(vDir);
-                        XMFLOAT3 dir;
-                        XMStoreFloat3(&dir, vDir);
-                        EntityFactory::CreateEnemyBullet(pWorld, spawnPos, dir, 20);
-                    }
-                }
-                if (enemy.attackTimer <= 0.0f) {
-                    enemy.state = EnemyState::BossIdle;
-                    enemy.attackCooldownTimer = (enemy.bossPhase == 2) ? 2.0f : 4.0f;
-                }
-            }
-            else if (enemy.state == EnemyState::BossRapidFire) {
-                enemy.attackTimer -= dt;
-                enemy.stateTimer += dt;
-
-                if (targetID != ECSConfig::INVALID_ID) {
-                    XMVECTOR dir = XMVector3Normalize(targetPosVec - enemyPos);
-                    float angle = atan2f(XMVectorGetX(dir), XMVectorGetZ(dir));
-                    float diff = angle - trans.rotation.y;
-                    while (diff > XM_PI) diff -= XM_2PI;
-                    while (diff < -XM_PI) diff += XM_2PI;
-                    trans.rotation.y += diff * 5.0f * dt;
-                }
+    // 1SŎĝŁAŏ̑_WI֌č
+    // (WIZɂԂ͍蒼Ȃ)
+    flowTargetIndex = -1;
+    if (!navGrid.IsValid()) return;
+    const auto& targets = perception.GetTargets();
+    for (size_t i = 0; i < targets.size(); ++i) {
+        if (!AIPerception::IsTargetable(targets[i])) continue;
+        flowTargetIndex = (int)i;
+        flowField.Update(navGrid, targets[i].position);
+        break;
+    }
+}
 
-                float interval = (enemy.bossPhase == 2) ? 0.3f : 0.5f;
-                if (enemy.stateTimer > interval) {
-                    enemy.stateTimer = 0.0f;
-                    if (targetID != ECSConfig::INVALID_ID) {
-                        XMVECTOR pCore = XMLoadFloat3(&targetPosF);
-                        pCore = XMVectorAdd(pCore, XMVectorSet(0, 0.5f, 0, 0));
-                        XMFLOAT3 spawnPos = trans.position;
-                        spawnPos.y += 1.0f;
-                        XMVECTOR start = XMLoadFloat3(&spawnPos);
-                        XMVECTOR dirV = XMVector3Normalize(pCore - start);
-                        XMFLOAT3 dir;
-                        XMStoreFloat3(&dir, dirV);
-                        EntityFactory::CreateEnemyBullet(pWorld, spawnPos, dir, 30);
-                    }
-                }
-                if (enemy.attackTimer <= 0.0f) {
-                    enemy.state = EnemyState::BossIdle;
-                    enemy.attackCooldownTimer = 3.0f;
-                }
+// -----------------------------------------------------------------------
+// GG̕vl
+// -----------------------------------------------------------------------
+// 1. Ԃ̗G̏Ԃ̐؂ւƉU (DecideMinion) ɍsA
+//    ԂςGԂ̗ڂ (ThinkBatchBscheduler ̂܂Ƃ܂育)
+// 2. Ŝ܂Ƃ܂肪IAԂ̗񂲂Ƃɐp̃[vňړ߂
+//    (ThinkStatesBGƂɏԂŕ򂵂Ȃ)
+// vlɓǂނ (ԃnbVEWIEEoH̃LbV) ͂̊ԕς炸A
+// ̂͂̓Gg̃R|[lgBWorld ς鏈̓XbhƂ̗ɐς
+void EnemySystem::ThinkBatch(const uint32_t* slots, size_t count) {
+    RunParallel(count, THINK_GRAIN, [&](size_t begin, size_t end, unsigned thread) {
+        std::vector<EnemyCommand>& out = commands[thread];
+        for (size_t i = begin; i < end; ++i) {
+            MinionSlot& m = minions[slots[i]];
+            m.thinkDt = m.enemy->aiElapsed;
+            m.enemy->aiElapsed = 0.0f;
+            m.thinking = true;
+            DecideMinion(m, out);
+        }
+    });
+
+    // Ԃ̗͕̏ɂ͐GȂ (ςG͂ł܂Ƃ߂Ĉڂ)
+    for (size_t i = 0; i < count; ++i) {
+        const MinionSlot& m = minions[slots[i]];
+        stateBuckets.Set(m.id, m.enemy->state);
+    }
+}
+
+// Ԃ̗񂲂ƂɁÃXebvŔԂ̗Gp̃[vŏ
+// ɏԂςĂ͂̂܂ (Xebv2̏Ԃ̏󂯂Ȃ)
+void EnemySystem::ThinkStates() {
+    for (EnemyState state : MINION_STATES) {
+        const std::vector<EntityID>& ids = stateBuckets.Get(state);
+        RunParallel(ids.size(), STATE_GRAIN, [&](size_t begin, size_t end, unsigned thread) {
+            // ܂̒́AԂ̗Gl߂
+            ThinkScratch& scratch = thinkScratch[thread];
+            scratch.slots.clear();
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t slot = slotOf[ids[i]];
+                if (slot != NO_SLOT && minions[slot].thinking) scratch.slots.push_back(slot);
             }
-            else if (enemy.state == EnemyState::BossBitLaser) {
-                enemy.attackTimer -= dt;
-                enemy.stateTimer += dt;
-
-                if (enemy.stateTimer > 0.2f && targetID != ECSConfig::INVALID_ID) {
-                    enemy.stateTimer = 0.0f;
-                    XMVECTOR pCore = XMLoadFloat3(&targetPosF);
-                    pCore = XMVectorAdd(pCore, XMVectorSet(0, 0.5f, 0, 0));
-                    for (int i = 0; i < 4; ++i) {
-                        float angle = (XM_2PI / 4.0f) * i + (timeAccumulator * 2.0f);
-                        float r = 5.0f;
-                        XMFLOAT3 bitPos = trans.position;
-                        bitPos.x += cosf(angle) * r;
-                        bitPos.z += sinf(angle) * r;
-                        bitPos.y += 2.0f;
-                        XMVECTOR start = XMLoadFloat3(&bitPos);
-                        XMVECTOR dirV = XMVector3Normalize(pCore - start);
-                        XMFLOAT3 dir;
-                        XMStoreFloat3(&dir, dirV);
-                        EntityFactory::CreateEnemyBullet(pWorld, bitPos, dir, 15);
-                    }
-                }
-                if (enemy.attackTimer <= 0.0f) {
-                    enemy.state = EnemyState::BossIdle;
-                    enemy.attackCooldownTimer = 3.0f;
-                }
+            if (scratch.slots.empty()) return;
+
+            const uint32_t* slots = scratch.slots.data();
+            const size_t count = scratch.slots.size();
+            std::vector<EnemyCommand>& out = commands[thread];
+            switch (state) {
+            case EnemyState::Chase:    ThinkChase(slots, count, scratch, out); break;
+            case EnemyState::Strafing: ThinkStrafing(slots, count, out); break;
+            case EnemyState::Retreat:  ThinkRetreat(slots, count, out); break;
+            case EnemyState::Attack:   ThinkAttack(slots, count); break;
+            case EnemyState::Cooldown: ThinkCooldown(slots, count); break;
+            default: break;
             }
-            continue;
-        }
+        });
+    }
 
-        // ---------------------------------------------------------
-        // 2. GG̎vl
-        // ---------------------------------------------------------
-        enemy.thinkInterval -= dt;
-        if (enemy.thinkInterval <= 0.0f && enemy.state != EnemyState::Attack && enemy.state != EnemyState::Cooldown) {
-            enemy.thinkInterval = 0.5f + (rand() % 50) / 100.0f;
+    // ɏԂςGɈڂ
+    for (const MinionSlot& m : minions) {
+        if (m.thinking) stateBuckets.Set(m.id, m.enemy->state);
+    }
+}
 
-            if (enemy.isImmovable) {
-                enemy.state = EnemyState::Chase;
+// ς܂ꂽs
+// ǂ̃XbhNvl͎sƂɕς̂ŁAGIDɕגĂs
+// (GeBeBIDoHT̏Ԃ񓯂ɂȂ悤)
+void EnemySystem::ApplyCommands() {
+    applyList.clear();
+    for (auto& list : commands) {
+        applyList.insert(applyList.end(), list.begin(), list.end());
+        list.clear();
+    }
+    if (applyList.empty()) return;
+    std::sort(applyList.begin(), applyList.end(), [](const EnemyCommand& a, const EnemyCommand& b) {
+        if (a.id != b.id) return a.id < b.id;
+        return a.type < b.type;
+        });
+
+    for (const EnemyCommand& c : applyList) {
+        switch (c.type) {
+        case EnemyCommand::Type::FireBullet:
+            EntityFactory::CreateEnemyBullet(pWorld, c.position, c.direction, c.damage);
+            break;
+        case EnemyCommand::Type::MeleeAttack:
+            EntityFactory::CreateAttackSphere(pWorld, c.id, c.position, c.damage);
+            break;
+        case EnemyCommand::Type::RequestPath:
+            pathService.Request(c.pathKey);
+            break;
+        case EnemyCommand::Type::TouchPath:
+            pathService.Touch(c.pathKey);
+            break;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------
+// {X̎vl (ep^[̑IƁAp^[̌)
+// -----------------------------------------------------------------------
+// {X͐ȂdȂ̂ŁAGGƂ͕ʂɃCXbhōsB
+// e͔ˑu (PatternEmitterComponent) Bł̓p^[̎n߂ƏI肾
+void EnemySystem::UpdateBosses(float dt) {
+    for (BossSlot& b : bosses) PrepareBoss(b, dt);
+
+    // ɏԂςĂ͂̂܂ (Xebv2̏Ԃ̏󂯂Ȃ)
+    for (EnemyState state : BOSS_STATES) {
+        for (EntityID id : stateBuckets.Get(state)) {
+            if (slotOf[id] == NO_SLOT) continue;
+            BossSlot& b = bosses[slotOf[id]];
+            switch (state) {
+            case EnemyState::BossIdle:        ThinkBossIdle(b); break;
+            case EnemyState::BossRingBarrage: ThinkBossRingBarrage(b, dt); break;
+            case EnemyState::BossRapidFire:   ThinkBossRapidFire(b, dt); break;
+            case EnemyState::BossBitLaser:    ThinkBossBitLaser(b); break;
+            default: break;
             }
-            else if (enemy.isRanged) {
-                if (distToTarget < 8.0f) enemy.state = EnemyState::Retreat;
-                else if (distToTarget > enemy.optimalRange + 5.0f) enemy.state = EnemyState::Chase;
-                else {
-                    if (rand() % 100 < 40) {
-                        enemy.state = EnemyState::Strafing;
-                        enemy.strafeDirection = (rand() % 2 == 0) ? 1.0f : -1.0f;
-                        enemy.stateTimer = 1.0f;
+        }
+    }
+
+    for (const BossSlot& b : bosses) stateBuckets.Set(b.id, b.enemy->state);
+}
+
+// ǂ̏Ԃłs (N[_EEtF[YEˑuƕWI)
+void EnemySystem::PrepareBoss(BossSlot& b, float dt) {
+    auto registry = pWorld->GetRegistry();
+    const EntityID id = b.id;
+    b.enemy = &registry->GetComponent<EnemyComponent>(id);
+    b.trans = &registry->GetComponent<TransformComponent>(id);
+    auto& enemy = *b.enemy;
+
+    b.targetID = (b.targetIndex >= 0) ? perception.GetTarget(b.targetIndex).id : ECSConfig::INVALID_ID;
+    b.targetPos = b.trans->position;   // Ȃꍇ͎̈ʒu
+    if (b.targetID != ECSConfig::INVALID_ID) b.targetPos = perception.GetTarget(b.targetIndex).position;
+
+    enemy.attackCooldownTimer -= dt;
+
+    if (registry->HasComponent<StatusComponent>(id)) {
+        auto& st = registry->GetComponent<StatusComponent>(id);
+        if (st.hp < st.maxHp / 2) enemy.bossPhase = 2;
+    }
+
+    if (!registry->HasComponent<PatternEmitterComponent>(id)) {
+        pWorld->AddComponent<PatternEmitterComponent>(id);
+    }
+    b.emitter = &registry->GetComponent<PatternEmitterComponent>(id);
+    b.emitter->hasTarget = (b.targetID != ECSConfig::INVALID_ID);
+    if (b.emitter->hasTarget) b.emitter->target = b.targetPos;
+}
+
+// ҋ@: N[_EAtF[Yɉăp^[IŌn߂
+void EnemySystem::ThinkBossIdle(BossSlot& b) {
+    auto& enemy = *b.enemy;
+    if (enemy.attackCooldownTimer > 0.0f) return;
+
+    BulletPatternID pattern;
+    int roll = (int)enemy.rng.UInt(100);
+    if (enemy.bossPhase == 1) {
+        if (roll < 60) {
+            enemy.state = EnemyState::BossRingBarrage;
+            pattern = BulletPatternID::RingBarrage;
+        }
+        else {
+            enemy.state = EnemyState::BossRapidFire;
+            pattern = BulletPatternID::RapidFire;
+        }
+    }
+    else {
+        if (roll < 30) {
+            enemy.state = EnemyState::BossRingBarrage;
+            pattern = BulletPatternID::RingBarrage;
+        }
+        else if (roll < 60) {
+            enemy.state = EnemyState::BossRapidFire;
+            pattern = BulletPatternID::RapidFireP2;
+        }
+        else {
+            enemy.state = EnemyState::BossBitLaser;
+            pattern = BulletPatternID::BitLaser;
+        }
+    }
+    // O̓{X̌Arbg͎̈ʒu猂n߂
+    b.emitter->Start(pattern, b.trans->rotation.y, timeAccumulator * GetBulletPattern(pattern).emitterSpin);
+}
+
+// Sʒe: ẽOƈꏏɉ
+void EnemySystem::ThinkBossRingBarrage(BossSlot& b, float dt) {
+    auto& enemy = *b.enemy;
+    b.trans->rotation.y += dt * 2.0f;
+    if (!b.emitter->active) {
+        enemy.state = EnemyState::BossIdle;
+        enemy.attackCooldownTimer = (enemy.bossPhase == 2) ? 2.0f : 4.0f;
+    }
+}
+
+// _: WI̕֌񂹂
+void EnemySystem::ThinkBossRapidFire(BossSlot& b, float dt) {
+    auto& enemy = *b.enemy;
+    auto& trans = *b.trans;
+    if (b.targetID != ECSConfig::INVALID_ID) {
+        XMVECTOR dir = XMVector3Normalize(XMLoadFloat3(&b.targetPos) - XMLoadFloat3(&trans.position));
+        float angle = atan2f(XMVectorGetX(dir), XMVectorGetZ(dir));
+        float diff = angle - trans.rotation.y;
+        while (diff > XM_PI) diff -= XM_2PI;
+        while (diff < -XM_PI) diff += XM_2PI;
+        trans.rotation.y += diff * 5.0f * dt;
+    }
+    if (!b.emitter->active) {
+        enemy.state = EnemyState::BossIdle;
+        enemy.attackCooldownTimer = 3.0f;
+    }
+}
+
+// rbgĎˌ: Î҂
+void EnemySystem::ThinkBossBitLaser(BossSlot& b) {
+    auto& enemy = *b.enemy;
+    if (!b.emitter->active) {
+        enemy.state = EnemyState::BossIdle;
+        enemy.attackCooldownTimer = 3.0f;
+    }
+}
+
+// GG̏Ԃ̐؂ւƉU
+// ړ͂̌A܂Ԃ̗ł܂Ƃ߂Č߂ (ThinkStates)
+void EnemySystem::DecideMinion(const MinionSlot& m, std::vector<EnemyCommand>& out) {
+    const EntityID id = m.id;
+    auto& enemy = *m.enemy;
+    auto& trans = *m.trans;
+    const float thinkDt = m.thinkDt;
+    const float distToTarget = m.distToTarget;
+    const XMFLOAT3 targetPosF = perception.GetTarget(m.targetIndex).position;
+
+    // ---------------------------------------------------------
+    // 2. GG̎vl
+    // ---------------------------------------------------------
+    enemy.thinkInterval -= thinkDt;
+    if (enemy.thinkInterval <= 0.0f && enemy.state != EnemyState::Attack && enemy.state != EnemyState::Cooldown) {
+        enemy.thinkInterval = enemy.rng.Float(0.5f, 1.0f);
+
+        if (enemy.isImmovable) {
+            enemy.state = EnemyState::Chase;
+        }
+        else if (enemy.isRanged) {
+            enemy.hasTacticalGoal = false;
+            XMFLOAT3 goal;
+            if (distToTarget > enemy.optimalRange + 5.0f) enemy.state = EnemyState::Chase;
+            else if (influenceMap.IsValid()) {
+                // C: 틗ł́Ae}bvŊȂȂłȂǍۂ̃}XI
+                if (influenceMap.FindPosition(trans.position, targetPosF, enemy.optimalRange, goal)) {
+                    enemy.tacticalGoal = goal;
+                    enemy.hasTacticalGoal = true;
+                    const float gx = goal.x - targetPosF.x, gz = goal.z - targetPosF.z;
+                    if (std::sqrt(gx * gx + gz * gz) > distToTarget + 1.0f) {
+                        enemy.state = EnemyState::Retreat;
                     }
                     else {
-                        enemy.state = EnemyState::Chase;
+                        // ։荞 (܂ł̎Ԃ)
+                        const float tx = goal.x - trans.position.x, tz = goal.z - trans.position.z;
+                        enemy.state = EnemyState::Strafing;
+                        enemy.stateTimer = std::min(3.0f, std::sqrt(tx * tx + tz * tz) / std::max(enemy.moveSpeed, 0.1f) + 0.5f);
                     }
                 }
+                else {
+                    // }Xԗǂ (߂鎞)
+                    enemy.state = (distToTarget < 8.0f) ? EnemyState::Retreat : EnemyState::Chase;
+                }
             }
+            else if (distToTarget < 8.0f) enemy.state = EnemyState::Retreat;
             else {
-                if (distToTarget < 10.0f && distToTarget > enemy.attackRange) {
-                    if (rand() % 100 < 30) {
-                        enemy.state = EnemyState::Strafing;
-                        enemy.strafeDirection = (rand() % 2 == 0) ? 1.0f : -1.0f;
-                        enemy.stateTimer = 0.8f;
-                    }
-                    else {
-                        enemy.state = EnemyState::Chase;
-                    }
+                if (enemy.rng.Chance(40)) {
+                    enemy.state = EnemyState::Strafing;
+                    enemy.strafeDirection = enemy.rng.Chance(50) ? 1.0f : -1.0f;
+                    enemy.stateTimer = 1.0f;
                 }
                 else {
                     enemy.state = EnemyState::Chase;
                 }
             }
         }
-
-        // ---------------------------------------------------------
-        // 3. GG̉U
-        // ---------------------------------------------------------
-        if (enemy.isRanged) {
-            if (enemy.attackCooldownTimer > 0.0f) enemy.attackCooldownTimer -= dt;
-
-            if (distToTarget < 30.0f && enemy.attackCooldownTimer <= 0.0f) {
-                XMFLOAT3 spawnPos = trans.position;
-                spawnPos.y += 1.0f;
-                XMFLOAT3 targetCorePos = targetPosF;
-                targetCorePos.y += 0.5f;
-
-                XMVECTOR startV = XMLoadFloat3(&spawnPos);
-                XMVECTOR endV = XMLoadFloat3(&targetCorePos);
-                XMVECTOR dirV = XMVector3Normalize(endV - startV);
-                XMFLOAT3 dir;
-                XMStoreFloat3(&dir, dirV);
-
-                int dmg = 10;
-                if (registry->HasComponent<StatusComponent>(id)) {
-                    dmg = registry->GetComponent<StatusComponent>(id).attackPower;
+        else {
+            if (distToTarget < 10.0f && distToTarget > enemy.attackRange) {
+                if (enemy.rng.Chance(30)) {
+                    enemy.state = EnemyState::Strafing;
+                    enemy.strafeDirection = enemy.rng.Chance(50) ? 1.0f : -1.0f;
+                    enemy.stateTimer = 0.8f;
+                }
+                else {
+                    enemy.state = EnemyState::Chase;
                 }
-                EntityFactory::CreateEnemyBullet(pWorld, spawnPos, dir, dmg);
-                enemy.attackCooldownTimer = enemy.attackInterval;
+            }
+            else {
+                enemy.state = EnemyState::Chase;
             }
         }
+    }
 
-        // ---------------------------------------------------------
-        // 4. GG̍ss
-        // ---------------------------------------------------------
+    // ---------------------------------------------------------
+    // 3. GG̉U
+    // ---------------------------------------------------------
+    if (enemy.isRanged) {
+        if (enemy.attackCooldownTimer > 0.0f) enemy.attackCooldownTimer -= thinkDt;
+
+        // C: ǉzɂ͌Ȃ
+        if (distToTarget < RANGED_FIRE_RANGE && enemy.attackCooldownTimer <= 0.0f && sightService.IsVisible(id)) {
+            XMFLOAT3 spawnPos = trans.position;
+            spawnPos.y += MUZZLE_HEIGHT;
+            XMFLOAT3 targetCorePos = targetPosF;
+            targetCorePos.y += TARGET_CORE_HEIGHT;
+
+            XMVECTOR startV = XMLoadFloat3(&spawnPos);
+            XMVECTOR endV = XMLoadFloat3(&targetCorePos);
+            XMVECTOR dirV = XMVector3Normalize(endV - startV);
+            XMFLOAT3 dir;
+            XMStoreFloat3(&dir, dirV);
+
+            out.push_back({ .type = EnemyCommand::Type::FireBullet, .id = id,
+                .position = spawnPos, .direction = dir, .damage = m.attackPower });
+            enemy.attackCooldownTimer = enemy.attackInterval;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------
+// ԂƂ̐p[v
+// -----------------------------------------------------------------------
+// ǐ: WIւ̌ SoA ̔zɂ܂Ƃ߂Ĉxɋ (̂Ȃ[v)A
+// ̌œGƂ̗O (ŒCEߐڍUEȆ~) 
+void EnemySystem::ThinkChase(const uint32_t* slots, size_t count, ThinkScratch& s, std::vector<EnemyCommand>& out) {
+    s.dirX.resize(count);
+    s.dirY.resize(count);
+    s.dirZ.resize(count);
+    float* dx = s.dirX.data();
+    float* dy = s.dirY.data();
+    float* dz = s.dirZ.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        const MinionSlot& m = minions[slots[i]];
+        const XMFLOAT3& p = m.trans->position;
+        const XMFLOAT3& t = perception.GetTarget(m.targetIndex).position;
+        dx[i] = t.x - p.x;
+        dy[i] = t.y - p.y;
+        dz[i] = t.z - p.z;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const float lenSq = dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i];
+        const float inv = (lenSq > 0.0f) ? 1.0f / std::sqrt(lenSq) : 0.0f;
+        dx[i] *= inv;
+        dy[i] *= inv;
+        dz[i] *= inv;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const MinionSlot& m = minions[slots[i]];
+        auto& enemy = *m.enemy;
+        auto& trans = *m.trans;
         XMVECTOR moveDir = XMVectorZero();
         float currentMoveSpeed = enemy.moveSpeed;
 
-        switch (enemy.state) {
-        case EnemyState::Chase:
-            if (enemy.isImmovable) {
-                XMVECTOR dir = XMVector3Normalize(targetPosVec - enemyPos);
-                float angle = atan2f(XMVectorGetX(dir), XMVectorGetZ(dir));
-                trans.rotation.y = angle;
-                break;
-            }
-            if (!enemy.isRanged && distToTarget <= enemy.attackRange) {
-                enemy.state = EnemyState::Attack;
-                enemy.attackTimer = enemy.attackDuration;
-                int dmg = 10;
-                if (registry->HasComponent<StatusComponent>(id)) dmg = registry->GetComponent<StatusComponent>(id).attackPower;
-                EntityFactory::CreateAttackSphere(pWorld, id, trans.position, dmg);
-            }
-            else {
-                moveDir = XMVector3Normalize(targetPosVec - enemyPos);
-                if (enemy.isRanged && distToTarget < enemy.optimalRange && distToTarget > 8.0f) currentMoveSpeed = 0.0f;
+        if (enemy.isImmovable) {
+            trans.rotation.y = atan2f(dx[i], dz[i]);
+        }
+        else if (!enemy.isRanged && m.distToTarget <= enemy.attackRange) {
+            enemy.state = EnemyState::Attack;
+            enemy.attackTimer = enemy.attackDuration;
+            out.push_back({ .type = EnemyCommand::Type::MeleeAttack, .id = m.id,
+                .position = trans.position, .damage = m.attackPower });
+        }
+        else {
+            moveDir = XMVectorSet(dx[i], dy[i], dz[i], 0.0f);
+            // ǂ̌ɂWIւ́Aɉĉ荞
+            XMFLOAT3 flowDir;
+            if (m.targetIndex == flowTargetIndex && flowField.Sample(trans.position, flowDir)) {
+                moveDir = XMLoadFloat3(&flowDir);
             }
-            break;
+            // ̓ǴAWIĂ鎞~܂Č (ȂΉ荞)
+            if (enemy.isRanged && m.distToTarget < enemy.optimalRange && m.distToTarget > 8.0f &&
+                sightService.IsVisible(m.id)) currentMoveSpeed = 0.0f;
+        }
+        FinishThink(m, moveDir, currentMoveSpeed);
+    }
+}
 
-        case EnemyState::Strafing:
-            enemy.stateTimer -= dt;
-            if (enemy.stateTimer <= 0.0f) enemy.state = EnemyState::Chase;
-            {
-                XMVECTOR toTarget = XMVector3Normalize(targetPosVec - enemyPos);
-                XMMATRIX rotMat = XMMatrixRotationY(XM_PIDIV2 * enemy.strafeDirection);
-                moveDir = XMVector3TransformNormal(toTarget, rotMat);
-                if (!enemy.isRanged) moveDir = XMVectorAdd(moveDir, toTarget * 0.3f);
-                moveDir = XMVector3Normalize(moveDir);
-            }
-            break;
+// 荞: WIɑ΂ĉ (ߐڂ͏߂ÂȂ)
+void EnemySystem::ThinkStrafing(const uint32_t* slots, size_t count, std::vector<EnemyCommand>& out) {
+    for (size_t i = 0; i < count; ++i) {
+        const MinionSlot& m = minions[slots[i]];
+        auto& enemy = *m.enemy;
+        auto& trans = *m.trans;
+
+        enemy.stateTimer -= m.thinkDt;
+        if (enemy.stateTimer <= 0.0f) enemy.state = EnemyState::Chase;
+
+        const XMVECTOR enemyPos = XMLoadFloat3(&trans.position);
+        XMVECTOR moveDir;
+        if (enemy.hasTacticalGoal) {
+            // e}bvőI񂾃}X
+            if (!TowardTacticalGoal(enemy, trans.position, moveDir)) enemy.state = EnemyState::Chase;
+        }
+        else {
+            const XMFLOAT3& targetPosF = perception.GetTarget(m.targetIndex).position;
+            XMVECTOR toTarget = XMVector3Normalize(XMLoadFloat3(&targetPosF) - enemyPos);
+            XMMATRIX rotMat = XMMatrixRotationY(XM_PIDIV2 * enemy.strafeDirection);
+            moveDir = XMVector3TransformNormal(toTarget, rotMat);
+            if (!enemy.isRanged) moveDir = XMVectorAdd(moveDir, toTarget * 0.3f);
+            moveDir = XMVector3Normalize(moveDir);
+        }
 
-        case EnemyState::Retreat:
-            if (distToTarget > 12.0f) enemy.state = EnemyState::Chase;
-            moveDir = XMVector3Normalize(enemyPos - targetPosVec);
-            break;
+        // ɕǂΉ荞
+        XMFLOAT3 goal;
+        XMStoreFloat3(&goal, enemyPos + moveDir * STRAFE_LOOKAHEAD);
+        SteerAround(m.id, enemy, trans.position, goal, moveDir, out);
 
-        case EnemyState::Attack:
-            currentMoveSpeed = 0.0f;
-            enemy.attackTimer -= dt;
-            if (enemy.attackTimer <= 0.0f) {
-                enemy.state = EnemyState::Cooldown;
-                enemy.attackTimer = enemy.cooldownTime;
-            }
-            break;
+        FinishThink(m, moveDir, enemy.moveSpeed);
+    }
+}
 
-        case EnemyState::Cooldown:
-            currentMoveSpeed = 0.0f;
-            enemy.attackTimer -= dt;
-            if (enemy.attackTimer <= 0.0f) enemy.state = EnemyState::Chase;
-            break;
+// : WI痣
+void EnemySystem::ThinkRetreat(const uint32_t* slots, size_t count, std::vector<EnemyCommand>& out) {
+    for (size_t i = 0; i < count; ++i) {
+        const MinionSlot& m = minions[slots[i]];
+        auto& enemy = *m.enemy;
+        auto& trans = *m.trans;
+
+        const XMVECTOR enemyPos = XMLoadFloat3(&trans.position);
+        XMVECTOR moveDir;
+        if (enemy.hasTacticalGoal) {
+            // e}bvőI񂾃}X։ (ǐՂɖ߂Č)
+            if (!TowardTacticalGoal(enemy, trans.position, moveDir)) enemy.state = EnemyState::Chase;
+        }
+        else {
+            if (m.distToTarget > 12.0f) enemy.state = EnemyState::Chase;
+            const XMFLOAT3& targetPosF = perception.GetTarget(m.targetIndex).position;
+            moveDir = XMVector3Normalize(enemyPos - XMLoadFloat3(&targetPosF));
         }
 
-        if (XMVectorGetX(XMVector3LengthSq(moveDir)) > 0.001f && currentMoveSpeed > 0.0f) {
-            float angle = atan2f(XMVectorGetX(moveDir), XMVectorGetZ(moveDir));
-            trans.rotation.y = angle;
+        // ɕǂ΁Aǂ̌̓_։荞ŉ
+        XMFLOAT3 goal;
+        XMStoreFloat3(&goal, enemyPos + moveDir * RETREAT_LOOKAHEAD);
+        SteerAround(m.id, enemy, trans.position, goal, moveDir, out);
 
-            XMVECTOR separation = XMVectorZero();
-            int neighborCount = 0;
-            for (EntityID otherID = 0; otherID < ECSConfig::MAX_ENTITIES; ++otherID) {
-                if (id == otherID) continue;
-                if (!registry->HasComponent<EnemyComponent>(otherID)) continue;
-                if (registry->HasComponent<StatusComponent>(otherID) && registry->GetComponent<StatusComponent>(otherID).hp <= 0) continue;
+        FinishThink(m, moveDir, enemy.moveSpeed);
+    }
+}
 
-                auto& otherTrans = registry->GetComponent<TransformComponent>(otherID);
-                float dSq = DistSq(trans.position, otherTrans.position);
-                if (dSq < 4.0f) {
-                    XMVECTOR away = enemyPos - XMLoadFloat3(&otherTrans.position);
-                    separation = XMVectorAdd(separation, XMVector3Normalize(away) / (dSq + 0.1f));
-                    neighborCount++;
-                }
-            }
-            if (neighborCount > 0) {
-                moveDir = XMVectorAdd(moveDir, separation * 1.5f);
-                moveDir = XMVector3Normalize(moveDir);
-            }
+// e}bvőI񂾗ʒuւ̌ (XZ)BĂڕW false
+bool EnemySystem::TowardTacticalGoal(EnemyComponent& enemy, const XMFLOAT3& position, XMVECTOR& outDir) {
+    const float dx = enemy.tacticalGoal.x - position.x, dz = enemy.tacticalGoal.z - position.z;
+    const float dist = std::sqrt(dx * dx + dz * dz);
+    if (dist <= TACTICAL_ARRIVE_DIST) {
+        enemy.hasTacticalGoal = false;
+        outDir = XMVectorZero();
+        return false;
+    }
+    outDir = XMVectorSet(dx / dist, 0.0f, dz / dist, 0.0f);
+    return true;
+}
+
+// U: ̏Ŏ~܂AU̎ԂId
+void EnemySystem::ThinkAttack(const uint32_t* slots, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        auto& enemy = *minions[slots[i]].enemy;
+        enemy.attackTimer -= minions[slots[i]].thinkDt;
+        if (enemy.attackTimer <= 0.0f) {
+            enemy.state = EnemyState::Cooldown;
+            enemy.attackTimer = enemy.cooldownTime;
+        }
+        enemy.moveDir = { 0.0f, 0.0f, 0.0f };
+        enemy.moveSpeedNow = 0.0f;
+    }
+}
+
+// d: ̏Ŏ~܂AǐՂ
+void EnemySystem::ThinkCooldown(const uint32_t* slots, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        auto& enemy = *minions[slots[i]].enemy;
+        enemy.attackTimer -= minions[slots[i]].thinkDt;
+        if (enemy.attackTimer <= 0.0f) enemy.state = EnemyState::Chase;
+        enemy.moveDir = { 0.0f, 0.0f, 0.0f };
+        enemy.moveSpeedNow = 0.0f;
+    }
+}
 
-            XMVECTOR velocity = moveDir * currentMoveSpeed * dt;
-            trans.position.x += XMVectorGetX(velocity);
-            trans.position.z += XMVectorGetZ(velocity);
+// ߂ɋ߂̓G痣͂𑫂āAړɎgƑc
+void EnemySystem::FinishThink(const MinionSlot& m, XMVECTOR moveDir, float currentMoveSpeed) {
+    const EntityID id = m.id;
+    auto& enemy = *m.enemy;
+    auto& trans = *m.trans;
+    const XMVECTOR enemyPos = XMLoadFloat3(&trans.position);
+
+    if (XMVectorGetX(XMVector3LengthSq(moveDir)) > 0.001f && currentMoveSpeed > 0.0f) {
+        float angle = atan2f(XMVectorGetX(moveDir), XMVectorGetZ(moveDir));
+        trans.rotation.y = angle;
+
+        // ߂̓G痣 (ʒu̓t[̍ŏ̂)
+        XMVECTOR separation = XMVectorZero();
+        int neighborCount = 0;
+        enemyHash.ForEachInRadius(trans.position, SEPARATION_RADIUS,
+            [&](uint32_t otherID, const XMFLOAT3& otherPos, float dSq) {
+                if (otherID == id) return;
+                XMVECTOR away = enemyPos - XMLoadFloat3(&otherPos);
+                separation = XMVectorAdd(separation, XMVector3Normalize(away) / (dSq + 0.1f));
+                neighborCount++;
+            });
+        if (neighborCount > 0) {
+            moveDir = XMVectorAdd(moveDir, separation * 1.5f);
+            moveDir = XMVector3Normalize(moveDir);
         }
+
+        // ړ͖Xebv MoveMinions ōs (vlȂXebvŐi)
+        XMStoreFloat3(&enemy.moveDir, moveDir);
+        enemy.moveSpeedNow = currentMoveSpeed;
     }
-}
\ No newline at end of file
+    else {
+        enemy.moveDir = { 0.0f, 0.0f, 0.0f };
+        enemy.moveSpeedNow = 0.0f;
+    }
+}
+
+bool EnemySystem::SteerAround(EntityID id, EnemyComponent& enemy, const XMFLOAT3& position, const XMFLOAT3& goal,
+                              XMVECTOR& outDir, std::vector<EnemyCommand>& out) {
+    int sx, sz, gx, gz;
+    if (!navGrid.CellOf(position, sx, sz)) return false;
+    // ܂sȂoH͎gȂ (Jꏊł͂܂łƓ)
+    if (navGrid.CellOf(goal, gx, gz) && navGrid.LineOfSight(sx, sz, gx, gz)) {
+        enemy.pathKey = 0;
+        return false;
+    }
+
+    // 荞ݒ͑O̖ڕW_g (goal ͈ʒuƈꏏɓ̂ŁA
+    // 蒼Ɗۂ߂Z܂тɌoH𗊂ݒƂɂȂ)
+    // Eǂ蒅ȂEڎwς goal ɏ芷
+    XMFLOAT3 target = goal;
+    if (enemy.pathKey != 0 && pathService.GetStatus(enemy.pathKey) != PathService::Status::Failed) {
+        const XMVECTOR pos = XMLoadFloat3(&position);
+        const XMVECTOR toKept = XMVectorSetY(XMLoadFloat3(&enemy.pathGoal) - pos, 0.0f);
+        const XMVECTOR toGoal = XMVectorSetY(XMLoadFloat3(&goal) - pos, 0.0f);
+        if (XMVectorGetX(XMVector3Length(toKept)) > PATH_GOAL_ARRIVE_DIST &&
+            XMVectorGetX(XMVector3Dot(XMVector3Normalize(toKept), XMVector3Normalize(toGoal))) >= PATH_GOAL_KEEP_COS) {
+            target = enemy.pathGoal;
+        }
+    }
+
+    // ڕW̃Zςݒ (߂̊JnEڕW PathService ł܂Ƃ߂)
+    // LbVւ̓o^ ApplyCommands ōs (vl͓ǂނ)
+    if (!pathService.IsCurrent(enemy.pathKey, target)) {
+        enemy.pathKey = pathService.KeyFor(position, target);
+        enemy.pathWaypoint = 0;
+        enemy.pathGoal = target;
+        if (enemy.pathKey == 0) return false;
+        out.push_back({ .type = EnemyCommand::Type::RequestPath, .id = id, .pathKey = enemy.pathKey });
+    }
+    else {
+        out.push_back({ .type = EnemyCommand::Type::TouchPath, .id = id, .pathKey = enemy.pathKey });
+    }
+    XMFLOAT3 dir;
+    if (!pathService.Steer(enemy.pathKey, position, enemy.pathWaypoint, dir)) return false;
+    outDir = XMLoadFloat3(&dir);
+    return true;
+}
+
+void EnemySystem::MoveMinions(float dt) {
+    RunParallel(minions.size(), MOVE_GRAIN, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; ++i) {
+            const EnemyComponent& enemy = *minions[i].enemy;
+            if (enemy.moveSpeedNow <= 0.0f) continue;
+            TransformComponent& trans = *minions[i].trans;
+            trans.position.x += enemy.moveDir.x * enemy.moveSpeedNow * dt;
+            trans.position.z += enemy.moveDir.z * enemy.moveSpeedNow * dt;
+        }
+    });
+}
@@ -14,6 +14,11 @@ void MovingSystem::Update(float dt) {
         auto& move = registry->GetComponent<MovingComponent>(id);
         auto& trans = registry->GetComponent<TransformComponent>(id);
 
+        // ÕXebv̌oḦʒu (sinl)
+        // C: Transform ̈ʒuł͂ȂoH狁߂ (o Transform oHɂȂ̂ŁA
+        //        ̍𑬓xɂƁAĂ镨̂1񂾂傫^΂Ă܂)
+        float prevS = sinf(move.time);
+
         // Ԃi߂
         move.time += dt * move.speed;
 
@@ -24,5 +29,13 @@ void MovingSystem::Update(float dt) {
         trans.position.x = move.startPos.x + move.moveVec.x * s;
         trans.position.y = move.startPos.y + move.moveVec.y * s;
         trans.position.z = move.startPos.z + move.moveVec.z * s;
+
+        // ̃Xebv̌oḦړʂ瑬x߂Ă (Ă镨̂𓯂^)
+        if (dt > 0.0f) {
+            float ds = (s - prevS) / dt;
+            move.velocity.x = move.moveVec.x * ds;
+            move.velocity.y = move.moveVec.y * ds;
+            move.velocity.z = move.moveVec.z * ds;
+        }
     }
 }
\ No newline at end of file
@@ -16,72 +16,101 @@
 #include "ECS/Components/StatusComponent.h"
 #include "ECS/Components/PlayerPartComponent.h"
 #include "ECS/Components/PhysicsComponent.h"
+#include "ECS/Components/MovingComponent.h"
 #include <vector>
 #include <cmath>
+#include <cfloat>
 #include <algorithm> // std::max, std::min
+#include <chrono>
 #include <DirectXMath.h>
 #include <DirectXCollision.h>
 #include "Game/EntityFactory.h"
+#include "Engine/JobSystem.h"
 
 using namespace DirectX;
 
+// ÓIRC_[̃Obh̃ZTCY
+static constexpr float STATIC_GRID_CELL = 4.0f;
+// |Ŏ~߂ɕǂƂ̊ԂɎc
+static constexpr float CCD_SKIN = 0.02f;
+// e̔a (EntityFactory̐ݒƍ킹)
+static constexpr float BULLET_RADIUS = 0.3f;
+// X[v: xȉ̂܂ SLEEP_TIME bÎ~疰点
+static constexpr float SLEEP_VELOCITY = 0.05f;
+static constexpr float SLEEP_TIME = 0.5f;
+// ʒu炱ȏジꂽÎ~Ƃ݂ȂȂ (Ă΋N)
+static constexpr float SLEEP_MOVE = 0.01f;
+// ڐGLbV: ҂̈ړꖢȂỎog
+static constexpr float CONTACT_REUSE_DIST = 0.002f;
+// LN^[Rg[[: 1Xebvłȏ㓮Ă烏[vƂ݂Ȃđ|Ȃ (EX|[)
+static constexpr float CONTROLLER_TELEPORT_DIST = 5.0f;
+// IObh̃ZTCYƁAߖTŎ̑傫ɑ]T (Xebv̉oœ)
+static constexpr float DYNAMIC_GRID_CELL = 4.0f;
+static constexpr float DYNAMIC_QUERY_MARGIN = 0.5f;
+
 // -----------------------------------------------------------------------
-// wp[֐: (p1-q1)  (p2-q2) ̍ŒZ2߂
+// Ԃ̌v
 // -----------------------------------------------------------------------
-static float SegmentToSegmentDistSq(
-    XMVECTOR p1, XMVECTOR q1,
-    XMVECTOR p2, XMVECTOR q2,
-    XMVECTOR& outC1, XMVECTOR& outC2)
-{
-    XMVECTOR d1 = q1 - p1;
-    XMVECTOR d2 = q2 - p2;
-    XMVECTOR r = p1 - p2;
-    float a = XMVectorGetX(XMVector3Dot(d1, d1));
-    float e = XMVectorGetX(XMVector3Dot(d2, d2));
-    float f = XMVectorGetX(XMVector3Dot(d2, r));
-
-    if (a <= 0.00001f && e <= 0.00001f) {
-        outC1 = p1; outC2 = p2;
-        return XMVectorGetX(XMVector3LengthSq(p1 - p2));
-    }
-    if (a <= 0.00001f) {
-        outC1 = p1;
-        float t = std::max(0.0f, std::min(1.0f, f / e));
-        outC2 = p2 + d2 * t;
-        return XMVectorGetX(XMVector3LengthSq(outC1 - outC2));
-    }
-    if (e <= 0.00001f) {
-        outC2 = p2;
-        float t = std::max(0.0f, std::min(1.0f, -XMVectorGetX(XMVector3Dot(d1, r)) / a));
-        outC1 = p1 + d1 * t;
-        return XMVectorGetX(XMVector3LengthSq(outC1 - outC2));
-    }
-
-    float c = XMVectorGetX(XMVector3Dot(d1, r));
-    float b = XMVectorGetX(XMVector3Dot(d1, d2));
-    float denom = a * e - b * b;
-
-    float s, t;
-    if (denom != 0.0f) {
-        s = std::max(0.0f, std::min(1.0f, (b * f - c * e) / denom));
+// Lap ĂԂтɁAO Lap ̌oߎԂ̋Ԃɑ
+class PhaseTimer {
+public:
+    explicit PhaseTimer(PhysicsCounters& counters)
+        : counters(counters), start(Clock::now()), last(start) {}
+
+    void Lap(PhysicsPhase phase) {
+        Clock::time_point now = Clock::now();
+        counters.phaseMs[(size_t)phase] += std::chrono::duration<float, std::milli>(now - last).count();
+        last = now;
     }
-    else {
-        s = 0.0f;
+    void Finish() {
+        counters.totalMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
     }
 
-    t = (b * s + f) / e;
-    if (t < 0.0f) {
-        t = 0.0f;
-        s = std::max(0.0f, std::min(1.0f, -c / a));
-    }
-    else if (t > 1.0f) {
-        t = 1.0f;
-        s = std::max(0.0f, std::min(1.0f, (b - c) / a));
-    }
+private:
+    using Clock = std::chrono::steady_clock;
+    PhysicsCounters& counters;
+    Clock::time_point start;
+    Clock::time_point last;
+};
+
+void PhysicsStatsHistory::Push(const PhysicsCounters& c) {
+    totalMs[head] = c.totalMs;
+    for (size_t p = 0; p < (size_t)PhysicsPhase::Count; ++p) phaseMs[p][head] = c.phaseMs[p];
+    head = (head + 1) % SIZE;
+    if (count < SIZE) ++count;
+}
+
+float PhysicsStatsHistory::AverageTotal() const {
+    if (count == 0) return 0.0f;
+    float sum = 0.0f;
+    for (int i = 0; i < count; ++i) sum += totalMs[i];
+    return sum / count;
+}
+
+float PhysicsStatsHistory::PeakTotal() const {
+    float peak = 0.0f;
+    for (int i = 0; i < count; ++i) peak = std::max(peak, totalMs[i]);
+    return peak;
+}
 
-    outC1 = p1 + d1 * s;
-    outC2 = p2 + d2 * t;
-    return XMVectorGetX(XMVector3LengthSq(outC1 - outC2));
+float PhysicsStatsHistory::AveragePhase(PhysicsPhase phase) const {
+    if (count == 0) return 0.0f;
+    float sum = 0.0f;
+    for (int i = 0; i < count; ++i) sum += phaseMs[(size_t)phase][i];
+    return sum / count;
+}
+
+static float LengthSq(const XMFLOAT3& v) {
+    return v.x * v.x + v.y * v.y + v.z * v.z;
+}
+static float DistSq(const XMFLOAT3& a, const XMFLOAT3& b) {
+    const float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// ʉ̖炵 (Game Ȃ (eXgȂ) ͖炳Ȃ)
+static Audio* GameAudio() {
+    return Game::GetInstance() ? Game::GetInstance()->GetAudio() : nullptr;
 }
 
 // -----------------------------------------------------------------------
@@ -110,119 +139,858 @@ static void DestroyEnemyParts(World* world, EntityID parentID) {
 
 
 // -----------------------------------------------------------------------
-// OBB擾֐̎
+// RC_[LbV
 // -----------------------------------------------------------------------
-OBB PhysicsSystem::GetOBB(EntityID id) {
+void ColliderCache::Resize(size_t n) {
+    world.resize(n); invWorld.resize(n); extents.resize(n);
+    aabbMin.resize(n); aabbMax.resize(n);
+    sphereRadius.resize(n); capRadius.resize(n); capHalfLen.resize(n);
+    valid.resize(n, 0);
+    position.resize(n); rotation.resize(n); scale.resize(n);
+    type.resize(n, ColliderType::Type_None);
+    size.resize(n); radius.resize(n, 0.0f); height.resize(n, 0.0f);
+    hullShape.resize(n, ShapeType::CUBE);
+    frame.resize(n, 0);
+    isStatic.resize(n, 0);
+    layer.resize(n, CollisionLayer::Static);
+}
+
+// ʕRC_[̒_ (GeometryGenerator ̃bVƓ`E傫)
+struct HullPoints {
+    std::vector<XMFLOAT3> points;
+    XMFLOAT3 extent = { 0.0f, 0.0f, 0.0f };    // _eւ̍ő勗
+};
+
+// `Ƃɍŏ1񂾂bVĒ_o
+// ([J[ǂނ̂ŁAS܂Ƃ߂ĐÓIōĂ)
+static const HullPoints& HullPointsOf(ShapeType shape) {
+    static const std::vector<HullPoints> table = [] {
+        const ShapeType shapes[] = {
+            ShapeType::CUBE, ShapeType::CAPSULE, ShapeType::SPHERE,
+            ShapeType::TETRAHEDRON, ShapeType::TORUS, ShapeType::DOUBLE_PYRAMID
+        };
+        std::vector<HullPoints> result(std::size(shapes));
+        for (ShapeType s : shapes) {
+            HullPoints& hull = result[(size_t)s];
+            for (const Vertex& v : GeometryGenerator::CreateMesh(s).vertices) {
+                hull.points.push_back(v.position);
+                hull.extent.x = std::max(hull.extent.x, std::abs(v.position.x));
+                hull.extent.y = std::max(hull.extent.y, std::abs(v.position.y));
+                hull.extent.z = std::max(hull.extent.z, std::abs(v.position.z));
+            }
+        }
+        return result;
+    }();
+    return table[(size_t)shape];
+}
+
+static bool SameFloat3(const XMFLOAT3& a, const XMFLOAT3& b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+// -----------------------------------------------------------------------
+// X[v
+// -----------------------------------------------------------------------
+void SleepState::Resize(size_t n) {
+    sleeping.resize(n, 0);
+    restTime.resize(n, 0.0f);
+    restPosition.resize(n);
+}
+
+void PhysicsSystem::UpdateSleep(EntityID id, bool resting, const XMFLOAT3& position, float dt) {
+    if (!resting || DistSq(position, sleep.restPosition[id]) > SLEEP_MOVE * SLEEP_MOVE) {
+        sleep.restTime[id] = 0.0f;
+        sleep.restPosition[id] = position;
+        return;
+    }
+    sleep.restTime[id] += dt;
+    if (sleep.restTime[id] >= SLEEP_TIME) sleep.sleeping[id] = 1;
+}
+
+void PhysicsSystem::WakeBody(EntityID id) {
+    if (!sleep.sleeping[id]) return;
+    sleep.sleeping[id] = 0;
+    sleep.restTime[id] = 0.0f;
+}
+
+void PhysicsSystem::WakeAll() {
+    std::fill(sleep.sleeping.begin(), sleep.sleeping.end(), 0);
+    std::fill(sleep.restTime.begin(), sleep.restTime.end(), 0.0f);
+}
+
+// -----------------------------------------------------------------------
+// RC_[ꗗ
+// -----------------------------------------------------------------------
+// Registry ̒ʒmĂ΂ (ǉE폜̓rȂ̂ŁAIDςނɂ)
+void PhysicsSystem::MarkColliderDirty(EntityID id, uint8_t flags) {
+    if (id >= ECSConfig::MAX_ENTITIES) return;
+    if (!colliderDirty[id]) dirtyColliders.push_back(id);
+    colliderDirty[id] |= flags;
+}
+
+// Xebv̓ŁAς񂾒ǉE폜ꗗɔf
+void PhysicsSystem::SyncColliders() {
     auto registry = pWorld->GetRegistry();
-    OBB obb = {};
-    //
-    XMStoreFloat4x4(&obb.worldMatrix, XMMatrixIdentity());
-    obb.center = { 0,0,0 };
-	obb.extents = { 0.5f,0.5f,0.5f };
+    ColliderCache& c = colliderCache;
+
+    bool removed = false;
+    addedColliders.clear();
+    for (EntityID id : dirtyColliders) {
+        const uint8_t flags = colliderDirty[id];
+        colliderDirty[id] = 0;
+        if (flags & COLLIDER_REMOVED) {
+            // IDō蒼ĂĂA͂RŃLbVcȂ悤Ɏ̂Ă
+            if (c.isStatic[id]) staticsDirty = true; // ǂ
+            c.isStatic[id] = 0;
+            c.valid[id] = 0;
+            sleep.sleeping[id] = 0;                  // IDėpĂ܂ܐ܂Ȃ悤
+        }
+        const bool listed = registry->HasComponent<TransformComponent>(id) &&
+            registry->HasComponent<ColliderComponent>(id);
+        if (listed && !colliderListed[id]) {
+            addedColliders.push_back(id);
+        }
+        else if (!listed && colliderListed[id]) {
+            removed = true;
+        }
+        colliderListed[id] = listed ? 1 : 0;
+    }
+    dirtyColliders.clear();
+
+    if (removed) {
+        std::erase_if(colliderIDs, [&](EntityID id) { return !colliderListed[id]; });
+    }
+    if (!addedColliders.empty()) {
+        std::sort(addedColliders.begin(), addedColliders.end());
+        const size_t oldCount = colliderIDs.size();
+        colliderIDs.insert(colliderIDs.end(), addedColliders.begin(), addedColliders.end());
+        std::inplace_merge(colliderIDs.begin(), colliderIDs.begin() + oldCount, colliderIDs.end());
+    }
+}
+
+// ꗗ̃RC_[mFÂČvZ
+// (̃VXe Transform 𒼐ڏ̂ŁAړ͓͂OƔׂČ)
+void PhysicsSystem::RefreshColliders() {
+    ++cacheFrame;
+    for (EntityID id : colliderIDs) RefreshCollider(id);
+}
+
+void PhysicsSystem::RefreshCollider(EntityID id) {
+    auto registry = pWorld->GetRegistry();
+    ColliderCache& c = colliderCache;
+    c.frame[id] = cacheFrame;
 
     if (!registry->HasComponent<TransformComponent>(id) ||
         !registry->HasComponent<ColliderComponent>(id)) {
-        return obb;
+        c.valid[id] = 0;
+        if (c.isStatic[id]) staticsDirty = true; // ǂ
+        sleep.sleeping[id] = 0;                  // IDėpĂ܂ܐ܂Ȃ悤
+        return;
     }
 
     const auto& trans = registry->GetComponent<TransformComponent>(id);
     const auto& col = registry->GetComponent<ColliderComponent>(id);
-    //Type_None ȂTCY0OBBԂďI
+
+    // C[͌`Ɗ֌WȂǂݒ (ÓIǂςObh蒼)
+    if (c.layer[id] != col.layer) {
+        if (c.valid[id] && (c.layer[id] == CollisionLayer::Static || col.layer == CollisionLayer::Static)) {
+            staticsDirty = true;
+        }
+        c.layer[id] = col.layer;
+    }
+
+    // ͂OƓȂČvZȂ (ÓIȕǁE͂ŏI)
+    if (c.valid[id] &&
+        c.type[id] == col.type &&
+        SameFloat3(c.position[id], trans.position) &&
+        SameFloat3(c.rotation[id], trans.rotation) &&
+        SameFloat3(c.scale[id], trans.scale) &&
+        SameFloat3(c.size[id], col.size) &&
+        c.radius[id] == col.radius &&
+        c.height[id] == col.height &&
+        c.hullShape[id] == col.hullShape) {
+        return;
+    }
+
+    c.position[id] = trans.position;
+    c.rotation[id] = trans.rotation;
+    c.scale[id] = trans.scale;
+    c.type[id] = col.type;
+    c.size[id] = col.size;
+    c.radius[id] = col.radius;
+    c.height[id] = col.height;
+    c.hullShape[id] = col.hullShape;
+
+    // ÓIRC_[//Obh蒼
+    if (c.isStatic[id] || IsStaticBlocker(id)) staticsDirty = true;
+
+    // o (CheckAndResolve) ŎJvZƂČ̐@
+    float capR = col.radius * trans.scale.x;
+    float capH = col.height * trans.scale.y;
+    c.capRadius[id] = capR;
+    c.capHalfLen[id] = std::max<float>(0.0f, capH - 2.0f * capR) * 0.5f;
+
+    //Type_None ͑ƂĂ͔肵Ȃ
     if (col.type == ColliderType::Type_None) {
-        obb.extents = { 0,0,0 };
-        return obb;
+        c.valid[id] = 0;
+        return;
     }
-	//svZ
+    c.valid[id] = 1;
+
+    //svZ
     XMMATRIX R = XMMatrixRotationRollPitchYaw(trans.rotation.x, trans.rotation.y, trans.rotation.z);
     XMMATRIX T = XMMatrixTranslation(trans.position.x, trans.position.y, trans.position.z);
     XMMATRIX world = R * T;
+    XMVECTOR det;
+    XMStoreFloat4x4(&c.world[id], world);
+    XMStoreFloat4x4(&c.invWorld[id], XMMatrixInverse(&det, world));
 
-    XMStoreFloat4x4(&obb.worldMatrix, world);
-
-    // 2. S (Transform̈ʒu)
-    obb.center = trans.position;
-
+    // TCY (GetOBB ƓK)
+    XMFLOAT3 e;
     if (col.type == ColliderType::Type_Box) {
-        obb.extents = {
+        e = {
             col.size.x * trans.scale.x * 0.5f,
             col.size.y * trans.scale.y * 0.5f,
             col.size.z * trans.scale.z * 0.5f
         };
     }
     else if (col.type == ColliderType::Type_Sphere) {
-        // ̂̏ꍇ (aXYZׂĂExtentɓKpė̈ƂA܂͋ƂĈ)
-        // OBBƂċߎꍇ́Aaẽn[tTCYƂ܂
+        // ̂̏ꍇ (L攻ł͔aXYZׂĂExtentɓKpė̈B
+        // oEqbg ConvexShapeOf ̋Ŋm߂)
         float scaledRadius = col.radius * trans.scale.x; // ꗥXXP[ˑƂ
-        obb.extents = { scaledRadius, scaledRadius, scaledRadius };
+        e = { scaledRadius, scaledRadius, scaledRadius };
+    }
+    else if (col.type == ColliderType::Type_Hull) {
+        // ʕ̏ꍇ (S_ɂ낦āAS_͂ޔ)
+        const HullPoints& hull = HullPointsOf(col.hullShape);
+        e = {
+            hull.extent.x * col.size.x * trans.scale.x,
+            hull.extent.y * col.size.y * trans.scale.y,
+            hull.extent.z * col.size.z * trans.scale.z
+        };
     }
     else {
         // JvZ̏ꍇ (BoxłSpherełȂȂCapsuleƂ݂Ȃ)
         float scaledRadius = col.radius * trans.scale.x;
         float scaledHeight = col.height * trans.scale.y;
-        obb.extents = { scaledRadius, scaledHeight * 0.5f, scaledRadius };
+        e = { scaledRadius, scaledHeight * 0.5f, scaledRadius };
     }
-    return obb;
+    c.extents[id] = e;
+
+    // [hAABB: eւ̓e = || * TCY
+    const XMFLOAT4X4& m = c.world[id];
+    XMFLOAT3 h = {
+        std::abs(m.m[0][0]) * e.x + std::abs(m.m[1][0]) * e.y + std::abs(m.m[2][0]) * e.z,
+        std::abs(m.m[0][1]) * e.x + std::abs(m.m[1][1]) * e.y + std::abs(m.m[2][1]) * e.z,
+        std::abs(m.m[0][2]) * e.x + std::abs(m.m[1][2]) * e.y + std::abs(m.m[2][2]) * e.z
+    };
+    c.aabbMin[id] = { trans.position.x - h.x, trans.position.y - h.y, trans.position.z - h.z };
+    c.aabbMax[id] = { trans.position.x + h.x, trans.position.y + h.y, trans.position.z + h.z };
+    c.sphereRadius[id] = std::sqrt(e.x * e.x + e.y * e.y + e.z * e.z);
 }
 
 // -----------------------------------------------------------------------
-// CLXgɂnʔ
+// 
 // -----------------------------------------------------------------------
-// ߂l: qbgǂ (true/false)
-// outDist: qbgꍇ̋
-static bool RaycastGround(World* world, XMVECTOR origin, float maxDist, float& outDist) {
+void PhysicsSystem::Init(World* world) {
+    System::Init(world);
+    ConfigureLayers();
+    // [J[GameĂ (ȂΑSCXbhŏ)
+    pJobs = Game::GetInstance() ? Game::GetInstance()->GetJobSystem() : nullptr;
+
+    // EntityIDňz
+    colliderCache.Resize(ECSConfig::MAX_ENTITIES);
+    sleep.Resize(ECSConfig::MAX_ENTITIES);
+    stepStart.resize(ECSConfig::MAX_ENTITIES);
+    settledPosition.resize(ECSConfig::MAX_ENTITIES);
+    settledFrame.assign(ECSConfig::MAX_ENTITIES, 0);
+    groundedOn.assign(ECSConfig::MAX_ENTITIES, ECSConfig::INVALID_ID);
+    colliderListed.assign(ECSConfig::MAX_ENTITIES, 0);
+    colliderDirty.assign(ECSConfig::MAX_ENTITIES, 0);
+
+    // RC_[ꗗ͒ǉE폜̒ʒmŕۂ (Init Oɍꂽ̂͂Őς)
     auto registry = world->GetRegistry();
-    float closestDist = maxDist;
-    bool hitAny = false;
+    registry->OnComponentAdded<ColliderComponent>([this](EntityID id) {
+        MarkColliderDirty(id, COLLIDER_DIRTY);
+    });
+    registry->OnComponentAdded<TransformComponent>([this, registry](EntityID id) {
+        if (registry->HasComponent<ColliderComponent>(id)) MarkColliderDirty(id, COLLIDER_DIRTY);
+    });
+    registry->OnEntityDestroyed([this](EntityID id) {
+        if (id < ECSConfig::MAX_ENTITIES && (colliderListed[id] || colliderDirty[id])) {
+            MarkColliderDirty(id, COLLIDER_REMOVED);
+        }
+    });
+    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+        if (registry->HasComponent<ColliderComponent>(id)) MarkColliderDirty(id, COLLIDER_DIRTY);
+    }
+}
 
-    XMVECTOR dirDown = XMVectorSet(0, -1, 0, 0); // ^
+// Փ˃}gNX̐ݒ
+// o (CheckAndResolve)EڒnE|EU//ẽqbg
+// ׂĂ̕\ŃyAiĂR|[lg
+void PhysicsSystem::ConfigureLayers() {
+    using namespace CollisionLayer;
+    layerMatrix.Clear();
+
+    // E: LN^[/ԂAe~܂
+    layerMatrix.Set(Static, Player, true);
+    layerMatrix.Set(Static, Enemy, true);
+    layerMatrix.Set(Static, PlayerBullet, true);
+    layerMatrix.Set(Static, EnemyBullet, true);
+
+    // : ͏EǂƓ
+    layerMatrix.Set(Kinematic, Player, true);
+    layerMatrix.Set(Kinematic, Enemy, true);
+    layerMatrix.Set(Kinematic, PlayerBullet, true);
+    layerMatrix.Set(Kinematic, EnemyBullet, true);
+
+    // LN^[m (Gl~[m͉Ȃ)
+    layerMatrix.Set(Player, Player, true);
+    layerMatrix.Set(Player, Enemy, true);
+    layerMatrix.Set(Player, PlayerPart, true);  // ̃p[c CheckAndResolve ŏO
+    layerMatrix.Set(Player, EnemyPart, true);
+    layerMatrix.Set(Enemy, PlayerPart, true);
+    layerMatrix.Set(Enemy, EnemyPart, true);
+
+    // U (ǂ̐͂ Apply* ŎĔ)
+    layerMatrix.Set(AttackBox, Player, true);
+    layerMatrix.Set(AttackBox, Enemy, true);
+    layerMatrix.Set(AttackSphere, Player, true);
+    layerMatrix.Set(AttackSphere, Enemy, true);
+
+    // 񕜂̓vC[̂
+    layerMatrix.Set(RecoveryBox, Player, true);
+    layerMatrix.Set(RecoverySphere, Player, true);
+
+    // e͑̐͂ɂ
+    layerMatrix.Set(PlayerBullet, Enemy, true);
+    layerMatrix.Set(EnemyBullet, Player, true);
+
+    // dȂ邾ŉoȂC[
+    triggerLayers = (1u << AttackBox) | (1u << AttackSphere) |
+        (1u << RecoveryBox) | (1u << RecoverySphere) |
+        (1u << PlayerBullet) | (1u << EnemyBullet);
+}
 
-    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
-        // n(Ground)Ƃ݂Ȃ̂
-        // łColliderAPlayer/Enemy/AttackBoxłȂ̂nʂƂ݂Ȃ
-        // (ɂȂ TagComponent  "Ground" ̂xXgłAȈՔ)
+// -----------------------------------------------------------------------
+// OBB擾֐̎ (LbVgݗĂ)
+// -----------------------------------------------------------------------
+OBB PhysicsSystem::GetOBB(EntityID id) {
+    auto registry = pWorld->GetRegistry();
+    OBB obb = {};
+    //
+    XMStoreFloat4x4(&obb.worldMatrix, XMMatrixIdentity());
+    obb.center = { 0,0,0 };
+	obb.extents = { 0.5f,0.5f,0.5f };
+
+    if (!registry->HasComponent<TransformComponent>(id) ||
+        !registry->HasComponent<ColliderComponent>(id)) {
+        return obb;
+    }
+
+    RefreshCollider(id);
+
+    const ColliderCache& c = colliderCache;
+    //Type_None ȂTCY0OBBԂďI
+    if (!c.valid[id]) {
+        obb.extents = { 0,0,0 };
+        return obb;
+    }
+    obb.worldMatrix = c.world[id];
+    obb.center = c.position[id];
+    obb.extents = c.extents[id];
+    return obb;
+}
+
+// -----------------------------------------------------------------------
+// nʌOBBSoAzɋl߂
+// -----------------------------------------------------------------------
+// ڒnCׂ͂Ă̔zɑ΂ RaycastBatch ł܂Ƃ߂Ĕ肷
+// n(Ground)Ƃ݂Ȃ͔̂w̍Ȃ (w͕̍̂ǂƂĉoň)
+static bool IsGroundShape(const ColliderCache& c, EntityID id) {
+    return c.scale[id].y <= 1.5f;
+}
+
+// nʂ͌`ɂ炸ƂĈ
+static XMFLOAT3 GroundExtents(const ColliderCache& c, EntityID id) {
+    return {
+        c.size[id].x * c.scale[id].x * 0.5f,
+        c.size[id].y * c.scale[id].y * 0.5f,
+        c.size[id].z * c.scale[id].z * 0.5f
+    };
+}
+
+// ÓIȏ BuildStaticGrid ŋl߂Ă̂ŁA̓lߒ
+void PhysicsSystem::BuildGroundBoxes() {
+    const ColliderCache& c = colliderCache;
+    groundBoxes.Truncate(staticGroundCount);
+
+    for (EntityID id : kinematicIDs) {
+        if (!IsGroundShape(c, id)) continue;
+        groundBoxes.Add(id, c.position[id], GroundExtents(c, id), c.world[id]);
+    }
+}
+
+// -----------------------------------------------------------------------
+// U//e̓ΏۂSoAzɋl߂
+// -----------------------------------------------------------------------
+// Type_None ͓Ȃ̂œo^Ȃ
+void PhysicsSystem::BuildTargetBoxes() {
+    auto registry = pWorld->GetRegistry();
+    const ColliderCache& c = colliderCache;
+    targetBoxes.Clear();
+
+    // ꗗɂ͉œ|ꂽ̂̃Xebv܂ŎĉŁAR|[lgm߂
+    for (EntityID id : colliderIDs) {
         if (!registry->HasComponent<ColliderComponent>(id)) continue;
+        if (!registry->HasComponent<StatusComponent>(id)) continue;
         if (!registry->HasComponent<TransformComponent>(id)) continue;
 
-        // OΏ
-        if (registry->HasComponent<PlayerComponent>(id)) continue;
-        if (registry->HasComponent<EnemyComponent>(id)) continue;
-        if (registry->HasComponent<AttackBoxComponent>(id)) continue;
-        if (registry->HasComponent<RecoveryBoxComponent>(id)) continue;
-        if (registry->HasComponent<AttackSphereComponent>(id)) continue;
-        if (registry->HasComponent<RecoverySphereComponent>(id)) continue;
-        if (registry->HasComponent<PlayerPartComponent>(id)) continue;
-
-        // OBB擾 (PhysicsSystemNX̃\bhstaticwp[邩AłľvZs)
-        // ł͊ȈՓIOBBvZĎi܂PhysicsSystem::GetOBBpublic staticɂČĂԁj
+        EnsureCollider(id);
+        if (!c.valid[id]) continue;
+        targetBoxes.Add(id, c.position[id], c.extents[id], c.world[id]);
+    }
+
+    // ꊇ̏o͐ (Xbh)
+    PrepareScratch(targetBoxes.Size());
+}
+
+// -----------------------------------------------------------------------
+// ÓIRC_[ (CCD̎Օ)
+// -----------------------------------------------------------------------
+// Static C[̃RC_[ = EǁENX^
+void PhysicsSystem::BuildStaticGrid() {
+    if (!staticsDirty) return;
+    staticsDirty = false;
+
+    ColliderCache& c = colliderCache;
+    staticBoxes.Clear();
+    groundBoxes.Clear();
+    // ꗗOꂽ̂ SyncColliders  isStatic 𗎂ƂĂ
+    for (EntityID id : colliderIDs) {
+        c.isStatic[id] = (c.valid[id] && IsStaticBlocker(id)) ? 1 : 0;
+        if (!c.isStatic[id]) continue;
+        staticBoxes.Add(id, c.position[id], c.extents[id], c.world[id]);
+        // ڒnCp̏ŋl߂Ă (Ȃ̂Ŏɍ蒼܂Ŏg)
+        if (IsGroundShape(c, id)) groundBoxes.Add(id, c.position[id], GroundExtents(c, id), c.world[id]);
+    }
+    staticGroundCount = groundBoxes.Size();
+    staticGrid.Build(staticBoxes, STATIC_GRID_CELL);
+    ++staticVersion;
+}
+
+// -----------------------------------------------------------------------
+//  (Kinematic)
+// -----------------------------------------------------------------------
+void PhysicsSystem::BuildKinematicBoxes() {
+    const ColliderCache& c = colliderCache;
+    kinematicIDs.clear();
+    kinematicBoxes.Clear();
+    for (EntityID id : colliderIDs) {
+        if (!c.valid[id] || !IsKinematic(id)) continue;
+        kinematicIDs.push_back(id);
+        kinematicBoxes.Add(id, c.position[id], c.extents[id], c.world[id]);
+    }
+}
+
+void PhysicsSystem::CarryRiders(float dt) {
+    auto registry = pWorld->GetRegistry();
+
+    // Ă镨̂ƈꏏɓ (x MovingSystem ̃Xebv̈ړʂ狁߂)
+    for (EntityID id : riders) {
+        EntityID platformID = groundedOn[id];
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+        if (!registry->HasComponent<MovingComponent>(platformID)) continue;
+
+        const XMFLOAT3& v = registry->GetComponent<MovingComponent>(platformID).velocity;
         auto& trans = registry->GetComponent<TransformComponent>(id);
-        if (trans.scale.y > 1.5f) continue;
-        auto& col = registry->GetComponent<ColliderComponent>(id);
-        if (col.type == ColliderType::Type_None) continue;
-
-        // DirectX::BoundingOrientedBox 쐬
-        BoundingOrientedBox obb;
-        obb.Center = trans.position;
-        obb.Extents = {
-            col.size.x * trans.scale.x * 0.5f,
-            col.size.y * trans.scale.y * 0.5f,
-            col.size.z * trans.scale.z * 0.5f
-        };
-        // ] (Quaternion)
-        XMVECTOR Q = XMQuaternionRotationRollPitchYaw(trans.rotation.x, trans.rotation.y, trans.rotation.z);
-        XMStoreFloat4(&obb.Orientation, Q);
-
-        // C
-        float dist = 0.0f;
-        if (obb.Intersects(origin, dirDown, dist)) {
-            if (dist < closestDist) {
-                closestDist = dist;
-                hitAny = true;
+        trans.position.x += v.x * dt;
+        trans.position.y += v.y * dt;
+        trans.position.z += v.z * dt;
+        // ɉ^΂ꂽ̓Rg[[ő|Ȃ
+        settledPosition[id].x += v.x * dt;
+        settledPosition[id].y += v.y * dt;
+        settledPosition[id].z += v.z * dt;
+        WakeBody(id);
+    }
+
+    //  (ÕXebv̈ʒu`̈ʒu) ɐGꂻȖĂ镨̂N
+    // ̐͏Ȃ̂ŁAĂ镨̂ƂɑS̏
+    if (kinematicIDs.empty()) return;
+    const ColliderCache& c = colliderCache;
+    const float margin = 0.5f;
+    for (EntityID id : colliderIDs) {
+        if (!sleep.sleeping[id] || !c.valid[id]) continue;
+        for (EntityID platformID : kinematicIDs) {
+            if (!registry->HasComponent<TransformComponent>(platformID)) continue;
+            const XMFLOAT3& now = registry->GetComponent<TransformComponent>(platformID).position;
+            const XMFLOAT3& old = c.position[platformID];
+            XMFLOAT3 mn = c.aabbMin[platformID];
+            XMFLOAT3 mx = c.aabbMax[platformID];
+            mn.x += std::min(0.0f, now.x - old.x) - margin; mx.x += std::max(0.0f, now.x - old.x) + margin;
+            mn.y += std::min(0.0f, now.y - old.y) - margin; mx.y += std::max(0.0f, now.y - old.y) + margin;
+            mn.z += std::min(0.0f, now.z - old.z) - margin; mx.z += std::max(0.0f, now.z - old.z) + margin;
+            if (c.aabbMax[id].x < mn.x || c.aabbMin[id].x > mx.x) continue;
+            if (c.aabbMax[id].y < mn.y || c.aabbMin[id].y > mx.y) continue;
+            if (c.aabbMax[id].z < mn.z || c.aabbMin[id].z > mx.z) continue;
+            WakeBody(id);
+            break;
+        }
+    }
+}
+
+void PhysicsSystem::SetGroundedOn(EntityID id, const Collision::RayHit& hit) {
+    groundedOn[id] = ECSConfig::INVALID_ID;
+    if (!hit.hit || hit.index < (int)staticGroundCount) return;
+    groundedOn[id] = groundBoxes.ids[hit.index];
+    riders.push_back(id);
+}
+
+// -----------------------------------------------------------------------
+// LN^[Rg[[
+// -----------------------------------------------------------------------
+// EǁEEgK[ȊO (LN^[ƃp[c) o^
+// ̑͂߂̂
+void PhysicsSystem::BuildDynamicGrid() {
+    const ColliderCache& c = colliderCache;
+    dynamicBoxes.Clear();
+    for (EntityID id : colliderIDs) {
+        if (!c.valid[id]) continue;
+        if (IsStaticBlocker(id) || IsKinematic(id)) continue;
+        if (triggerLayers & (1u << c.layer[id])) continue;
+        dynamicBoxes.Add(id, c.position[id], c.extents[id], c.world[id]);
+    }
+    dynamicGrid.Build(dynamicBoxes, DYNAMIC_GRID_CELL);
+}
+
+// ړ  Փ  ʂɉĊ点Aő CONTROLLER_ITERATIONS 
+// LN^[̃RC_[͋ (JvZ̐c͒Z) Ȃ̂ŁAS̋ő|
+void PhysicsSystem::SlideCharacter(CharacterMove& move, WorkerScratch& scratch) const {
+    std::vector<uint32_t>& candidates = scratch.candidates;
+    XMFLOAT3 pos = move.from;
+    float restX = move.to.x - move.from.x;
+    float restZ = move.to.z - move.from.z;
+    move.normalCount = 0;
+
+    for (int iter = 0; iter < CONTROLLER_ITERATIONS; ++iter) {
+        float lenSq = restX * restX + restZ * restZ;
+        if (lenSq < 1e-10f) break;
+
+        XMFLOAT3 target = { pos.x + restX, pos.y, pos.z + restZ };
+        float hitDist;
+        XMFLOAT3 normal;
+        bool hit = SweepStatic(pos, target, move.radius, move.minTopY, hitDist, candidates, &normal);
+        ++scratch.sweepCount;
+        scratch.candidateCount += (uint32_t)candidates.size();
+        scratch.testCount += (uint32_t)(candidates.size() + kinematicBoxes.Size());
+        if (!hit) {
+            pos = target;
+            break;
+        }
+        ++scratch.hitCount;
+
+        // O܂Ői
+        float len = std::sqrt(lenSq);
+        float keep = std::max(0.0f, hitDist - CCD_SKIN);
+        pos.x += restX / len * keep;
+        pos.z += restZ / len * keep;
+        restX *= 1.0f - keep / len;
+        restZ *= 1.0f - keep / len;
+
+        // ㉺̖ (i̊pȂ) ɓAŎ~܂
+        float nLen = std::sqrt(normal.x * normal.x + normal.z * normal.z);
+        if (nLen < 1e-4f) break;
+        normal = { normal.x / nLen, 0.0f, normal.z / nLen };
+        move.normals[move.normalCount++] = normal;
+
+        // c̈ړAʂɌ菜 (ǂɉĊ)
+        float into = restX * normal.x + restZ * normal.z;
+        if (into < 0.0f) {
+            restX -= normal.x * into;
+            restZ -= normal.z * into;
+        }
+    }
+    // 񐔂g؂c̈ړ͎̂Ă (pɋ܂Ă)
+
+    // ŌɁAn_dȂĂ (ɉꂽ) 琅ɉo
+    // ʂ minTopY ȉ̔͏Ȃ̂ŉoȂ
+    auto recover = [&](EntityID boxID) {
+        if (colliderCache.aabbMax[boxID].y <= move.minTopY) return;
+        XMFLOAT3 push;
+        float gap;
+        ++scratch.testCount;
+        if (!ContactNarrowPhase(move.id, boxID, pos, push, gap)) return;
+        ++scratch.pushCount;
+        pos.x += push.x;
+        pos.z += push.z;
+        float pushLen = std::sqrt(push.x * push.x + push.z * push.z);
+        if (pushLen > 1e-6f && move.normalCount < CONTROLLER_ITERATIONS) {
+            move.normals[move.normalCount++] = { push.x / pushLen, 0.0f, push.z / pushLen };
+        }
+    };
+    const float reach = colliderCache.capRadius[move.id] + colliderCache.capHalfLen[move.id];
+    staticGrid.QuerySegment(pos, pos, reach, candidates);
+    scratch.candidateCount += (uint32_t)candidates.size();
+    for (uint32_t index : candidates) recover(staticBoxes.ids[index]);
+    for (uint32_t index = 0; index < (uint32_t)kinematicBoxes.Size(); ++index) recover(kinematicBoxes.ids[index]);
+
+    move.result = pos;
+}
+
+void PhysicsSystem::ApplyCharacterMove(const CharacterMove& move) {
+    if (move.normalCount == 0 && SameFloat3(move.result, move.to)) return;
+
+    auto registry = pWorld->GetRegistry();
+    auto& trans = registry->GetComponent<TransformComponent>(move.id);
+    trans.position.x = move.result.x;
+    trans.position.z = move.result.z;
+    RefreshCollider(move.id);
+
+    // ʂɌx (ʂɉx͎c)
+    XMFLOAT3* velocity = nullptr;
+    if (registry->HasComponent<PlayerComponent>(move.id)) {
+        velocity = &registry->GetComponent<PlayerComponent>(move.id).velocity;
+    }
+    else if (registry->HasComponent<PhysicsComponent>(move.id)) {
+        velocity = &registry->GetComponent<PhysicsComponent>(move.id).velocity;
+    }
+    if (!velocity) return;
+    for (int i = 0; i < move.normalCount; ++i) {
+        const XMFLOAT3& n = move.normals[i];
+        float into = velocity->x * n.x + velocity->z * n.z;
+        if (into < 0.0f) {
+            velocity->x -= n.x * into;
+            velocity->z -= n.z * into;
+        }
+    }
+}
+
+bool PhysicsSystem::SweepStatic(const XMFLOAT3& from, const XMFLOAT3& to, float radius,
+    float minTopY, float& outDist, std::vector<uint32_t>& candidates, XMFLOAT3* outNormal) const {
+    XMVECTOR move = XMLoadFloat3(&to) - XMLoadFloat3(&from);
+    float len = XMVectorGetX(XMVector3Length(move));
+    if (len < 1e-6f) return false;
+
+    Collision::RayQuery ray;
+    ray.origin = from;
+    XMStoreFloat3(&ray.direction, move / len);
+    ray.maxDist = len;
+    ray.radius = radius;
+
+    staticGrid.QuerySegment(from, to, radius, candidates);
+
+    const Collision::OBBSoA* hitBoxes = nullptr;
+    uint32_t hitIndex = 0;
+    outDist = len;
+    for (uint32_t index : candidates) {
+        if (colliderCache.aabbMax[staticBoxes.ids[index]].y <= minTopY) continue;
+        float dist;
+        if (!Collision::RaycastOBB(staticBoxes, index, ray, dist)) continue;
+        if (dist < 0.0f) continue; // n_ŏdȂĂ (o SlideCharacter ̍ŌɔC)
+        if (dist <= outDist) {
+            outDist = dist;
+            hitBoxes = &staticBoxes;
+            hitIndex = index;
+        }
+    }
+    // ̓ObhɓĂȂ̂őS
+    for (uint32_t index = 0; index < (uint32_t)kinematicBoxes.Size(); ++index) {
+        if (colliderCache.aabbMax[kinematicBoxes.ids[index]].y <= minTopY) continue;
+        float dist;
+        if (!Collision::RaycastOBB(kinematicBoxes, index, ray, dist)) continue;
+        if (dist < 0.0f) continue;
+        if (dist <= outDist) {
+            outDist = dist;
+            hitBoxes = &kinematicBoxes;
+            hitIndex = index;
+        }
+    }
+    if (!hitBoxes) return false;
+
+    // uԂ̋̒SAԂʂ߂
+    if (outNormal) {
+        XMFLOAT3 center;
+        XMStoreFloat3(&center, XMLoadFloat3(&from) + XMLoadFloat3(&ray.direction) * outDist);
+        *outNormal = Collision::OBBFaceNormal(*hitBoxes, hitIndex, center);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------
+// i[tF[Ỷ
+// -----------------------------------------------------------------------
+void PhysicsSystem::PrepareScratch(size_t targetCount) {
+    const size_t threads = pJobs ? pJobs->GetThreadCount() : 1;
+    if (scratch.size() != threads) scratch.resize(threads);
+    for (WorkerScratch& s : scratch) {
+        s.hitMask.resize(targetCount);
+        s.penetration.resize(targetCount);
+    }
+}
+
+template <class Func>
+void PhysicsSystem::RunParallel(size_t count, size_t grain, Func&& func) {
+    // [J[Ȃł[J[Ɠ֐IuWFNgzɌĂ
+    // (ڌĂԂƑ傫ȃ_ĂяoɓWJAȇ|2قǒxȂĂ)
+    const JobSystem::RangeFunc range(std::forward<Func>(func));
+    if (pJobs) pJobs->ParallelFor(count, grain, range);
+    else if (count > 0) range(size_t(0), count, 0u);
+}
+
+// Gl~[1̉̕o
+// ۂ̉o (ResolveContact) ͌ŃCXbhŝŁA
+// ł͉öʒu茳Ői߂Ď̑𔻒肷
+void PhysicsSystem::CollectContacts(EntityID id, WorkerScratch& s) const {
+    XMFLOAT3 pos = colliderCache.position[id];
+    const float reach = colliderCache.capRadius[id] + colliderCache.capHalfLen[id] + DYNAMIC_QUERY_MARGIN;
+    dynamicGrid.QuerySegment(pos, pos, reach, s.candidates);
+    s.candidateCount += (uint32_t)s.candidates.size();
+
+    //  dynamicBoxes ̔ԍ̏ = EntityID ̏ (菇ID̂܂)
+    ContactRecord record;
+    for (uint32_t index : s.candidates) {
+        EntityID otherID = dynamicBoxes.ids[index];
+        if (id == otherID) continue;
+        if (!ShouldResolve(id, otherID)) continue;
+        if (!FindContact(id, otherID, pos, record)) continue;
+        s.contacts.push_back(record);
+
+        // ResolveContact ƓZ (ʂVOXbhƃrbgPʂňv)
+        if (record.entry.hit) {
+            pos.x += record.entry.push.x;
+            pos.y += record.entry.push.y;
+            pos.z += record.entry.push.z;
+        }
+    }
+}
+
+const std::vector<PhysicsSystem::OverlapHit>& PhysicsSystem::FindOverlaps(const std::vector<OverlapQuery>& queries) {
+    for (WorkerScratch& s : scratch) s.overlaps.clear();
+    const size_t targetCount = targetBoxes.Size();
+
+    RunParallel(queries.size(), 8, [&](size_t begin, size_t end, unsigned thread) {
+        WorkerScratch& s = scratch[thread];
+        for (size_t q = begin; q < end; ++q) {
+            const OverlapQuery& query = queries[q];
+            s.testCount += (uint32_t)targetCount;
+            if (query.flat) {
+                // XZʂ̉~ (͌Ȃ): Ώۂ̒Sa
+                const float r2 = query.radius * query.radius;
+                for (size_t i = 0; i < targetCount; ++i) {
+                    const float dx = targetBoxes.cx[i] - query.center.x;
+                    const float dz = targetBoxes.cz[i] - query.center.z;
+                    s.hitMask[i] = (dx * dx + dz * dz < r2) ? 1 : 0;
+                }
+            }
+            else if (Collision::SphereOverlapBatch(targetBoxes, query.center, query.radius,
+                s.hitMask.data(), s.penetration.data()) == 0) continue;
+
+            for (size_t i = 0; i < targetCount; ++i) {
+                if (!s.hitMask[i]) continue;
+                EntityID targetID = targetBoxes.ids[i];
+                if (targetID == query.id) continue;
+                if (targetID == query.ownerID) continue;//ɂ͓ĂȂ
+                if (!layerMatrix.Collides(query.layer, colliderCache.layer[targetID])) continue;
+                // Eʕ̑́AOBB̊pɂ GJK ŗƂ
+                if (!query.flat && NeedsConvexCheck(targetID)) {
+                    ++s.testCount;
+                    Collision::ConvexContact contact;
+                    if (!Collision::ConvexOverlap(Collision::ConvexShape::Sphere(query.center, query.radius),
+                        ConvexShapeOf(targetID), contact)) continue;
+                }
+                s.overlaps.push_back({ (uint32_t)q, (uint32_t)i });
             }
         }
+    });
+
+    // ̏  Ώۂ̏ (= VOXbhŉ񂵂̏) ɕג
+    mergedOverlaps.clear();
+    for (const WorkerScratch& s : scratch) {
+        mergedOverlaps.insert(mergedOverlaps.end(), s.overlaps.begin(), s.overlaps.end());
     }
+    std::sort(mergedOverlaps.begin(), mergedOverlaps.end(), [](const OverlapHit& a, const OverlapHit& b) {
+        if (a.query != b.query) return a.query < b.query;
+        return a.target < b.target;
+    });
+    return mergedOverlaps;
+}
 
-    outDist = closestDist;
-    return hitAny;
+// -----------------------------------------------------------------------
+// gK[
+// -----------------------------------------------------------------------
+// gK[Ƃ̏dȂW (gK[ID << 32 | ID) ̏XgŎA
+// ̏dȂƓ˂킹 Enter/Stay/Exit 
+void PhysicsSystem::UpdateTriggers() {
+    auto registry = pWorld->GetRegistry();
+
+    overlapQueries.clear();
+    // gK[ (U/񕜔EUE񕜃X|bg) ͂ǂRC_[Ă
+    for (EntityID id : colliderIDs) {
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+        const auto& trans = registry->GetComponent<TransformComponent>(id);
+
+        if (registry->HasComponent<AttackBoxComponent>(id)) {
+            // UiƂ݂Ȃj
+            EnsureCollider(id);
+            const auto& box = registry->GetComponent<AttackBoxComponent>(id);
+            overlapQueries.push_back({ id, (EntityID)box.ownerID, trans.position, 0.5f * trans.scale.x, colliderCache.layer[id] });
+        }
+        else if (registry->HasComponent<RecoveryBoxComponent>(id)) {
+            // 񕜔iƂ݂Ȃj
+            EnsureCollider(id);
+            overlapQueries.push_back({ id, ECSConfig::INVALID_ID, trans.position, 0.5f * trans.scale.x, colliderCache.layer[id] });
+        }
+        else if (registry->HasComponent<AttackSphereComponent>(id)) {
+            // L锼agp
+            EnsureCollider(id);
+            const auto& sphere = registry->GetComponent<AttackSphereComponent>(id);
+            overlapQueries.push_back({ id, (EntityID)sphere.ownerID, trans.position, sphere.currentRadius, colliderCache.layer[id] });
+        }
+        else if (registry->HasComponent<RecoverySphereComponent>(id)) {
+            // 񕜃X|bg: {͕̂ǂƓÓIRC_[Ȃ̂ŁA͈͂̓R|[lg
+            // (XZʂ̋ < vC[̔a1.0 + X|bg̔a)
+            const auto& spot = registry->GetComponent<RecoverySphereComponent>(id);
+            if (!spot.isActive || spot.capacity <= 0) continue;
+            OverlapQuery query = { id, ECSConfig::INVALID_ID, trans.position, 1.0f + spot.radius, CollisionLayer::RecoverySphere };
+            query.flat = true;
+            overlapQueries.push_back(query);
+        }
+    }
+
+    // ̏dȂ (FindOverlaps  gK[Ώۏ ɕł̂ŁAL[)
+    currentTriggerPairs.clear();
+    for (const OverlapHit& hit : FindOverlaps(overlapQueries)) {
+        currentTriggerPairs.push_back(((uint64_t)overlapQueries[hit.query].id << 32) | targetBoxes.ids[hit.target]);
+    }
+    counters.hits += (uint32_t)currentTriggerPairs.size();
+
+    // OƂ̍
+    triggerEvents.clear();
+    size_t a = 0, b = 0;
+    while (a < triggerPairs.size() || b < currentTriggerPairs.size()) {
+        TriggerEvent ev;
+        if (b == currentTriggerPairs.size() || (a < triggerPairs.size() && triggerPairs[a] < currentTriggerPairs[b])) {
+            ev.phase = TriggerPhase::Exit;      // O񂾂 (ꂽ / ǂ炩)
+            ev.triggerID = (EntityID)(triggerPairs[a] >> 32);
+            ev.otherID = (EntityID)(triggerPairs[a] & 0xFFFFFFFFu);
+            ++a;
+        }
+        else if (a == triggerPairs.size() || currentTriggerPairs[b] < triggerPairs[a]) {
+            ev.phase = TriggerPhase::Enter;     // 񂾂
+            ev.triggerID = (EntityID)(currentTriggerPairs[b] >> 32);
+            ev.otherID = (EntityID)(currentTriggerPairs[b] & 0xFFFFFFFFu);
+            ++b;
+        }
+        else {
+            ev.phase = TriggerPhase::Stay;      // 
+            ev.triggerID = (EntityID)(currentTriggerPairs[b] >> 32);
+            ev.otherID = (EntityID)(currentTriggerPairs[b] & 0xFFFFFFFFu);
+            ++a; ++b;
+        }
+        triggerEvents.push_back(ev);
+    }
+    triggerPairs.swap(currentTriggerPairs);
 }
 
 // -----------------------------------------------------------------------
@@ -230,9 +998,19 @@ static bool RaycastGround(World* world, XMVECTOR origin, float maxDist, float& o
 // -----------------------------------------------------------------------
 void PhysicsSystem::Update(float dt) {
     auto registry = pWorld->GetRegistry();
+    counters = PhysicsCounters{};
+    PhaseTimer timer(counters);
+    PrepareScratch(targetBoxes.Size());
+    for (WorkerScratch& s : scratch) {
+        s.sweepCount = s.candidateCount = s.testCount = s.hitCount = s.pushCount = 0;
+    }
 
-    //GԂ̍XV
-    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+    // ÕXebvȍ~ɕt/RC_[ꗗɔf
+    // (ȉ̃[v͑S̈ꗗ񂷁B̑Ώۂ͂ǂRC_[Ă)
+    SyncColliders();
+
+    //GԂ̍XV (鑊̓RC_[Ȃ̂ŁAꗗő)
+    for (EntityID id : colliderIDs) {
         if (registry->HasComponent<StatusComponent>(id)) {
             auto& status = registry->GetComponent<StatusComponent>(id);
             if (status.invincibleTimer > 0.0f) {
@@ -241,10 +1019,16 @@ void PhysicsSystem::Update(float dt) {
         }
     }
 
+    // ---------------------------------------------------------
+    // ɏĂ镨̂^
+    // ( MovingSystem ̃Xebv̕ɓĂ)
+    // ---------------------------------------------------------
+    CarryRiders(dt);
+
     // ---------------------------------------------------------
     // ǉ: ړ[v (eȂǂ΂)
     // ---------------------------------------------------------
-    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+    for (EntityID id : colliderIDs) {
         // PhysicsComponent  TransformComponent ̂
         if (!registry->HasComponent<PhysicsComponent>(id)) continue;
         if (!registry->HasComponent<TransformComponent>(id)) continue;
@@ -252,7 +1036,22 @@ void PhysicsSystem::Update(float dt) {
         auto& phy = registry->GetComponent<PhysicsComponent>(id);
         auto& trans = registry->GetComponent<TransformComponent>(id);
 
+        // |̎n_ƂĐϕÖʒuoĂ
+        stepStart[id] = trans.position;
+
+        // Ă镨̂́Axt̃VXeɓ܂ŐϕȂ
+        if (sleep.sleeping[id]) {
+            if (LengthSq(phy.velocity) > SLEEP_VELOCITY * SLEEP_VELOCITY ||
+                DistSq(trans.position, sleep.restPosition[id]) > SLEEP_MOVE * SLEEP_MOVE) {
+                WakeBody(id);
+            }
+            else {
+                continue;
+            }
+        }
+
         // x(velocity)  ʒu(position) ɉZ
+        ++counters.integratedBodies;
         trans.position.x += phy.velocity.x * dt;
         trans.position.y += phy.velocity.y * dt;
         trans.position.z += phy.velocity.z * dt;
@@ -261,105 +1060,245 @@ void PhysicsSystem::Update(float dt) {
         if (phy.useGravity) {
             phy.velocity.y -= 9.8f * dt;
         }
-        // 3. ǉ: Gl~[̐ڒn (vC[ȊO)
-        // vC[͓Ǝ̔肪邽ߏO
-        if (!registry->HasComponent<PlayerComponent>(id) &&
-            registry->HasComponent<ColliderComponent>(id) &&
-            !registry->HasComponent<BulletComponent>(id)) 
-        {
-            // ̒ʂ̍ (SY - ̔)
-            float halfHeight = 0.5f * trans.scale.y; // XP[Y̔Ɖ
+    }
 
-            float rayDist = 0.0f;
-            XMVECTOR origin = XMLoadFloat3(&trans.position);
+    // ---------------------------------------------------------
+    // RC_[LbV̍XV
+    // ړς񂾂̎_ŁASRC_[OBB/ts/AABBm肳
+    // (ÓIȕǁE͓͂ςȂ̂ōČvZȂ)
+    // ---------------------------------------------------------
+    RefreshColliders();
+    // ǂ/ړȀŖĂ镨̂SN
+    // ( Kinematic Ȃ̂łɂ͗ȂB߂̂̕ CarryRiders ŋN)
+    if (staticsDirty) WakeAll();
+    BuildStaticGrid();
+    BuildKinematicBoxes();
+    timer.Lap(PhysicsPhase::Integrate);
 
-            // ܂ŃCLXg
-            bool hit = RaycastGround(pWorld, origin, halfHeight + 0.5f, rayDist);
+    // ---------------------------------------------------------
+    // LN^[Rg[[ (̑|Ɗ)
+    // vC[EGl~[ÕXebv瓮 (̃VXeœƃmbNobN) 
+    // ÓIRC_[Ɠɑ΂đ|AǂɓʂɉĊ点B
+    // ̓[J[ŕSAʂ݂̏IDɂ܂Ƃ߂čs
+    // ---------------------------------------------------------
+    characterMoves.clear();
+    for (EntityID id : colliderIDs) {
+        bool isEnemy = registry->HasComponent<EnemyComponent>(id);
+        bool isPlayer = registry->HasComponent<PlayerComponent>(id);
+        if (!isEnemy && !isPlayer) continue;
+        if (!registry->HasComponent<ColliderComponent>(id)) continue;
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
 
-            if (hit) {
-                // ڒn (nʂɋ߂Ȃڒn)
-                if (rayDist <= halfHeight + 0.1f) {
-                    // ʒu␳ (߂荞ݖh~)
-                    float groundY = trans.position.y - rayDist;
-                    trans.position.y = groundY + halfHeight;
+        const auto& trans = registry->GetComponent<TransformComponent>(id);
 
-                    // ~
-                    if (phy.velocity.y < 0) {
-                        phy.velocity.y = 0;
-                    }
+        // ҋ@ꏊŖĂĹAŌĂ΂邩܂Ŕ肵Ȃ
+        if (isPlayer && sleep.sleeping[id]) {
+            auto& pComp = registry->GetComponent<PlayerComponent>(id);
+            if (pComp.isActive ||
+                LengthSq(pComp.velocity) > SLEEP_VELOCITY * SLEEP_VELOCITY ||
+                DistSq(trans.position, sleep.restPosition[id]) > SLEEP_MOVE * SLEEP_MOVE) {
+                WakeBody(id);
+            }
+        }
+        // ĂԂn_͍XVĂ (Nŏ̈ړ|)
+        if (sleep.sleeping[id]) {
+            settledPosition[id] = trans.position;
+            settledFrame[id] = cacheFrame;
+            continue;
+        }
+        EnsureCollider(id);
+        if (!colliderCache.valid[id]) continue;
+
+        CharacterMove move = {};
+        move.id = id;
+        move.to = trans.position;
+        move.from = (settledFrame[id] + 1 == cacheFrame) ? settledPosition[id] : trans.position;
+        if (DistSq(move.from, move.to) > CONTROLLER_TELEPORT_DIST * CONTROLLER_TELEPORT_DIST) {
+            move.from = move.to;
+        }
+        move.from.y = move.to.y;
+        move.radius = colliderCache.capRadius[id];
+        move.minTopY = move.to.y - move.radius * 0.5f;
+        characterMoves.push_back(move);
+    }
+    RunParallel(characterMoves.size(), 16, [&](size_t begin, size_t end, unsigned thread) {
+        for (size_t i = begin; i < end; ++i) SlideCharacter(characterMoves[i], scratch[thread]);
+    });
+    for (const CharacterMove& move : characterMoves) ApplyCharacterMove(move);
+
+    // ̑ (LN^[Ep[c) ͊点̈ʒuœo^
+    BuildDynamicGrid();
+    timer.Lap(PhysicsPhase::Walls);
+
+    // ---------------------------------------------------------
+    // ڒnC̈ꊇ
+    // Gl~[ƃvC[̑C1̃ob`ɂ܂Ƃ߂Ĕ肷
+    // ---------------------------------------------------------
+    BuildGroundBoxes();
+    groundRays.clear();
+    groundRayOwners.clear();
+    riders.clear();
+
+    const XMFLOAT3 dirDown = { 0.0f, -1.0f, 0.0f }; // ^
+
+    // Gl~[ (vC[ȊO)
+    for (EntityID id : colliderIDs) {
+        if (!registry->HasComponent<PhysicsComponent>(id)) continue;
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+        if (!registry->HasComponent<ColliderComponent>(id)) continue;
+        // vC[͉œƎɐڒnBe͏ɋzȂ
+        // (ȊÕRC_[t̂́̕AGl~[łȂĂ RaycastGround Ɠڒn)
+        if (registry->HasComponent<PlayerComponent>(id)) continue;
+        if (registry->HasComponent<BulletComponent>(id)) continue;
+        // Ă镨̂͏̏Ŏ~܂Ă̂ŒׂȂ
+        if (sleep.sleeping[id]) continue;
+
+        auto& trans = registry->GetComponent<TransformComponent>(id);
+        // ̒ʂ̍ (SY - ̔)
+        float halfHeight = 0.5f * trans.scale.y; // XP[Y̔Ɖ
+
+        // ܂ŃCLXg
+        groundRays.push_back({ trans.position, dirDown, halfHeight + 0.5f });
+        groundRayOwners.push_back(id);
+    }
+    const size_t bodyRayCount = groundRays.size();
+
+    // vC[
+    // RA(̒S)瑫܂ł̗z̍
+    // EntityFactory bodyBaseY=0 ɂ̂ŁA -1.2f 炢ɂ
+    // VôŁAnʂRA܂ł̍ 2.0f (̉0.8f) 炢ɐݒ
+    const float hoverHeight = 2.0f;
+    for (EntityID id : colliderIDs) {
+        if (!registry->HasComponent<PlayerComponent>(id)) continue;
+        if (!registry->HasComponent<ColliderComponent>(id)) continue;
+
+        auto& trans = registry->GetComponent<TransformComponent>(id);
+
+        // ҋ@ꏊŖĂL (N̓Rg[[̏Ŕς)
+        if (sleep.sleeping[id]) continue;
+        // ߂ɒT: hoverHeight + 1.0f
+        groundRays.push_back({ trans.position, dirDown, hoverHeight + 1.0f });
+        groundRayOwners.push_back(id);
+    }
+
+    groundHits.resize(groundRays.size());
+    Collision::RaycastBatch(groundBoxes, groundRays.data(), groundHits.data(), groundRays.size());
+    counters.groundRays = (uint32_t)groundRays.size();
+    counters.narrowphaseTests += (uint32_t)(groundRays.size() * groundBoxes.Size());
+
+    // Gl~[̐ڒn
+    for (size_t i = 0; i < bodyRayCount; ++i) {
+        EntityID id = groundRayOwners[i];
+        auto& phy = registry->GetComponent<PhysicsComponent>(id);
+        auto& trans = registry->GetComponent<TransformComponent>(id);
+        float halfHeight = 0.5f * trans.scale.y;
+
+        const Collision::RayHit& hit = groundHits[i];
+        float rayDist = hit.distance;
+        bool grounded = false;
+        groundedOn[id] = ECSConfig::INVALID_ID;
+
+        if (hit.hit) {
+            // ڒn (nʂɋ߂Ȃڒn)
+            if (rayDist <= halfHeight + 0.1f) {
+                grounded = true;
+                SetGroundedOn(id, hit);
+                // ʒu␳ (߂荞ݖh~)
+                float groundY = trans.position.y - rayDist;
+                trans.position.y = groundY + halfHeight;
+                RefreshCollider(id);
+
+                // ~
+                if (phy.velocity.y < 0) {
+                    phy.velocity.y = 0;
+                }
 
-                    // C (mbNobN̊~߂)
-                    phy.velocity.x *= 0.9f;
-                    phy.velocity.z *= 0.9f;
+                // C (mbNobN̊~߂)
+                phy.velocity.x *= 0.9f;
+                phy.velocity.z *= 0.9f;
 
-                    // S~
-                    if (std::abs(phy.velocity.x) < 0.1f) phy.velocity.x = 0;
-                    if (std::abs(phy.velocity.z) < 0.1f) phy.velocity.z = 0;
-                }
+                // S~
+                if (std::abs(phy.velocity.x) < 0.1f) phy.velocity.x = 0;
+                if (std::abs(phy.velocity.z) < 0.1f) phy.velocity.z = 0;
             }
-            else {
-                // CȂĂY=0ȉɂ͗ƂȂS
-                if (trans.position.y < halfHeight) {
-                    trans.position.y = halfHeight;
-                    if (phy.velocity.y < 0) phy.velocity.y = 0;
-                    phy.velocity.x *= 0.9f;
-                    phy.velocity.z *= 0.9f;
-                }
+        }
+        else {
+            // CȂĂY=0ȉɂ͗ƂȂS
+            if (trans.position.y < halfHeight) {
+                grounded = true;
+                trans.position.y = halfHeight;
+                RefreshCollider(id);
+                if (phy.velocity.y < 0) phy.velocity.y = 0;
+                phy.velocity.x *= 0.9f;
+                phy.velocity.z *= 0.9f;
             }
         }
+
+        phy.isGrounded = grounded;
+
+        // ڒnĎ~܂ĂΖ鏀 (̏ł͖Ȃ)
+        bool resting = grounded && groundedOn[id] == ECSConfig::INVALID_ID &&
+            LengthSq(phy.velocity) < SLEEP_VELOCITY * SLEEP_VELOCITY;
+        UpdateSleep(id, resting, trans.position, dt);
     }
+    timer.Lap(PhysicsPhase::Ground);
 
     // ---------------------------------------------------------
-    // ǉ: Gl~[ƕǂ̏Փ˔
+    // ǉ: Gl~[ƃLN^[Ep[c̉
     // ---------------------------------------------------------
-    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+    // Eǂ̓Rg[[ōςł̂ŁA͓IObhŋ߂ɂ̂B
+    // Gl~[m͓Ȃ (Փ˃}gNX) ̂ŁA1̂ƗɔłB
+    // ̓[J[ŕSAoELbVXV̓Gl~[IDɂ܂Ƃ߂čs
+    resolveIDs.clear();
+    for (EntityID id : colliderIDs) {
         // Gl~[RC_[̂
         if (!registry->HasComponent<EnemyComponent>(id)) continue;
         if (!registry->HasComponent<ColliderComponent>(id)) continue;
+        // Ă镨̂͑ỎoŗĂ
+        if (sleep.sleeping[id]) continue;
 
-        // ׂ̂ẴIuWFNg(ǂȂ)Ɣ
-        for (EntityID otherID = 0; otherID < ECSConfig::MAX_ENTITIES; ++otherID) {
-            if (id == otherID) continue;
-
-            // 肪RC_[ĂȂA܂͒e/UȂ疳
-            if (!registry->HasComponent<ColliderComponent>(otherID)) continue;
-            if (registry->HasComponent<BulletComponent>(otherID)) continue;
-            if (registry->HasComponent<AttackBoxComponent>(otherID)) continue;
-            if (registry->HasComponent<AttackSphereComponent>(otherID)) continue;
+        EnsureCollider(id);
+        resolveIDs.push_back(id);
+    }
 
-            // Gl~[m̏Փ˂͔Hi͕ǔdȂ̂ŃXLbvĂOKj
-            if (registry->HasComponent<EnemyComponent>(otherID)) continue;
+    // (e/U/Gl~[m͏Փ˃}gNXŏO)
+    for (WorkerScratch& s : scratch) s.contacts.clear();
+    RunParallel(resolveIDs.size(), 4, [&](size_t begin, size_t end, unsigned thread) {
+        for (size_t i = begin; i < end; ++i) CollectContacts(resolveIDs[i], scratch[thread]);
+    });
 
-            // Փˉ (id  otherID 牟o)
-            CheckAndResolve(id, otherID);
-        }
+    // 1̌̕ʂ1̃Xbhɔ菇ŕł̂ŁAID̈\[gŌ̏ɖ߂
+    mergedContacts.clear();
+    for (const WorkerScratch& s : scratch) {
+        mergedContacts.insert(mergedContacts.end(), s.contacts.begin(), s.contacts.end());
     }
+    std::stable_sort(mergedContacts.begin(), mergedContacts.end(), [](const ContactRecord& a, const ContactRecord& b) {
+        return a.entityID < b.entityID;
+    });
+    // Փˉ (id  otherID 牟o)
+    for (const ContactRecord& record : mergedContacts) CommitContact(record);
+    timer.Lap(PhysicsPhase::EnemyContacts);
 
     // ---------------------------------------------------------
-    // vC[̕ (CLXgڒn + ̉o)
+    // vC[̕ (CLXgڒn + ߂̃LN^[Ƃ̉)
     // ---------------------------------------------------------
-    for (EntityID playerID = 0; playerID < ECSConfig::MAX_ENTITIES; ++playerID) {
-        if (!registry->HasComponent<PlayerComponent>(playerID)) continue;
-        if (!registry->HasComponent<ColliderComponent>(playerID)) continue;
+    // Čʂ͈ꊇς (bodyRayCount ȍ~vC[AID)
+    // ĂL̓CĂȂ̂ŁAC̎ŉ
+    for (size_t playerRay = bodyRayCount; playerRay < groundRays.size(); ++playerRay) {
+        EntityID playerID = groundRayOwners[playerRay];
 
         auto& pComp = registry->GetComponent<PlayerComponent>(playerID);
         auto& pTrans = registry->GetComponent<TransformComponent>(playerID);
 
         // 1. CLXgŒnʂT
-        // RA(̒S)瑫܂ł̗z̍
-        // EntityFactory bodyBaseY=0 ɂ̂ŁA -1.2f 炢ɂ
-        // VôŁAnʂRA܂ł̍ 2.0f (̉0.8f) 炢ɐݒ
-        float hoverHeight = 2.0f;
-        float rayDist = 0.0f;
-
-        XMVECTOR rayOrigin = XMLoadFloat3(&pTrans.position);
-
-        // CLXgs (߂ɒT: hoverHeight + 1.0f)
-        bool hitGround = RaycastGround(pWorld, rayOrigin, hoverHeight + 1.0f, rayDist);
+        const Collision::RayHit& groundHit = groundHits[playerRay];
+        bool hitGround = groundHit.hit;
+        float rayDist = groundHit.distance;
 
         if (hitGround && rayDist <= hoverHeight) {
             // ڒnĂI
             pComp.isGrounded = true;
+            SetGroundedOn(playerID, groundHit);
 
             // ␳ (Xibv)
             // ݂YW rayDist ̈ʒuɒnʂB
@@ -372,6 +1311,7 @@ void PhysicsSystem::Update(float dt) {
             // position.y = Lerp(position.y, targetY, 0.2f); // ȈLerp
             // ܂͒ڑăs^bƎ~߂
             pTrans.position.y = targetY;
+            RefreshCollider(playerID);
 
             // xZbg (Wv̓ZbgȂȂǂ̐䂪KvA
             // ł́unʂɋ߂ȂڒnvƂď)
@@ -382,343 +1322,480 @@ void PhysicsSystem::Update(float dt) {
         else {
             // 
             pComp.isGrounded = false;
+            groundedOn[playerID] = ECSConfig::INVALID_ID;
         }
 
-        // 2. ̏Փ˔ (ǂȂ)
-        for (EntityID otherID = 0; otherID < ECSConfig::MAX_ENTITIES; ++otherID) {
+        // 2. ߂̃LN^[Ep[cƂ̉ (ǂ̓Rg[[Ŋ点ς)
+        // Rg[[̍Ō̉o (SlideCharacter  recover) ɂ͓Ȃ:
+        //  - ͕ǁE琅ɉoŁApȂ̂Ń[J[ŉ񂹂B
+        //    ͐ڐG_[WEmbNobNENEɉꂽڒnA
+        //     ResolveContact ̏̂܂ܗv
+        //  - ̃Gl~[́ARg[[̌ɐڒnƃGl~[̉ňʒu܂B
+        //    Rg[[̎_ŉƁA܂Öʒu𑊎ɂ邱ƂɂȂ
+        // ͓IObhŋ߂ɂ̂Ȃ̂ŁA1l̔萔͏܂
+        EnsureCollider(playerID);
+        const float reach = colliderCache.capRadius[playerID] + colliderCache.capHalfLen[playerID] + DYNAMIC_QUERY_MARGIN;
+        std::vector<uint32_t>& nearby = scratch[0].candidates;
+        dynamicGrid.QuerySegment(pTrans.position, pTrans.position, reach, nearby);
+        counters.broadphaseCandidates += (uint32_t)nearby.size();
+        for (uint32_t index : nearby) {
+            EntityID otherID = dynamicBoxes.ids[index];
             if (playerID == otherID) continue;
-            if (!registry->HasComponent<ColliderComponent>(otherID)) continue;
-
-            // n(Ground)ƂOBBՓ˔́AYRaycastɔĈŖA
-            // uǁvGroundƂ蔲Ă܂B
-            // ȈՓI CheckAndResolve ĂԂAỶoLZȂǂ̍HvKvB
-            // ͊ CheckAndResolve ̂܂܎gAǂ@\B
-            // ( CheckAndResolve ɉグĂ܂ƃK^\)
-
             CheckAndResolve(playerID, otherID);
         }
-    }
-    // ---------------------------------------------------------
-    // Ũ[v
-    // ---------------------------------------------------------
-    for (EntityID attackID = 0; attackID < ECSConfig::MAX_ENTITIES; ++attackID) {
-        //AttackBoxComponentĂȂȂXLbv
-        if (!registry->HasComponent<AttackBoxComponent>(attackID)) continue;
-
-        //U̎擾
-        auto& attackBox = registry->GetComponent<AttackBoxComponent>(attackID);
-        EntityID ownerID = attackBox.ownerID;
 
-        //ΏۂT
-        for (EntityID targetID = 0; targetID < ECSConfig::MAX_ENTITIES; ++targetID) {
-            if (attackID == targetID) continue;
-            if (targetID == ownerID) continue;//ɂ͓ĂȂ
-
-            //RC_[ƃXe[^XĂ鑊肾Ώ
-            if (!registry->HasComponent<ColliderComponent>(targetID)) continue;
-            if (!registry->HasComponent<StatusComponent>(targetID)) continue;
+        // 삵ĂȂL~܂ĂΖ鏀 (ҋ@ꏊ̃LȂ)
+        bool resting = !pComp.isActive && groundedOn[playerID] == ECSConfig::INVALID_ID &&
+            LengthSq(pComp.velocity) < SLEEP_VELOCITY * SLEEP_VELOCITY;
+        UpdateSleep(playerID, resting, pTrans.position, dt);
+    }
 
-            //Փ˔聕_[W
-            CheckAttackHit(attackID, targetID);
-        }
+    // ̃Xebv̑|̎n_ (ڒnE܂ōς񂾈ʒu)
+    for (const CharacterMove& move : characterMoves) {
+        settledPosition[move.id] = registry->GetComponent<TransformComponent>(move.id).position;
+        settledFrame[move.id] = cacheFrame;
     }
+    timer.Lap(PhysicsPhase::Player);
+
     // ---------------------------------------------------------
-    // 4.񕜔̃[v
+    // gK[ (U//U/񕜃X|bg) ̏dȂ蔻
     // ---------------------------------------------------------
-    for (EntityID recoveryID = 0; recoveryID < ECSConfig::MAX_ENTITIES; ++recoveryID) {
-        if (!registry->HasComponent<RecoveryBoxComponent>(recoveryID)) continue;
+    // Ώۂ1񂾂SoAɋl߁ASgK[܂Ƃ߂Ĕ肵
+    // ÕXebvƂ̍ Enter/Stay/Exit CxgB
+    // UE񕜂̓Cxgď (rœ|ꂽΏۂ HasComponent Œe)
+    BuildTargetBoxes();
+    UpdateTriggers();
+    timer.Lap(PhysicsPhase::Triggers);
+
+    // dȂĂ (Enter/Stay) ͖XebvĂ (Aqbg͖GԂŖh)
+    //_[W
+    for (const TriggerEvent& ev : triggerEvents) {
+        if (ev.phase == TriggerPhase::Exit) continue;
+        if (!registry->HasComponent<AttackBoxComponent>(ev.triggerID)) continue;
+        //rœ|ꂽ͏O
+        if (!registry->HasComponent<StatusComponent>(ev.otherID)) continue;
+        ApplyAttackHit(ev.triggerID, ev.otherID);
+    }
+    timer.Lap(PhysicsPhase::Attack);
+    //  (g؂ŏAc̑Ώۂɂ HasComponent œȂ)
+    for (const TriggerEvent& ev : triggerEvents) {
+        if (ev.phase == TriggerPhase::Exit) continue;
+        if (!registry->HasComponent<RecoveryBoxComponent>(ev.triggerID)) continue;
+        if (!registry->HasComponent<StatusComponent>(ev.otherID)) continue;
+        ApplyRecoveryHit(ev.triggerID, ev.otherID);
+    }
+    timer.Lap(PhysicsPhase::Recovery);
+    // U
+    for (const TriggerEvent& ev : triggerEvents) {
+        if (ev.phase == TriggerPhase::Exit) continue;
+        if (!registry->HasComponent<AttackSphereComponent>(ev.triggerID)) continue;
+        if (!registry->HasComponent<StatusComponent>(ev.otherID)) continue;
+        ApplyAttackSphereHit(ev.triggerID, ev.otherID);
+    }
+    timer.Lap(PhysicsPhase::Sphere);
+    // 񕜃X|bg̃Cxg ActionSystem  GetTriggerEvents Ŏ󂯎
 
-        auto& recBox = registry->GetComponent<RecoveryBoxComponent>(recoveryID);
-        EntityID ownerID = recBox.ownerID;
+    // ---------------------------------------------------------
+    // C: e (Bullet) ̔胋[v (|)
+    // ---------------------------------------------------------
+    // e1XebvŔa蒷iނ̂ŁAϕÖʒu獡̈ʒu܂
+    // |ēTBǂɓAǂ艜̑ɂ͓ȂB
+    // |̓[J[ŕSASe̐ڐGXebv̎ɕׂĂ珈
+    bulletSweeps.clear();
+    for (EntityID bulletID : colliderIDs) {
+        if (!registry->HasComponent<BulletComponent>(bulletID)) continue;
 
-        // 񕜑ΏۂT (vC[̂ݑΏۂƂꍇ)
-        for (EntityID targetID = 0; targetID < ECSConfig::MAX_ENTITIES; ++targetID) {
-            if (recoveryID == targetID) continue;
+        auto& bullet = registry->GetComponent<BulletComponent>(bulletID);
+        if (!bullet.isActive) continue;
 
-            // vC[Xe[^XĂ
-            if (!registry->HasComponent<PlayerComponent>(targetID)) continue;
-            if (!registry->HasComponent<StatusComponent>(targetID)) continue;
-            if (!registry->HasComponent<ColliderComponent>(targetID)) continue;
+        auto& bTrans = registry->GetComponent<TransformComponent>(bulletID);
+        const XMFLOAT3 from = registry->HasComponent<PhysicsComponent>(bulletID) ? stepStart[bulletID] : bTrans.position;
+        EnsureCollider(bulletID);
+        bulletSweeps.push_back({ bulletID, from, bTrans.position, colliderCache.layer[bulletID] });
+    }
 
-            // 聕
-            CheckRecoveryHit(recoveryID, targetID);
+    for (WorkerScratch& s : scratch) s.bulletContacts.clear();
+    RunParallel(bulletSweeps.size(), 16, [&](size_t begin, size_t end, unsigned thread) {
+        WorkerScratch& s = scratch[thread];
+        const size_t targetCount = targetBoxes.Size();
+        for (size_t b = begin; b < end; ++b) {
+            const BulletSweep& sweep = bulletSweeps[b];
+            const XMFLOAT3& from = sweep.from;
+            const XMFLOAT3& to = sweep.to;
+
+            XMVECTOR move = XMLoadFloat3(&to) - XMLoadFloat3(&from);
+            float len = XMVectorGetX(XMVector3Length(move));
+
+            Collision::RayQuery ray;
+            ray.origin = from;
+            ray.radius = BULLET_RADIUS;
+            if (len > 1e-6f) XMStoreFloat3(&ray.direction, move / len);
+            else ray.direction = { 0.0f, 0.0f, 1.0f }; // ~܂Ăe͎n_ł̏dȂ肾
+
+            // 
+            float wallDist = len;
+            const bool sweepWalls = layerMatrix.Collides(sweep.layer, CollisionLayer::Static) ||
+                layerMatrix.Collides(sweep.layer, CollisionLayer::Kinematic);
+            bool hitWall = sweepWalls &&
+                SweepStatic(from, to, BULLET_RADIUS, -FLT_MAX, wallDist, s.candidates);
+            if (sweepWalls && len > 1e-6f) {
+                s.candidateCount += (uint32_t)s.candidates.size();
+                s.testCount += (uint32_t)(s.candidates.size() + kinematicBoxes.Size());
+            }
+            s.testCount += (uint32_t)targetCount;
+            ray.maxDist = wallDist;
+
+            auto pointAt = [&](float dist) {
+                return XMFLOAT3{ from.x + ray.direction.x * dist, from.y + ray.direction.y * dist, from.z + ray.direction.z * dist };
+            };
+            auto toiOf = [&](float dist) { return (len > 1e-6f) ? dist / len : 0.0f; };
+
+            // ǂȎ
+            if (Collision::SweepSphereBatch(targetBoxes, ray, s.hitMask.data(), s.penetration.data()) > 0) {
+                // |͈ (ǂ̎O܂) JvZɂ́BEʕ̑̊mFɎg
+                const float halfSweep = ray.maxDist * 0.5f;
+                const Collision::ConvexShape swept = Collision::ConvexShape::Capsule(
+                    pointAt(halfSweep), ray.direction, halfSweep, BULLET_RADIUS);
+                for (size_t i = 0; i < targetCount; ++i) {
+                    if (!s.hitMask[i]) continue;
+                    EntityID targetID = targetBoxes.ids[i];
+                    if (sweep.bulletID == targetID) continue;
+                    // vC[̒e -> Gl~[AG̒e -> vC[ (Փ˃}gNX)
+                    if (!layerMatrix.Collides(sweep.layer, colliderCache.layer[targetID])) continue;
+                    // 鎞 OBB ̒lg (ȂőŊp̕)
+                    if (NeedsConvexCheck(targetID)) {
+                        ++s.testCount;
+                        Collision::ConvexContact contact;
+                        if (!Collision::ConvexOverlap(swept, ConvexShapeOf(targetID), contact)) continue;
+                    }
+                    const float dist = s.penetration[i];
+                    s.bulletContacts.push_back({ toiOf(dist), sweep.bulletID, targetID, pointAt(dist) });
+                }
+            }
+            if (hitWall) {
+                s.bulletContacts.push_back({ toiOf(wallDist), sweep.bulletID, ECSConfig::INVALID_ID, pointAt(wallDist) });
+            }
         }
+    });
+
+    bulletContacts.clear();
+    for (const WorkerScratch& s : scratch) {
+        bulletContacts.insert(bulletContacts.end(), s.bulletContacts.begin(), s.bulletContacts.end());
     }
-    // U̔胋[v
-    for (EntityID attackID = 0; attackID < ECSConfig::MAX_ENTITIES; ++attackID) {
-        if (!registry->HasComponent<AttackSphereComponent>(attackID)) continue;
 
-        auto& sphere = registry->GetComponent<AttackSphereComponent>(attackID);
-        EntityID ownerID = sphere.ownerID;
+    //  (ȂeIDID) ɏ
+    // (L[SňقȂ̂ŁAXbh̕SɊ֌WȂɂȂ)
+    std::sort(bulletContacts.begin(), bulletContacts.end(), [](const BulletContact& a, const BulletContact& b) {
+        if (a.toi != b.toi) return a.toi < b.toi;
+        if (a.bulletID != b.bulletID) return a.bulletID < b.bulletID;
+        return a.targetID < b.targetID;
+    });
+
+    for (const BulletContact& contact : bulletContacts) {
+        EntityID bulletID = contact.bulletID;
+        EntityID targetID = contact.targetID;
+        if (!registry->HasComponent<BulletComponent>(bulletID)) continue;
+        auto& bullet = registry->GetComponent<BulletComponent>(bulletID);
+        if (!bullet.isActive) continue;
+
+        // : ʒuŏ
+        if (targetID == ECSConfig::INVALID_ID) {
+            EntityFactory::CreateHitEffect(pWorld, contact.point, 3, { 0.8f, 0.8f, 0.8f, 1.0f });
+            bullet.isActive = false;
+            pWorld->DestroyEntity(bulletID);
+            continue;
+        }
 
-        for (EntityID targetID = 0; targetID < ECSConfig::MAX_ENTITIES; ++targetID) {
-            if (attackID == targetID) continue;
-            if (targetID == ownerID) continue;
-            if (!registry->HasComponent<ColliderComponent>(targetID)) continue;
-            if (!registry->HasComponent<StatusComponent>(targetID)) continue;
+        // ɏeœ|Ă邩Ȃ
+        if (!registry->HasComponent<StatusComponent>(targetID)) continue;
 
-            // Spherep̔֐Ă
-            CheckAttackSphereHit(attackID, targetID);
+        // GtFNgڐGʒuɏo悤ɁAeꎞIɐڐGʒu֒u
+        auto& bTrans = registry->GetComponent<TransformComponent>(bulletID);
+        XMFLOAT3 endPos = bTrans.position;
+        bTrans.position = contact.point;
+        ApplyBulletHit(bulletID, targetID);
+        if (registry->HasComponent<BulletComponent>(bulletID) && bullet.isActive) {
+            bTrans.position = endPos; // Gőfʂ肵
         }
     }
+    counters.hits += (uint32_t)bulletContacts.size();
+    timer.Lap(PhysicsPhase::Bullet);
+
     // ---------------------------------------------------------
-    // ǉ: e (Bullet) ̔胋[v
+    // nƓv
     // ---------------------------------------------------------
-    for (EntityID bulletID = 0; bulletID < ECSConfig::MAX_ENTITIES; ++bulletID) {
-        if (!registry->HasComponent<BulletComponent>(bulletID)) continue;
-
-        auto& bullet = registry->GetComponent<BulletComponent>(bulletID);
-        if (!bullet.isActive) continue;
+    // ̃XebvŎgȂyÂ͎Ă (ɋ߂Âɔ肵)
+    for (auto it = contactCache.begin(); it != contactCache.end();) {
+        if (it->second.frame != cacheFrame) it = contactCache.erase(it);
+        else ++it;
+    }
 
-        if (bullet.fromPlayer) {
-            // --- vC[̒e -> Gl~[ɓ ---
-            for (EntityID targetID = 0; targetID < ECSConfig::MAX_ENTITIES; ++targetID) {
-                if (bulletID == targetID) continue;
-                // GRC_[
-                if (!registry->HasComponent<EnemyComponent>(targetID)) continue;
-                if (!registry->HasComponent<ColliderComponent>(targetID)) continue;
-                if (!registry->HasComponent<StatusComponent>(targetID)) continue;
-
-                // 
-                CheckBulletHit(bulletID, targetID);
-                if (!bullet.isActive) break;
-            }
-        }
-        else {
-            // --- G̒e -> vC[ɓ () ---
-            for (EntityID targetID = 0; targetID < ECSConfig::MAX_ENTITIES; ++targetID) {
-                if (bulletID == targetID) continue;
-                // vC[RC_[
-                if (!registry->HasComponent<PlayerComponent>(targetID)) continue;
-                if (!registry->HasComponent<ColliderComponent>(targetID)) continue;
-                if (!registry->HasComponent<StatusComponent>(targetID)) continue;
-
-                // 
-                CheckBulletHit(bulletID, targetID);
-                if (!bullet.isActive) break;
-            }
-        }
+    counters.sleepingBodies = 0;
+    counters.awakeBodies = 0;
+    for (EntityID id : colliderIDs) {
+        if (!registry->HasComponent<PhysicsComponent>(id) &&
+            !registry->HasComponent<PlayerComponent>(id)) continue;
+        if (sleep.sleeping[id]) ++counters.sleepingBodies;
+        else ++counters.awakeBodies;
+    }
+    for (const WorkerScratch& s : scratch) {
+        counters.characterSweeps += s.sweepCount;
+        counters.broadphaseCandidates += s.candidateCount;
+        counters.narrowphaseTests += s.testCount;
+        counters.hits += s.hitCount;
+        counters.pushes += s.pushCount;
     }
+    timer.Lap(PhysicsPhase::Integrate);
+    timer.Finish();
+    statsHistory.Push(counters);
 }
 
 // -----------------------------------------------------------------------
 // Փ˔̎ (CheckAndResolve)
 // -----------------------------------------------------------------------
 void PhysicsSystem::CheckAndResolve(EntityID entityID, EntityID otherID) {
-    auto registry = pWorld->GetRegistry();
+    EnsureCollider(otherID);
+    EnsureCollider(entityID);
 
-    // 肪uU{bNXvu񕜃{bNXvȂAIȏՓˏioj͈؂Ȃ
-    if (registry->HasComponent<AttackBoxComponent>(otherID)) return;
-    if (registry->HasComponent<RecoveryBoxComponent>(otherID)) return;
-    if (registry->HasComponent<AttackSphereComponent>(otherID)) return;
-    if (registry->HasComponent<RecoverySphereComponent>(otherID)) return;
-    if (registry->HasComponent<BulletComponent>(otherID)) return;
+    // U//e (gK[) AȂC[mȂ牟o͈؂Ȃ
+    if (!ShouldResolve(entityID, otherID)) return;
 
-    auto& otherCol = registry->GetComponent<ColliderComponent>(otherID);
-    if (otherCol.type == ColliderType::Type_None) return;
+    ContactRecord record;
+    if (!FindContact(entityID, otherID, colliderCache.position[entityID], record)) return;
+    CommitContact(record);
+}
 
-    // 肪ũp[cvȂ疳 (ȏՓ˖h~)
-    if (registry->HasComponent<PlayerPartComponent>(otherID)) {
-        auto& part = registry->GetComponent<PlayerPartComponent>(otherID);
-        if (part.parentID == (int)entityID) {
-            return; // ̑̂̈ꕔȂ̂ŏՓ˂Ȃ
-        }
+bool PhysicsSystem::FindContact(EntityID entityID, EntityID otherID, const XMFLOAT3& posA, ContactRecord& out) const {
+    // `̓LbVǂ (Type_None  valid=0)
+    const ColliderCache& cache = colliderCache;
+
+    // --- p (R|[lgO) ---
+    // JvZ̊Oڋ vs OBB̊OڋAăJvZAABB vs OBBAABB
+    //  distSq < r^2 + 0.0001 Ȃ̂ŁA (0.01) ]T
+    {
+        const XMFLOAT3& bp = posA;
+        const XMFLOAT3& op = cache.position[otherID];
+        const float capR = cache.capRadius[entityID] + 0.01f;
+        const float capY = cache.capHalfLen[entityID] + capR;
+
+        const float dx = bp.x - op.x, dy = bp.y - op.y, dz = bp.z - op.z;
+        const float reach = capY + cache.sphereRadius[otherID];
+        if (dx * dx + dy * dy + dz * dz > reach * reach) return false;
+
+        const XMFLOAT3& mn = cache.aabbMin[otherID];
+        const XMFLOAT3& mx = cache.aabbMax[otherID];
+        if (bp.x + capR < mn.x || bp.x - capR > mx.x) return false;
+        if (bp.y + capY < mn.y || bp.y - capY > mx.y) return false;
+        if (bp.z + capR < mn.z || bp.z - capR > mx.z) return false;
     }
 
-    auto& pTrans = registry->GetComponent<TransformComponent>(entityID);
-    auto& pCol = registry->GetComponent<ColliderComponent>(entityID);
-    auto& pComp = registry->GetComponent<PlayerComponent>(entityID);
-
-    OBB boxOBB = GetOBB(otherID);
-
-    // OBBs[h
-    XMMATRIX boxWorld = XMLoadFloat4x4(&boxOBB.worldMatrix);
-    XMVECTOR det;
-    XMMATRIX boxInvWorld = XMMatrixInverse(&det, boxWorld);
-
-    // vC[̃JvZ`
-    float pRadius = pCol.radius * pTrans.scale.x;
-    float pHeight = pCol.height * pTrans.scale.y;
-    // JvZčvZ
-    float cylinderLen = std::max<float>(0.0f, pHeight - 2.0f * pRadius);
-    float halfLen = cylinderLen * 0.5f;
-    XMVECTOR pos = XMLoadFloat3(&pTrans.position);
-    XMVECTOR up = XMVectorSet(0, 1, 0, 0);
-    // ]lꍇ
-    XMVECTOR pStartW = pos - up * halfLen;
-    XMVECTOR pEndW = pos + up * halfLen;
-
-    float radius = pRadius;
-    float maxPenetration = -1.0f;
-    XMVECTOR finalPushW = XMVectorZero();
-    bool isHit = false;
-
-    // --- [A] JvZ vs  ([J) ---
-    XMVECTOR pStartL = XMVector3TransformCoord(pStartW, boxInvWorld);
-    XMVECTOR pEndL = XMVector3TransformCoord(pEndW, boxInvWorld);
-    float hx = boxOBB.extents.x;
-    float hy = boxOBB.extents.y;
-    float hz = boxOBB.extents.z;
-
-    XMVECTOR segmentVec = pEndL - pStartL;
-    float segLen = XMVectorGetX(XMVector3Length(segmentVec));
-    // 薧x
-    int steps = static_cast<int>(segLen / (radius * 0.05f)) + 2;
-
-    for (int i = 0; i < steps; ++i) {
-        float t = (float)i / (steps - 1);
-        if (steps <= 1) t = 0.5f;
-        XMVECTOR pointL = pStartL + segmentVec * t;
-        XMFLOAT3 p; XMStoreFloat3(&p, pointL);
-
-        float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
-        float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
-        float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
-
-        float dx = p.x - cx; float dy = p.y - cy; float dz = p.z - cz;
-        float distSq = dx * dx + dy * dy + dz * dz;
-
-        if (distSq < (radius * radius) + 0.0001f) {
-            float dist = std::sqrt(distSq);
-            float pen = radius - dist;
-            if (pen <= 0.0f) pen = 0.001f;
-            XMVECTOR pushL;
-            if (dist > 0.00001f) {
-                pushL = XMVectorSet(dx / dist, dy / dist, dz / dist, 0);
-            }
-            else {
-                float dX = hx - std::abs(p.x); float dY = hy - std::abs(p.y); float dZ = hz - std::abs(p.z);
-                if (dX < dY && dX < dZ) pushL = XMVectorSet((p.x > 0 ? 1.0f : -1.0f), 0, 0, 0);
-                else if (dY < dZ)       pushL = XMVectorSet(0, (p.y > 0 ? 1.0f : -1.0f), 0, 0);
-                else                    pushL = XMVectorSet(0, 0, (p.z > 0 ? 1.0f : -1.0f), 0);
-                pen = radius + std::min({ dX, dY, dZ });
-            }
-            if (pen > maxPenetration) {
-                maxPenetration = pen;
-                finalPushW = XMVector3TransformNormal(pushL, boxWorld) * pen;
-                isHit = true;
+    // 肪ũp[cvȂ疳 (ȏՓ˖h~)
+    // p[c̐e̓vC[Ȃ̂ŁAGl~[̔ ([J[) ł̓R|[lgȂ
+    if (cache.layer[entityID] == CollisionLayer::Player &&
+        cache.layer[otherID] == CollisionLayer::PlayerPart) {
+        auto registry = pWorld->GetRegistry();
+        if (registry->HasComponent<PlayerPartComponent>(otherID)) {
+            auto& part = registry->GetComponent<PlayerPartComponent>(otherID);
+            if (part.parentID == (int)entityID) {
+                return false; // ̑̂̈ꕔȂ̂ŏՓ˂Ȃ
             }
         }
     }
 
-    // --- [B & C] 12{̕ vs JvZ̐c ([h) ---
-    XMFLOAT3 c[8] = {
-        {-hx,-hy,-hz}, { hx,-hy,-hz}, {-hx, hy,-hz}, { hx, hy,-hz},
-        {-hx,-hy, hz}, { hx,-hy, hz}, {-hx, hy, hz}, { hx, hy, hz}
-    };
-    XMVECTOR v[8];
-    for (int i = 0; i < 8; ++i) v[i] = XMVector3TransformCoord(XMLoadFloat3(&c[i]), boxWorld);
+    out.entityID = entityID;
+    out.otherID = otherID;
+    out.key = ((uint64_t)entityID << 32) | otherID;
+
+    // --- ڐGLbV ---
+    // O񔻒肵痼҂قƂǓĂȂ΁Aʂg
+    //  hit : ҂̈ړ CONTACT_REUSE_DIST Ȃ瓯oKp
+    //  miss: ҂̈ړʂ̍vǑԂ菬΁A܂Ă
+    const XMFLOAT3& posB = cache.position[otherID];
+    auto found = contactCache.find(out.key);
+    if (found != contactCache.end() && SameFloat3(found->second.rotB, cache.rotation[otherID])) {
+        const ContactEntry& entry = found->second;
+        float moveA = std::sqrt(DistSq(posA, entry.posA));
+        float moveB = std::sqrt(DistSq(posB, entry.posB));
+        bool reuse = entry.hit
+            ? (moveA < CONTACT_REUSE_DIST && moveB < CONTACT_REUSE_DIST)
+            : (moveA + moveB < entry.gap);
+        if (reuse) {
+            out.entry = entry;
+            out.entry.frame = cacheFrame;
+            out.reused = true;
+            return true;
+        }
+    }
 
-    int edges[12][2] = {
-        {0,1}, {2,3}, {4,5}, {6,7}, // X
-        {0,2}, {1,3}, {4,6}, {5,7}, // Y
-        {0,4}, {1,5}, {2,6}, {3,7}  // Z
-    };
+    out.entry.posA = posA;
+    out.entry.posB = posB;
+    out.entry.rotB = cache.rotation[otherID];
+    out.entry.frame = cacheFrame;
+    out.entry.hit = ContactNarrowPhase(entityID, otherID, posA, out.entry.push, out.entry.gap);
+    out.reused = false;
+    return true;
+}
 
-    for (int i = 0; i < 12; ++i) {
-        XMVECTOR edgeP1 = v[edges[i][0]];
-        XMVECTOR edgeP2 = v[edges[i][1]];
+void PhysicsSystem::CommitContact(const ContactRecord& record) {
+    if (record.reused) {
+        ++counters.contactCacheHits;
+        contactCache[record.key].frame = cacheFrame;
+    }
+    else {
+        ++counters.contactCacheMisses;
+        ++counters.narrowphaseTests;
+        contactCache[record.key] = record.entry;
+    }
 
-        XMVECTOR ptOnCapsule, ptOnBoxEdge;
-        float distSq = SegmentToSegmentDistSq(pStartW, pEndW, edgeP1, edgeP2, ptOnCapsule, ptOnBoxEdge);
+    if (record.entry.hit) {
+        ++counters.hits;
+        ++counters.pushes;
+        ResolveContact(record.entityID, record.otherID, record.entry.push);
+    }
+}
 
-        if (distSq < radius * radius) {
-            float dist = std::sqrt(distSq);
-            float pen = radius - dist;
+// -----------------------------------------------------------------------
+// JvZc() vs OBB ([J, )
+// -----------------------------------------------------------------------
+bool PhysicsSystem::ContactNarrowPhase(EntityID entityID, EntityID otherID, const XMFLOAT3& posA,
+    XMFLOAT3& outPush, float& outGap) const {
+    const ColliderCache& cache = colliderCache;
+
+    // 肪ȊO (EJvZEʕ) Ȃ GJK/EPA
+    if (NeedsConvexCheck(otherID)) {
+        const Collision::ConvexShape self = Collision::ConvexShape::Capsule(
+            posA, { 0.0f, 1.0f, 0.0f }, cache.capHalfLen[entityID], cache.capRadius[entityID]);
+        Collision::ConvexContact contact;
+        const bool hit = Collision::ConvexOverlap(self, ConvexShapeOf(otherID), contact);
+        outGap = contact.distance;
+        if (!hit) {
+            outPush = { 0.0f, 0.0f, 0.0f };
+            return false;
+        }
+        const float pen = std::max(-contact.distance, 0.001f);
+        outPush = { contact.normal.x * pen, contact.normal.y * pen, contact.normal.z * pen };
+        return true;
+    }
 
-            XMVECTOR pushDirW;
-            if (dist > 0.00001f) {
-                pushDirW = (ptOnCapsule - ptOnBoxEdge) / dist;
-            }
-            else {
-                XMVECTOR center = XMVector3TransformCoord(XMVectorZero(), boxWorld);
-                pushDirW = XMVector3Normalize(ptOnCapsule - center);
-            }
+    // OBB (vZς݂̍sƋts) vs JvZc ()
+    const XMFLOAT3 segStart = { posA.x, posA.y - cache.capHalfLen[entityID], posA.z };
+    const XMFLOAT3 segEnd = { posA.x, posA.y + cache.capHalfLen[entityID], posA.z };
+    return Collision::CapsuleOBBContact(segStart, segEnd, cache.capRadius[entityID],
+        cache.world[otherID], cache.invWorld[otherID], cache.extents[otherID], outPush, outGap);
+}
 
-            if (pen > maxPenetration) {
-                maxPenetration = pen;
-                finalPushW = pushDirW * pen;
-                isHit = true;
-            }
-        }
+Collision::ConvexShape PhysicsSystem::ConvexShapeOf(EntityID id) const {
+    const ColliderCache& c = colliderCache;
+    switch (c.type[id]) {
+    case ColliderType::Type_Sphere:
+        return Collision::ConvexShape::Sphere(c.position[id], c.capRadius[id]);
+    case ColliderType::Type_Capsule: {
+        // c͎̃[JY (]Ă钌Ȃ)
+        const XMFLOAT4X4& m = c.world[id];
+        return Collision::ConvexShape::Capsule(c.position[id], { m.m[1][0], m.m[1][1], m.m[1][2] },
+            c.capHalfLen[id], c.capRadius[id]);
     }
+    case ColliderType::Type_Hull: {
+        const HullPoints& hull = HullPointsOf(c.hullShape[id]);
+        const XMFLOAT3 scale = {
+            c.size[id].x * c.scale[id].x, c.size[id].y * c.scale[id].y, c.size[id].z * c.scale[id].z
+        };
+        return Collision::ConvexShape::Hull(c.world[id], scale, hull.points.data(), (uint32_t)hull.points.size());
+    }
+    default:
+        return Collision::ConvexShape::Box(c.world[id], c.extents[id]);
+    }
+}
 
-    // --- Փˉ ---
-    if (isHit) {
-        // ---------------------------------------------------------
-        // _[WƏŏ
-        // ---------------------------------------------------------
-        // 肪vC[Ȃ_[WXLbvI (ǉ)
-        bool isTargetPlayer = registry->HasComponent<PlayerComponent>(otherID);
-        // 肪 StatusComponent (HP) ĂāAvC[ł͂Ȃꍇ̂݃_[W
-        if (!isTargetPlayer && registry->HasComponent<StatusComponent>(otherID)) {
+// -----------------------------------------------------------------------
+// ڐG̏ (_[WƉo)
+// -----------------------------------------------------------------------
+void PhysicsSystem::ResolveContact(EntityID entityID, EntityID otherID, const XMFLOAT3& push) {
+    auto registry = pWorld->GetRegistry();
+
+    auto& pTrans = registry->GetComponent<TransformComponent>(entityID);
+    auto& pComp = registry->GetComponent<PlayerComponent>(entityID);
+    const XMFLOAT3& boxCenter = colliderCache.position[otherID];
+    XMVECTOR pos = XMLoadFloat3(&pTrans.position);
+    XMVECTOR finalPushW = XMLoadFloat3(&push);
 
-            // (vC[)Xe[^XĂȂ_[WvZ
-            if (registry->HasComponent<StatusComponent>(entityID)) {
-                auto& playerStatus = registry->GetComponent<StatusComponent>(entityID);
-                auto& enemyStatus = registry->GetComponent<StatusComponent>(otherID);
+    // Gꂽ肪ĂN
+    WakeBody(otherID);
 
-                // vC[̖GԂȂΐH炤
-                if (playerStatus.invincibleTimer <= 0.0f) {
+    // ---------------------------------------------------------
+    // _[WƏŏ
+    // ---------------------------------------------------------
+    // 肪vC[Ȃ_[WXLbvI (ǉ)
+    bool isTargetPlayer = registry->HasComponent<PlayerComponent>(otherID);
+    // 肪 StatusComponent (HP) ĂāAvC[ł͂Ȃꍇ̂݃_[W
+    if (!isTargetPlayer && registry->HasComponent<StatusComponent>(otherID)) {
 
-                    // G̍U͂΂gBȂΌŒl10
-                    int damage = (enemyStatus.attackPower > 0) ? enemyStatus.attackPower : 10;
+        // (vC[)Xe[^XĂȂ_[WvZ
+        if (registry->HasComponent<StatusComponent>(entityID)) {
+            auto& playerStatus = registry->GetComponent<StatusComponent>(entityID);
+            auto& enemyStatus = registry->GetComponent<StatusComponent>(otherID);
 
-                    playerStatus.TakeDamage(damage);
-                    DebugLog("OUCH! Player Hit by Enemy! HP: %d", playerStatus.hp);
+            // vC[̖GԂȂΐH炤
+            if (playerStatus.invincibleTimer <= 0.0f) {
 
-                    // vC[Gɂ
-                    playerStatus.invincibleTimer = 1.0f;
+                // G̍U͂΂gBȂΌŒl10
+                int damage = (enemyStatus.attackPower > 0) ? enemyStatus.attackPower : 10;
 
-                    // mbNobN (΂ߌ֋e)
-                    XMVECTOR enemyPos = XMLoadFloat3(&boxOBB.center);
-                    XMVECTOR myPos = pos;
+                playerStatus.TakeDamage(damage);
+                DebugLog("OUCH! Player Hit by Enemy! HP: %d", playerStatus.hp);
 
-                    // G玩ւ̃xNg (̂ݐKČޕƂ)
-                    XMVECTOR dir = myPos - enemyPos;
-                    dir = XMVectorSetY(dir, 0.0f); // Y
-                    dir = XMVector3Normalize(dir);
+                // vC[Gɂ
+                playerStatus.invincibleTimer = 1.0f;
 
-                    // ΂ߏ֒e (15, ㏸10)
-                    XMVECTOR knockbackVel = dir * 15.0f;
-                    knockbackVel = XMVectorSetY(knockbackVel, 10.0f);
+                // mbNobN (΂ߌ֋e)
+                XMVECTOR enemyPos = XMLoadFloat3(&boxCenter);
+                XMVECTOR myPos = pos;
 
-                    XMStoreFloat3(&pComp.velocity, knockbackVel);
+                // G玩ւ̃xNg (̂ݐKČޕƂ)
+                XMVECTOR dir = myPos - enemyPos;
+                dir = XMVectorSetY(dir, 0.0f); // Y
+                dir = XMVector3Normalize(dir);
 
-                    // ڒntO (󒆂ɔ΂)
-                    pComp.isGrounded = false;
-                }
-            }
-        }
-        XMVECTOR currentPos = XMLoadFloat3(&pTrans.position);
-        currentPos += finalPushW;
-        XMStoreFloat3(&pTrans.position, currentPos);
+                // ΂ߏ֒e (15, ㏸10)
+                XMVECTOR knockbackVel = dir * 15.0f;
+                knockbackVel = XMVectorSetY(knockbackVel, 10.0f);
 
-        XMVECTOR v = XMLoadFloat3(&pComp.velocity);
-        XMVECTOR pushDir = XMVector3Normalize(finalPushW);
+                XMStoreFloat3(&pComp.velocity, knockbackVel);
 
-        float dot = XMVectorGetX(XMVector3Dot(v, pushDir));
-        if (dot < 0.0f) {
-            v = v - pushDir * dot;
-            XMStoreFloat3(&pComp.velocity, v);
+                // ڒntO (󒆂ɔ΂)
+                pComp.isGrounded = false;
+            }
         }
+    }
+    XMVECTOR currentPos = XMLoadFloat3(&pTrans.position);
+    currentPos += finalPushW;
+    XMStoreFloat3(&pTrans.position, currentPos);
+    RefreshCollider(entityID); // ̂ŃLbVXV
+
+    XMVECTOR v = XMLoadFloat3(&pComp.velocity);
+    XMVECTOR pushDir = XMVector3Normalize(finalPushW);
+
+    float dot = XMVectorGetX(XMVector3Dot(v, pushDir));
+    if (dot < 0.0f) {
+        v = v - pushDir * dot;
+        XMStoreFloat3(&pComp.velocity, v);
+    }
 
-        if (XMVectorGetY(finalPushW) > 0.001f) {
-            if (XMVectorGetY(pushDir) > 0.6f) {
-                pComp.isGrounded = true;
-            }
+    if (XMVectorGetY(finalPushW) > 0.001f) {
+        if (XMVectorGetY(pushDir) > 0.6f) {
+            pComp.isGrounded = true;
         }
-        else if (XMVectorGetY(finalPushW) < -0.001f) {
-            if (XMVectorGetY(pushDir) < -0.6f && pComp.velocity.y > 0) {
-                pComp.velocity.y = 0;
-            }
+    }
+    else if (XMVectorGetY(finalPushW) < -0.001f) {
+        if (XMVectorGetY(pushDir) < -0.6f && pComp.velocity.y > 0) {
+            pComp.velocity.y = 0;
         }
     }
 }
 // -----------------------------------------------------------------------
-// U̎ (CheckAttackHit)
+// Uqbg̏ (ApplyAttackHit)
 // -----------------------------------------------------------------------
-void PhysicsSystem::CheckAttackHit(EntityID attackID, EntityID targetID){
+void PhysicsSystem::ApplyAttackHit(EntityID attackID, EntityID targetID){
     auto registry = pWorld->GetRegistry();
 
     if (registry->HasComponent<ColliderComponent>(targetID)) {
@@ -736,148 +1813,115 @@ void PhysicsSystem::CheckAttackHit(EntityID attackID, EntityID targetID){
     // uvƁu^[Qbgv́ivC[A܂͗GjȂ画肵Ȃ
     if (isOwnerPlayer == isTargetPlayer) return;
 
-    //U
+    // mbNobN̊
     auto& aTrans = registry->GetComponent<TransformComponent>(attackID);
-    float radius = 0.5f * aTrans.scale.x;
     XMVECTOR attackPos = XMLoadFloat3(&aTrans.position);
 
-    //OBB
-    OBB targetOBB = GetOBB(targetID);
-    XMMATRIX targetWorld = XMLoadFloat4x4(&targetOBB.worldMatrix);
-    XMVECTOR det;
-    XMMATRIX targetInvWorld = XMMatrixInverse(&det, targetWorld);
+    auto& targetStatus = registry->GetComponent<StatusComponent>(targetID);
 
-    //胍WbN
-    XMVECTOR centerL = XMVector3TransformCoord(attackPos, targetInvWorld);
-    XMFLOAT3 p; XMStoreFloat3(&p, centerL);
+    if (targetStatus.invincibleTimer <= 0.0f) {
+        targetStatus.TakeDamage(attackBox.damage);
+        targetStatus.invincibleTimer = 0.5f;
+        DebugLog("Hit! Target:%d Dmg:%d HP:%d", targetID, attackBox.damage, targetStatus.hp);
+        if (registry->HasComponent<TransformComponent>(targetID)) {
+            auto& tTrans = registry->GetComponent<TransformComponent>(targetID);
+            EntityFactory::CreateHitEffect(pWorld, tTrans.position, 8, { 1.0f, 0.5f, 0.0f, 1.0f });
+
+            // Gl~[|͂ɔhɁI
+            if (targetStatus.IsDead()) {
+                EntityFactory::CreateHitEffect(pWorld, tTrans.position, 20, { 1.0f, 0.2f, 0.2f, 1.0f }); // Ԃ
+            }
+        }
+        // ---------------------------------------------------------
+        // C: Gl~[̃mbNobN (dΉ)
+        // ---------------------------------------------------------
+        if (registry->HasComponent<EnemyComponent>(targetID) &&
+            registry->HasComponent<PhysicsComponent>(targetID))
+        {
+            auto& enemy = registry->GetComponent<EnemyComponent>(targetID);
 
-    float hx = targetOBB.extents.x;
-    float hy = targetOBB.extents.y;
-    float hz = targetOBB.extents.z;
+            // ǉ: stOĂmbNobNȂ
+            if (!enemy.isImmovable) {
+                auto& ePhy = registry->GetComponent<PhysicsComponent>(targetID);
+                auto& eTrans = registry->GetComponent<TransformComponent>(targetID);
 
-    //̕\ʏ̍ŋߓ_
-    float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
-    float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
-    float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
+                XMVECTOR enemyPosVal = XMLoadFloat3(&eTrans.position);
+                XMVECTOR dir = enemyPosVal - attackPos;
+                dir = XMVectorSetY(dir, 0.0f);
+                dir = XMVector3Normalize(dir);
 
-    //2
-    float dx = p.x - cx;
-    float dy = p.y - cy;
-    float dz = p.z - cz;
-    float distSq = dx * dx + dy * dy + dz * dz;
+                // C: d(weight)ŊI
+                // {З: 10, ㏸5
+                // weight=1.0Ȃ炻̂܂܁Bweight=10.0Ȃ1/10ɂȂB
+                float knockBackPower = 10.0f / enemy.weight;
+                float liftPower = 5.0f / enemy.weight;
 
-    //aȂqbg
-    if (distSq < radius * radius) {
-        auto& targetStatus = registry->GetComponent<StatusComponent>(targetID);
+                XMVECTOR v = dir * knockBackPower;
+                v = XMVectorSetY(v, liftPower);
 
-        if (targetStatus.invincibleTimer <= 0.0f) {
-            targetStatus.TakeDamage(attackBox.damage);
-            targetStatus.invincibleTimer = 0.5f;
-            DebugLog("Hit! Target:%d Dmg:%d HP:%d", targetID, attackBox.damage, targetStatus.hp);
-            if (registry->HasComponent<TransformComponent>(targetID)) {
-                auto& tTrans = registry->GetComponent<TransformComponent>(targetID);
-                EntityFactory::CreateHitEffect(pWorld, tTrans.position, 8, { 1.0f, 0.5f, 0.0f, 1.0f });
+                XMStoreFloat3(&ePhy.velocity, v);
 
-                // Gl~[|͂ɔhɁI
-                if (targetStatus.IsDead()) {
-                    EntityFactory::CreateHitEffect(pWorld, tTrans.position, 20, { 1.0f, 0.2f, 0.2f, 1.0f }); // Ԃ
-                }
+                // dԂ͂̂܂
+                enemy.knockbackTimer = 0.5f;
             }
-            // ---------------------------------------------------------
-            // C: Gl~[̃mbNobN (dΉ)
-            // ---------------------------------------------------------
-            if (registry->HasComponent<EnemyComponent>(targetID) &&
-                registry->HasComponent<PhysicsComponent>(targetID))
-            {
-                auto& enemy = registry->GetComponent<EnemyComponent>(targetID);
-
-                // ǉ: stOĂmbNobNȂ
-                if (!enemy.isImmovable) {
-                    auto& ePhy = registry->GetComponent<PhysicsComponent>(targetID);
-                    auto& eTrans = registry->GetComponent<TransformComponent>(targetID);
-
-                    XMVECTOR enemyPosVal = XMLoadFloat3(&eTrans.position);
-                    XMVECTOR dir = enemyPosVal - attackPos;
-                    dir = XMVectorSetY(dir, 0.0f);
-                    dir = XMVector3Normalize(dir);
-
-                    // C: d(weight)ŊI
-                    // {З: 10, ㏸5
-                    // weight=1.0Ȃ炻̂܂܁Bweight=10.0Ȃ1/10ɂȂB
-                    float knockBackPower = 10.0f / enemy.weight;
-                    float liftPower = 5.0f / enemy.weight;
-
-                    XMVECTOR v = dir * knockBackPower;
-                    v = XMVectorSetY(v, liftPower);
-
-                    XMStoreFloat3(&ePhy.velocity, v);
-
-                    // dԂ͂̂܂
-                    enemy.knockbackTimer = 0.5f;
-                }
+        }
+        // mbNobN
+        if (isTargetPlayer) {
+            auto& pTrans = registry->GetComponent<TransformComponent>(targetID);
+            auto& pComp = registry->GetComponent<PlayerComponent>(targetID);
+
+            XMVECTOR enemyPos;
+            if (registry->HasComponent<TransformComponent>(ownerID)) {
+                enemyPos = XMLoadFloat3(&registry->GetComponent<TransformComponent>(ownerID).position);
+            }
+            else {
+                enemyPos = attackPos;
+            }
+            XMVECTOR targetPos = XMLoadFloat3(&pTrans.position);
+
+            // G ->  ւ̃xNg
+            XMVECTOR dir = targetPos - enemyPos;
+            dir = XMVectorSetY(dir, 0.0f);
+
+            // dȂĂꍇ: vC[̔w֔΂ (RotationgČvZ)
+            if (XMVectorGetX(XMVector3LengthSq(dir)) < 0.001f) {
+                // vC[̌擾āA̋t()vZ
+                XMMATRIX rotMat = XMMatrixRotationY(pTrans.rotation.y);
+                // (0,0,-1) ̓[J̌B]ă[ȟɂ
+                dir = XMVector3TransformCoord(XMVectorSet(0, 0, -1.0f, 0), rotMat);
+            }
+            else {
+                dir = XMVector3Normalize(dir);
             }
-            // mbNobN
-            if (isTargetPlayer) {
-                auto& pTrans = registry->GetComponent<TransformComponent>(targetID);
-                auto& pComp = registry->GetComponent<PlayerComponent>(targetID);
-
-                XMVECTOR enemyPos;
-                if (registry->HasComponent<TransformComponent>(ownerID)) {
-                    enemyPos = XMLoadFloat3(&registry->GetComponent<TransformComponent>(ownerID).position);
-                }
-                else {
-                    enemyPos = attackPos;
-                }
-                XMVECTOR targetPos = XMLoadFloat3(&pTrans.position);
-
-                // G ->  ւ̃xNg
-                XMVECTOR dir = targetPos - enemyPos;
-                dir = XMVectorSetY(dir, 0.0f);
 
-                // dȂĂꍇ: vC[̔w֔΂ (RotationgČvZ)
-                if (XMVectorGetX(XMVector3LengthSq(dir)) < 0.001f) {
-                    // vC[̌擾āA̋t()vZ
-                    XMMATRIX rotMat = XMMatrixRotationY(pTrans.rotation.y);
-                    // (0,0,-1) ̓[J̌B]ă[ȟɂ
-                    dir = XMVector3TransformCoord(XMVectorSet(0, 0, -1.0f, 0), rotMat);
-                }
-                else {
-                    dir = XMVector3Normalize(dir);
-                }
+            // ΂ߏ֒e (15, ㏸10)
+            // ̑xPlayerSystemŏȂ悤ɁAPlayerSystem̏CK{ł
+            XMVECTOR knockbackVel = dir * 10.0f;
+            knockbackVel = XMVectorSetY(knockbackVel, 5.0f);
 
-                // ΂ߏ֒e (15, ㏸10)
-                // ̑xPlayerSystemŏȂ悤ɁAPlayerSystem̏CK{ł
-                XMVECTOR knockbackVel = dir * 10.0f;
-                knockbackVel = XMVectorSetY(knockbackVel, 5.0f);
+            XMStoreFloat3(&pComp.velocity, knockbackVel);
+            pComp.isGrounded = false;
+        }
 
-                XMStoreFloat3(&pComp.velocity, knockbackVel);
-                pComp.isGrounded = false;
+        // S
+        if (targetStatus.IsDead()) {
+            DebugLog("Target(%d) Defeated!", targetID);
+            // 炷
+            if (auto audio = GameAudio()) {
+                audio->Play("SE_SWITCH");
             }
-
-            // S
-            if (targetStatus.IsDead()) {
-                DebugLog("Target(%d) Defeated!", targetID);
-                if (registry->HasComponent<TransformComponent>(targetID)) {
-                    auto& tf = registry->GetComponent<TransformComponent>(targetID);
-
-                    // 炷
-                    if (auto audio = Game::GetInstance()->GetAudio()) {
-                        audio->Play("SE_SWITCH");
-                    }
-                }
-                // vC[Ȃ폜Ȃ (DeadAj[V̂)
-                if (!isTargetPlayer) {
-                    DestroyEnemyParts(pWorld, targetID);
-                    pWorld->DestroyEntity(targetID);
-                }
+            // vC[Ȃ폜Ȃ (DeadAj[V̂)
+            if (!isTargetPlayer) {
+                DestroyEnemyParts(pWorld, targetID);
+                pWorld->DestroyEntity(targetID);
             }
         }
     }
 
 }
 
-// 񕜔̎ (CheckRecoveryHit)
-void PhysicsSystem::CheckRecoveryHit(EntityID recoveryID, EntityID targetID) {
+// 񕜃qbg̏ (ApplyRecoveryHit)
+void PhysicsSystem::ApplyRecoveryHit(EntityID recoveryID, EntityID targetID) {
     auto registry = pWorld->GetRegistry();
 
     // 肪 Type_None Ȃ画肵Ȃ
@@ -885,51 +1929,22 @@ void PhysicsSystem::CheckRecoveryHit(EntityID recoveryID, EntityID targetID) {
         if (registry->GetComponent<ColliderComponent>(targetID).type == ColliderType::Type_None) return;
     }
 
-    // 񕜔iƂ݂Ȃj
-    auto& rTrans = registry->GetComponent<TransformComponent>(recoveryID);
-    float radius = 0.5f * rTrans.scale.x;
-    XMVECTOR recPos = XMLoadFloat3(&rTrans.position);
-
-    // iOBBj
-    OBB targetOBB = GetOBB(targetID);
-    XMMATRIX targetWorld = XMLoadFloat4x4(&targetOBB.worldMatrix);
-    XMVECTOR det;
-    XMMATRIX targetInvWorld = XMMatrixInverse(&det, targetWorld);
-
-    // 胍WbN (_vs)
-    XMVECTOR centerL = XMVector3TransformCoord(recPos, targetInvWorld);
-    XMFLOAT3 p; XMStoreFloat3(&p, centerL);
-
-    float hx = targetOBB.extents.x;
-    float hy = targetOBB.extents.y;
-    float hz = targetOBB.extents.z;
-
-    float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
-    float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
-    float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
+    auto& targetStats = registry->GetComponent<StatusComponent>(targetID);
+    auto& recBox = registry->GetComponent<RecoveryBoxComponent>(recoveryID);
 
-    float dx = p.x - cx; float dy = p.y - cy; float dz = p.z - cz;
-    float distSq = dx * dx + dy * dy + dz * dz;
+    // HPĂ鎞
+    if (targetStats.hp < targetStats.maxHp) {
+        targetStats.hp += recBox.healAmount;
+        if (targetStats.hp > targetStats.maxHp) targetStats.hp = targetStats.maxHp;
 
-    // qbgI
-    if (distSq < radius * radius) {
-        auto& targetStats = registry->GetComponent<StatusComponent>(targetID);
-        auto& recBox = registry->GetComponent<RecoveryBoxComponent>(recoveryID);
+        DebugLog("Healed! Target(%d) HP: %d / %d", targetID, targetStats.hp, targetStats.maxHp);
 
-        // HPĂ鎞
-        if (targetStats.hp < targetStats.maxHp) {
-            targetStats.hp += recBox.healAmount;
-            if (targetStats.hp > targetStats.maxHp) targetStats.hp = targetStats.maxHp;
-
-            DebugLog("Healed! Target(%d) HP: %d / %d", targetID, targetStats.hp, targetStats.maxHp);
-
-            // 񕜂画 (1g؂)
-            // ͈͎񕜂ɂꍇ͂
-            pWorld->DestroyEntity(recoveryID);
-        }
+        // 񕜂画 (1g؂)
+        // ͈͎񕜂ɂꍇ͂
+        pWorld->DestroyEntity(recoveryID);
     }
 }
-void PhysicsSystem::CheckAttackSphereHit(EntityID attackID, EntityID targetID) {
+void PhysicsSystem::ApplyAttackSphereHit(EntityID attackID, EntityID targetID) {
     auto registry = pWorld->GetRegistry();
 
     // 肪 Type_None Ȃ画肵Ȃ
@@ -945,239 +1960,136 @@ void PhysicsSystem::CheckAttackSphereHit(EntityID attackID, EntityID targetID) {
     bool isTargetPlayer = registry->HasComponent<PlayerComponent>(targetID);
     if (isOwnerPlayer == isTargetPlayer) return;
 
-    // OBB̔
-    float radius = sphere.currentRadius; // L锼agp
     XMVECTOR spherePos = XMLoadFloat3(&trans.position);
 
-    OBB targetOBB = GetOBB(targetID);
-    XMMATRIX targetWorld = XMLoadFloat4x4(&targetOBB.worldMatrix);
-    XMVECTOR det;
-    XMMATRIX targetInvWorld = XMMatrixInverse(&det, targetWorld);
+    auto& targetStatus = registry->GetComponent<StatusComponent>(targetID);
+    if (targetStatus.invincibleTimer <= 0.0f) {
+        targetStatus.TakeDamage(sphere.damage);
+        targetStatus.invincibleTimer = 0.5f;
+        DebugLog("Sphere Hit! Target(%d)", targetID);
+        // qbgGtFNg
+        if (registry->HasComponent<TransformComponent>(targetID)) {
+            auto& tTrans = registry->GetComponent<TransformComponent>(targetID);
+            EntityFactory::CreateHitEffect(pWorld, tTrans.position, 5, { 1.0f, 0.8f, 0.0f, 1.0f }); // FΉ
 
-    XMVECTOR centerL = XMVector3TransformCoord(spherePos, targetInvWorld);
-    XMFLOAT3 p; XMStoreFloat3(&p, centerL);
+            if (targetStatus.IsDead()) {
+                EntityFactory::CreateHitEffect(pWorld, tTrans.position, 20, { 1.0f, 0.2f, 0.2f, 1.0f });
+            }
+        }
+        // ---------------------------------------------------------
+        // C: Gl~[̃mbNobN (͈͍U)
+        // ---------------------------------------------------------
+        if (registry->HasComponent<EnemyComponent>(targetID) &&
+            registry->HasComponent<PhysicsComponent>(targetID))
+        {
+            auto& enemy = registry->GetComponent<EnemyComponent>(targetID);
 
-    float hx = targetOBB.extents.x;
-    float hy = targetOBB.extents.y;
-    float hz = targetOBB.extents.z;
+            // ǉ: stO`FbN
+            if (!enemy.isImmovable) {
+                auto& ePhy = registry->GetComponent<PhysicsComponent>(targetID);
+                auto& eTrans = registry->GetComponent<TransformComponent>(targetID);
 
-    float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
-    float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
-    float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
+                XMVECTOR ePos = XMLoadFloat3(&eTrans.position);
+                XMVECTOR dir = ePos - spherePos;
+                dir = XMVectorSetY(dir, 0.0f);
+                dir = XMVector3Normalize(dir);
 
-    float dx = p.x - cx; float dy = p.y - cy; float dz = p.z - cz;
-    float distSq = dx * dx + dy * dy + dz * dz;
+                // C: dŊ
+                float knockBackPower = 15.0f / enemy.weight;
+                float liftPower = 8.0f / enemy.weight;
 
-    if (distSq < radius * radius) {
-        auto& targetStatus = registry->GetComponent<StatusComponent>(targetID);
-        if (targetStatus.invincibleTimer <= 0.0f) {
-            targetStatus.TakeDamage(sphere.damage);
-            targetStatus.invincibleTimer = 0.5f;
-            DebugLog("Sphere Hit! Target(%d)", targetID);
-            // qbgGtFNg
-            if (registry->HasComponent<TransformComponent>(targetID)) {
-                auto& tTrans = registry->GetComponent<TransformComponent>(targetID);
-                EntityFactory::CreateHitEffect(pWorld, tTrans.position, 5, { 1.0f, 0.8f, 0.0f, 1.0f }); // FΉ
+                XMVECTOR v = dir * knockBackPower;
+                v = XMVectorSetY(v, liftPower);
 
-                if (targetStatus.IsDead()) {
-                    EntityFactory::CreateHitEffect(pWorld, tTrans.position, 20, { 1.0f, 0.2f, 0.2f, 1.0f });
-                }
+                XMStoreFloat3(&ePhy.velocity, v);
+                enemy.knockbackTimer = 0.5f;
             }
-            // ---------------------------------------------------------
-            // C: Gl~[̃mbNobN (͈͍U)
-            // ---------------------------------------------------------
-            if (registry->HasComponent<EnemyComponent>(targetID) &&
-                registry->HasComponent<PhysicsComponent>(targetID))
-            {
-                auto& enemy = registry->GetComponent<EnemyComponent>(targetID);
-
-                // ǉ: stO`FbN
-                if (!enemy.isImmovable) {
-                    auto& ePhy = registry->GetComponent<PhysicsComponent>(targetID);
-                    auto& eTrans = registry->GetComponent<TransformComponent>(targetID);
-
-                    XMVECTOR ePos = XMLoadFloat3(&eTrans.position);
-                    XMVECTOR dir = ePos - spherePos;
-                    dir = XMVectorSetY(dir, 0.0f);
-                    dir = XMVector3Normalize(dir);
-
-                    // C: dŊ
-                    float knockBackPower = 15.0f / enemy.weight;
-                    float liftPower = 8.0f / enemy.weight;
-
-                    XMVECTOR v = dir * knockBackPower;
-                    v = XMVectorSetY(v, liftPower);
-
-                    XMStoreFloat3(&ePhy.velocity, v);
-                    enemy.knockbackTimer = 0.5f;
-                }
+        }
+        // mbNobN
+        if (isTargetPlayer) {
+            auto& pTrans = registry->GetComponent<TransformComponent>(targetID);
+            auto& pComp = registry->GetComponent<PlayerComponent>(targetID);
+
+            XMVECTOR enemyPos;
+            if (registry->HasComponent<TransformComponent>(ownerID)) {
+                enemyPos = XMLoadFloat3(&registry->GetComponent<TransformComponent>(ownerID).position);
             }
-            // mbNobN
-            if (isTargetPlayer) {
-                auto& pTrans = registry->GetComponent<TransformComponent>(targetID);
-                auto& pComp = registry->GetComponent<PlayerComponent>(targetID);
+            else {
+                enemyPos = XMLoadFloat3(&trans.position);
+            }
+            XMVECTOR targetPos = XMLoadFloat3(&pTrans.position);
 
-                XMVECTOR enemyPos;
-                if (registry->HasComponent<TransformComponent>(ownerID)) {
-                    enemyPos = XMLoadFloat3(&registry->GetComponent<TransformComponent>(ownerID).position);
-                }
-                else {
-                    enemyPos = XMLoadFloat3(&trans.position);
-                }
-                XMVECTOR targetPos = XMLoadFloat3(&pTrans.position);
+            XMVECTOR dir = targetPos - enemyPos;
+            dir = XMVectorSetY(dir, 0.0f);
 
-                XMVECTOR dir = targetPos - enemyPos;
-                dir = XMVectorSetY(dir, 0.0f);
+            if (XMVectorGetX(XMVector3LengthSq(dir)) < 0.001f) {
+                XMMATRIX rotMat = XMMatrixRotationY(pTrans.rotation.y);
+                dir = XMVector3TransformCoord(XMVectorSet(0, 0, -1.0f, 0), rotMat);
+            }
+            else {
+                dir = XMVector3Normalize(dir);
+            }
 
-                if (XMVectorGetX(XMVector3LengthSq(dir)) < 0.001f) {
-                    XMMATRIX rotMat = XMMatrixRotationY(pTrans.rotation.y);
-                    dir = XMVector3TransformCoord(XMVectorSet(0, 0, -1.0f, 0), rotMat);
-                }
-                else {
-                    dir = XMVector3Normalize(dir);
-                }
+            XMVECTOR knockbackVel = dir * 15.0f;
+            knockbackVel = XMVectorSetY(knockbackVel, 10.0f);
+            XMStoreFloat3(&pComp.velocity, knockbackVel);
+            pComp.isGrounded = false;
+        }
 
-                XMVECTOR knockbackVel = dir * 15.0f;
-                knockbackVel = XMVectorSetY(knockbackVel, 10.0f);
-                XMStoreFloat3(&pComp.velocity, knockbackVel);
-                pComp.isGrounded = false;
+        if (targetStatus.IsDead()) {
+            // SGtFNg
+            if (auto audio = GameAudio()) {
+                audio->Play("SE_SWITCH");
             }
-
-            if (targetStatus.IsDead()) {
-                // SGtFNg
-                if (registry->HasComponent<TransformComponent>(targetID)) {
-                    auto& tf = registry->GetComponent<TransformComponent>(targetID);
-                    if (auto audio = Game::GetInstance()->GetAudio()) {
-                        audio->Play("SE_SWITCH");
-                    }
-                }
-                // vC[Ȃ폜Ȃ
-                if (!isTargetPlayer) {
-                    DestroyEnemyParts(pWorld, targetID);
-                    pWorld->DestroyEntity(targetID);
-                }
+            // vC[Ȃ폜Ȃ
+            if (!isTargetPlayer) {
+                DestroyEnemyParts(pWorld, targetID);
+                pWorld->DestroyEntity(targetID);
             }
         }
     }
 }
 // -----------------------------------------------------------------------
-// ǉ: ẽqbg (CheckBulletHit)
+// ǉ: ẽqbg̏ (ApplyBulletHit)
 // -----------------------------------------------------------------------
-void PhysicsSystem::CheckBulletHit(EntityID bulletID, EntityID targetID) {
+void PhysicsSystem::ApplyBulletHit(EntityID bulletID, EntityID targetID) {
     auto registry = pWorld->GetRegistry();
 
     // e
     auto& bullet = registry->GetComponent<BulletComponent>(bulletID);
     auto& bTrans = registry->GetComponent<TransformComponent>(bulletID);
-    XMVECTOR bulletPos = XMLoadFloat3(&bTrans.position);
-    float bulletRadius = 0.3f; // ȇ傫 (EntityFactory̐ݒƍ킹)
 
-    // ^[QbgivC[jOBB
-    OBB targetOBB = GetOBB(targetID);
-    XMMATRIX targetWorld = XMLoadFloat4x4(&targetOBB.worldMatrix);
-    XMVECTOR det;
-    XMMATRIX targetInvWorld = XMMatrixInverse(&det, targetWorld);
-
-    // 胍WbN (_ vs OBB)
-    XMVECTOR centerL = XMVector3TransformCoord(bulletPos, targetInvWorld);
-    XMFLOAT3 p; XMStoreFloat3(&p, centerL);
-
-    float hx = targetOBB.extents.x;
-    float hy = targetOBB.extents.y;
-    float hz = targetOBB.extents.z;
-
-    float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
-    float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
-    float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
-
-    float dx = p.x - cx; float dy = p.y - cy; float dz = p.z - cz;
-    float distSq = dx * dx + dy * dy + dz * dz;
-
-    // qbgI
-    if (distSq < bulletRadius * bulletRadius) {
-        auto& targetStatus = registry->GetComponent<StatusComponent>(targetID);
-        // ====================================================
-         // p^[A: ^[QbguvC[v̏ꍇ
-         // ====================================================
-        if (registry->HasComponent<PlayerComponent>(targetID)) {
-            // vC[p̖Gԃ`FbN
-            if (targetStatus.invincibleTimer <= 0.0f) {
-                targetStatus.TakeDamage(bullet.damage);
-                targetStatus.invincibleTimer = 0.5f;
-
-                // vC[p̐ԂGtFNg
-                EntityFactory::CreateHitEffect(pWorld, bTrans.position, 5, { 1.0f, 0.2f, 0.0f, 1.0f });
-                DebugLog("Player Hit!");
-
-                // mbNobN
-                auto& pComp = registry->GetComponent<PlayerComponent>(targetID);
-                XMVECTOR knockDir;
-                if (registry->HasComponent<PhysicsComponent>(bulletID)) {
-                    auto& bPhy = registry->GetComponent<PhysicsComponent>(bulletID);
-                    knockDir = XMLoadFloat3(&bPhy.velocity);
-                }
-                else {
-                    knockDir = XMVectorSet(0, 0, 1, 0);
-                }
-                knockDir = XMVector3Normalize(XMVectorSetY(knockDir, 0.0f));
-                XMVECTOR knockVel = knockDir * 8.0f;
-                knockVel = XMVectorSetY(knockVel, 5.0f);
-                XMStoreFloat3(&pComp.velocity, knockVel);
-                pComp.isGrounded = false;
-
-                if (auto audio = Game::GetInstance()->GetAudio()) audio->Play("SE_SWITCH");
-
-                // eďI
-                bullet.isActive = false;
-                pWorld->DestroyEntity(bulletID);
-                return;
-            }
-        }
-        // ====================================================
-        // p^[B: ^[QbguGl~[v̏ꍇ
-        // ====================================================
-        else if (registry->HasComponent<EnemyComponent>(targetID)) {
-            // _[W
+    auto& targetStatus = registry->GetComponent<StatusComponent>(targetID);
+    // ====================================================
+     // p^[A: ^[QbguvC[v̏ꍇ
+     // ====================================================
+    if (registry->HasComponent<PlayerComponent>(targetID)) {
+        // vC[p̖Gԃ`FbN
+        if (targetStatus.invincibleTimer <= 0.0f) {
             targetStatus.TakeDamage(bullet.damage);
+            targetStatus.invincibleTimer = 0.5f;
 
-            // Gl~[p̐/΃GtFNg
-            EntityFactory::CreateHitEffect(pWorld, bTrans.position, 5, { 0.0f, 1.0f, 1.0f, 1.0f });
+            // vC[p̐ԂGtFNg
+            EntityFactory::CreateHitEffect(pWorld, bTrans.position, 5, { 1.0f, 0.2f, 0.0f, 1.0f });
+            DebugLog("Player Hit!");
 
-            // mbNobN
-            auto& enemy = registry->GetComponent<EnemyComponent>(targetID);
-            if (!enemy.isImmovable && registry->HasComponent<PhysicsComponent>(targetID)) {
-                auto& ePhy = registry->GetComponent<PhysicsComponent>(targetID);
-                XMVECTOR knockDir;
-                if (registry->HasComponent<PhysicsComponent>(bulletID)) {
-                    auto& bPhy = registry->GetComponent<PhysicsComponent>(bulletID);
-                    knockDir = XMLoadFloat3(&bPhy.velocity);
-                }
-                else {
-                    knockDir = XMVectorSet(0, 0, 1, 0);
-                }
-                knockDir = XMVector3Normalize(XMVectorSetY(knockDir, 0.0f));
-                float knockPower = 20.0f / enemy.weight;
-                XMVECTOR v = knockDir * knockPower;
-                v = XMVectorSetY(v, 2.0f / enemy.weight);
-                XMStoreFloat3(&ePhy.velocity, v);
-                enemy.knockbackTimer = 0.2f;
+            // mbNobN
+            auto& pComp = registry->GetComponent<PlayerComponent>(targetID);
+            XMVECTOR knockDir;
+            if (registry->HasComponent<PhysicsComponent>(bulletID)) {
+                auto& bPhy = registry->GetComponent<PhysicsComponent>(bulletID);
+                knockDir = XMLoadFloat3(&bPhy.velocity);
             }
-
-            // S (ʂ悤ɂȂ܂I)
-            if (targetStatus.IsDead()) {
-                DebugLog("Enemy(%d) Defeated by Bullet!", targetID);
-
-                if (registry->HasComponent<TransformComponent>(targetID)) {
-                    auto& tf = registry->GetComponent<TransformComponent>(targetID);
-                    EntityFactory::CreateHitEffect(pWorld, tf.position, 20, { 1.0f, 0.2f, 0.2f, 1.0f });
-                }
-
-                // p[c폜 -> {̍폜
-                DestroyEnemyParts(pWorld, targetID);
-                pWorld->DestroyEntity(targetID);
-
-                if (auto audio = Game::GetInstance()->GetAudio()) audio->Play("SE_SWITCH");
+            else {
+                knockDir = XMVectorSet(0, 0, 1, 0);
             }
+            knockDir = XMVector3Normalize(XMVectorSetY(knockDir, 0.0f));
+            XMVECTOR knockVel = knockDir * 8.0f;
+            knockVel = XMVectorSetY(knockVel, 5.0f);
+            XMStoreFloat3(&pComp.velocity, knockVel);
+            pComp.isGrounded = false;
+
+            if (auto audio = GameAudio()) audio->Play("SE_SWITCH");
 
             // eďI
             bullet.isActive = false;
@@ -1185,4 +2097,55 @@ void PhysicsSystem::CheckBulletHit(EntityID bulletID, EntityID targetID) {
             return;
         }
     }
+    // ====================================================
+    // p^[B: ^[QbguGl~[v̏ꍇ
+    // ====================================================
+    else if (registry->HasComponent<EnemyComponent>(targetID)) {
+        // _[W
+        targetStatus.TakeDamage(bullet.damage);
+
+        // Gl~[p̐/΃GtFNg
+        EntityFactory::CreateHitEffect(pWorld, bTrans.position, 5, { 0.0f, 1.0f, 1.0f, 1.0f });
+
+        // mbNobN
+        auto& enemy = registry->GetComponent<EnemyComponent>(targetID);
+        if (!enemy.isImmovable && registry->HasComponent<PhysicsComponent>(targetID)) {
+            auto& ePhy = registry->GetComponent<PhysicsComponent>(targetID);
+            XMVECTOR knockDir;
+            if (registry->HasComponent<PhysicsComponent>(bulletID)) {
+                auto& bPhy = registry->GetComponent<PhysicsComponent>(bulletID);
+                knockDir = XMLoadFloat3(&bPhy.velocity);
+            }
+            else {
+                knockDir = XMVectorSet(0, 0, 1, 0);
+            }
+            knockDir = XMVector3Normalize(XMVectorSetY(knockDir, 0.0f));
+            float knockPower = 20.0f / enemy.weight;
+            XMVECTOR v = knockDir * knockPower;
+            v = XMVectorSetY(v, 2.0f / enemy.weight);
+            XMStoreFloat3(&ePhy.velocity, v);
+            enemy.knockbackTimer = 0.2f;
+        }
+
+        // S (ʂ悤ɂȂ܂I)
+        if (targetStatus.IsDead()) {
+            DebugLog("Enemy(%d) Defeated by Bullet!", targetID);
+
+            if (registry->HasComponent<TransformComponent>(targetID)) {
+                auto& tf = registry->GetComponent<TransformComponent>(targetID);
+                EntityFactory::CreateHitEffect(pWorld, tf.position, 20, { 1.0f, 0.2f, 0.2f, 1.0f });
+            }
+
+            // p[c폜 -> {̍폜
+            DestroyEnemyParts(pWorld, targetID);
+            pWorld->DestroyEntity(targetID);
+
+            if (auto audio = GameAudio()) audio->Play("SE_SWITCH");
+        }
+
+        // eďI
+        bullet.isActive = false;
+        pWorld->DestroyEntity(bulletID);
+        return;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,304 @@
+/*===================================================================
+// ファイル: ProjectileSystem.cpp
+// 概要: 弾幕の発射と、プールに入れた弾の移動・当たり判定（実装部）
+=====================================================================*/
+#define NOMINMAX
+#include "ECS/Systems/ProjectileSystem.h"
+#include "ECS/World.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "ECS/Components/TransformComponent.h"
+#include "ECS/Components/ColliderComponent.h"
+#include "ECS/Components/PlayerComponent.h"
+#include "ECS/Components/StatusComponent.h"
+#include "ECS/Components/EnemyComponent.h"
+#include "ECS/Components/PatternEmitterComponent.h"
+#include "Engine/JobSystem.h"
+#include "Game/BulletPattern.h"
+#include "Game/EntityFactory.h"
+#include "App/Game.h"
+#include "App/Main.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace DirectX;
+
+// 壁に当たった時のエフェクトは1ステップにこれだけ
+// (エフェクトはエンティティとメッシュを作るので、弾幕が壁に当たり続けても増えすぎないように)
+static constexpr int MAX_WALL_EFFECTS_PER_STEP = 2;
+
+// 線分 p0-p1 上で、線分 a-b に一番近い点の割合 (0-1)
+static float ClosestParamOnSegment(const XMFLOAT3& p0, const XMFLOAT3& p1, const XMFLOAT3& a, const XMFLOAT3& b) {
+    const XMVECTOR d1 = XMLoadFloat3(&p1) - XMLoadFloat3(&p0);
+    const XMVECTOR d2 = XMLoadFloat3(&b) - XMLoadFloat3(&a);
+    const XMVECTOR r = XMLoadFloat3(&p0) - XMLoadFloat3(&a);
+    const float aa = XMVectorGetX(XMVector3Dot(d1, d1));
+    const float ee = XMVectorGetX(XMVector3Dot(d2, d2));
+    const float ff = XMVectorGetX(XMVector3Dot(d2, r));
+    if (aa < 1e-8f) return 0.0f;
+    const float cc = XMVectorGetX(XMVector3Dot(d1, r));
+    if (ee < 1e-8f) return std::clamp(-cc / aa, 0.0f, 1.0f);
+    const float bb = XMVectorGetX(XMVector3Dot(d1, d2));
+    const float denom = aa * ee - bb * bb;
+    float s = (denom > 1e-8f) ? std::clamp((bb * ff - cc * ee) / denom, 0.0f, 1.0f) : 0.0f;
+    const float t = (bb * s + ff) / ee;
+    if (t < 0.0f) s = std::clamp(-cc / aa, 0.0f, 1.0f);
+    else if (t > 1.0f) s = std::clamp((bb - cc) / aa, 0.0f, 1.0f);
+    return s;
+}
+
+// 半径 radius の球 (弾の半径込み) に、from から dir へ maxDist まで進む点が入る距離
+// カプセルは弾の線分に一番近い芯の点の球で見る (弾の半径に比べて十分正確)
+static bool SweepPointTarget(const XMFLOAT3& from, const XMFLOAT3& dir, float maxDist,
+    const XMFLOAT3& a, const XMFLOAT3& b, float radius, float& outDist) {
+    const XMFLOAT3 to = { from.x + dir.x * maxDist, from.y + dir.y * maxDist, from.z + dir.z * maxDist };
+    const float s = ClosestParamOnSegment(a, b, from, to);
+    const XMFLOAT3 c = { a.x + (b.x - a.x) * s, a.y + (b.y - a.y) * s, a.z + (b.z - a.z) * s };
+
+    const XMVECTOR m = XMLoadFloat3(&from) - XMLoadFloat3(&c);
+    const float bq = XMVectorGetX(XMVector3Dot(m, XMLoadFloat3(&dir)));
+    const float cq = XMVectorGetX(XMVector3Dot(m, m)) - radius * radius;
+    if (cq <= 0.0f) { outDist = 0.0f; return true; }   // 始点で重なっている
+    const float disc = bq * bq - cq;
+    if (bq > 0.0f || disc < 0.0f) return false;
+    const float t = -bq - std::sqrt(disc);
+    if (t > maxDist) return false;
+    outDist = std::max(t, 0.0f);
+    return true;
+}
+
+void ProjectileSystem::Init(World* world) {
+    System::Init(world);
+    // ワーカーはGameが持っている (なければ全部メインスレッドで処理する)
+    pJobs = Game::GetInstance() ? Game::GetInstance()->GetJobSystem() : nullptr;
+    scratch.resize(pJobs ? pJobs->GetThreadCount() : 1);
+}
+
+template<class Func>
+void ProjectileSystem::RunParallel(size_t count, size_t grain, Func&& func) {
+    if (pJobs) pJobs->ParallelFor(count, grain, func);
+    else if (count > 0) func(size_t(0), count, 0u);
+}
+
+void ProjectileSystem::Update(float dt) {
+    const auto start = std::chrono::steady_clock::now();
+    const uint32_t peak = stats.peakAlive;
+    stats = {};
+    stats.peakAlive = peak;
+
+    RunEmitters(dt);
+    pool.Integrate(dt);
+    CollectTargets();
+    SweepAndHit();
+    pool.RemoveDead();
+
+    stats.alive = pool.Size();
+    stats.peakAlive = std::max(stats.peakAlive, stats.alive);
+    stats.dropped = pool.GetDropped();
+    stats.ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// ---------------------------------------------------------
+// 発射
+// ---------------------------------------------------------
+void ProjectileSystem::RunEmitters(float dt) {
+    auto registry = pWorld->GetRegistry();
+    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+        if (!registry->HasComponent<PatternEmitterComponent>(id)) continue;
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+        auto& emitter = registry->GetComponent<PatternEmitterComponent>(id);
+        if (!emitter.active) continue;
+
+        // 怯んでいる (ノックバック中の) 持ち主は撃たない。パターンはそこで打ち切り、
+        // 立ち直った後に EnemySystem が BossIdle から選び直す
+        // (物理はこの System より先に回るので、ノックバックされたステップから止まる)
+        if (registry->HasComponent<EnemyComponent>(id) &&
+            registry->GetComponent<EnemyComponent>(id).knockbackTimer > 0.0f) {
+            emitter.active = false;
+            continue;
+        }
+
+        const BulletPatternDesc& desc = GetBulletPattern(emitter.pattern);
+        emitter.angle += desc.rotationSpeed * dt;
+        emitter.spinAngle += desc.emitterSpin * dt;
+        emitter.cadenceTimer += dt;
+        if (emitter.cadenceTimer > desc.cadence) {
+            emitter.cadenceTimer = 0.0f;
+            FireVolley(emitter, desc, registry->GetComponent<TransformComponent>(id).position);
+        }
+
+        emitter.remaining -= dt;
+        if (emitter.remaining <= 0.0f) emitter.active = false;
+    }
+}
+
+void ProjectileSystem::FireVolley(const PatternEmitterComponent& emitter, const BulletPatternDesc& desc, const XMFLOAT3& origin) {
+    if (desc.aim == AimMode::AtTarget && !emitter.hasTarget) return;
+    const XMFLOAT3 core = { emitter.target.x, emitter.target.y + desc.aimHeight, emitter.target.z };
+
+    for (int e = 0; e < desc.emitterCount; ++e) {
+        // 発射口 (円に並べて回す)
+        XMFLOAT3 spawn = origin;
+        if (desc.emitterRadius > 0.0f) {
+            const float a = emitter.spinAngle + (XM_2PI / desc.emitterCount) * e;
+            spawn.x += cosf(a) * desc.emitterRadius;
+            spawn.z += sinf(a) * desc.emitterRadius;
+        }
+        spawn.y += desc.spawnHeight;
+
+        // 基準の向き (水平の角度と、水平に1進む間の上下)
+        float yaw = emitter.angle;
+        float rise = -0.2f;     // 標的がいなければ少し下へ
+        if (desc.aim == AimMode::AtTarget) {
+            const XMVECTOR d = XMVector3Normalize(XMLoadFloat3(&core) - XMLoadFloat3(&spawn));
+            if (desc.ringCount == 1) {
+                // まっすぐ標的へ
+                XMFLOAT3 v;
+                XMStoreFloat3(&v, d * desc.speed);
+                if (pool.Spawn(spawn, v, desc.lifeTime, desc.damage)) ++stats.spawned;
+                continue;
+            }
+            const float dx = XMVectorGetX(d), dy = XMVectorGetY(d), dz = XMVectorGetZ(d);
+            yaw = atan2f(dx, dz);
+            const float h = std::sqrt(dx * dx + dz * dz);
+            rise = (h > 1e-4f) ? dy / h : 0.0f;
+        }
+        else if (emitter.hasTarget) {
+            const float dx = emitter.target.x - origin.x, dz = emitter.target.z - origin.z;
+            rise = (core.y - spawn.y) / std::max(std::sqrt(dx * dx + dz * dz), 0.1f);
+        }
+
+        // 1回の斉射 (一周なら等分、そうでなければ spread の範囲に並べる)
+        const int n = std::max(desc.ringCount, 1);
+        const bool fullRing = desc.spread >= XM_2PI - 1e-4f;
+        for (int i = 0; i < n; ++i) {
+            float a = yaw;
+            if (fullRing) a += (XM_2PI / n) * i;
+            else if (n > 1) a += -0.5f * desc.spread + desc.spread * i / (n - 1);
+            const XMVECTOR d = XMVector3Normalize(XMVectorSet(sinf(a), rise, cosf(a), 0.0f));
+            XMFLOAT3 v;
+            XMStoreFloat3(&v, d * desc.speed);
+            if (pool.Spawn(spawn, v, desc.lifeTime, desc.damage)) ++stats.spawned;
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// 当たり判定
+// ---------------------------------------------------------
+void ProjectileSystem::CollectTargets() {
+    auto registry = pWorld->GetRegistry();
+    targets.clear();
+    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+        if (!registry->HasComponent<PlayerComponent>(id)) continue;
+        if (!registry->HasComponent<StatusComponent>(id)) continue;
+        if (!registry->HasComponent<ColliderComponent>(id)) continue;
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+        const auto& col = registry->GetComponent<ColliderComponent>(id);
+        if (col.type == ColliderType::Type_None) continue;
+        const auto& trans = registry->GetComponent<TransformComponent>(id);
+
+        const XMFLOAT3 c = { trans.position.x + col.center.x, trans.position.y + col.center.y, trans.position.z + col.center.z };
+        Target t{ id, c, c, col.radius * trans.scale.x };
+        if (col.type == ColliderType::Type_Capsule) {
+            const float half = std::max(0.0f, col.height * trans.scale.y - 2.0f * t.radius) * 0.5f;
+            t.a.y -= half;
+            t.b.y += half;
+        }
+        else if (col.type == ColliderType::Type_Box || col.type == ColliderType::Type_Hull) {
+            // 箱は外接球で見る
+            const float hx = col.size.x * trans.scale.x, hy = col.size.y * trans.scale.y, hz = col.size.z * trans.scale.z;
+            t.radius = 0.5f * std::sqrt(hx * hx + hy * hy + hz * hz);
+        }
+        targets.push_back(t);
+    }
+}
+
+void ProjectileSystem::SweepAndHit() {
+    PhysicsSystem* physics = pWorld->GetSystem<PhysicsSystem>();
+    for (WorkerScratch& s : scratch) s.hits.clear();
+
+    RunParallel(pool.Size(), 64, [&](size_t begin, size_t end, unsigned thread) {
+        WorkerScratch& s = scratch[thread];
+        for (size_t b = begin; b < end; ++b) {
+            if (!pool.IsAlive((uint32_t)b)) continue;
+            const XMFLOAT3& from = pool.prevPosition[b];
+            const XMFLOAT3& to = pool.position[b];
+            const XMVECTOR move = XMLoadFloat3(&to) - XMLoadFloat3(&from);
+            const float len = XMVectorGetX(XMVector3Length(move));
+            if (len < 1e-6f) continue;
+            XMFLOAT3 dir;
+            XMStoreFloat3(&dir, move / len);
+
+            // 壁 (ここより奥の相手には当たらない)
+            float wallDist = len;
+            const bool hitWall = physics && physics->SweepSphereStatic(from, to, ProjectilePool::RADIUS, wallDist, s.candidates);
+
+            for (const Target& t : targets) {
+                float dist;
+                if (!SweepPointTarget(from, dir, wallDist, t.a, t.b, t.radius + ProjectilePool::RADIUS, dist)) continue;
+                s.hits.push_back({ dist / len, (uint32_t)b, t.id,
+                    { from.x + dir.x * dist, from.y + dir.y * dist, from.z + dir.z * dist } });
+            }
+            if (hitWall) {
+                s.hits.push_back({ wallDist / len, (uint32_t)b, ECSConfig::INVALID_ID,
+                    { from.x + dir.x * wallDist, from.y + dir.y * wallDist, from.z + dir.z * wallDist } });
+            }
+        }
+    });
+
+    hits.clear();
+    for (const WorkerScratch& s : scratch) hits.insert(hits.end(), s.hits.begin(), s.hits.end());
+
+    // 時刻順 (同時刻なら弾→相手の順。スレッドの分担に関係なく同じ順になる)
+    std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+        if (a.toi != b.toi) return a.toi < b.toi;
+        if (a.bullet != b.bullet) return a.bullet < b.bullet;
+        return a.targetID < b.targetID;
+    });
+
+    auto registry = pWorld->GetRegistry();
+    int wallEffects = 0;
+    for (const Hit& h : hits) {
+        if (!pool.IsAlive(h.bullet)) continue;
+
+        // 壁: 当たった位置で消える
+        if (h.targetID == ECSConfig::INVALID_ID) {
+            if (wallEffects++ < MAX_WALL_EFFECTS_PER_STEP) {
+                EntityFactory::CreateHitEffect(pWorld, h.point, 3, { 0.8f, 0.8f, 0.8f, 1.0f });
+            }
+            pool.Kill(h.bullet);
+            ++stats.wallHits;
+            continue;
+        }
+
+        // 先に処理した弾で倒されているかもしれない
+        if (!registry->HasComponent<StatusComponent>(h.targetID)) continue;
+        if (ApplyHit(h.targetID, h.bullet, h.point)) {
+            pool.Kill(h.bullet);
+            ++stats.targetHits;
+        }
+    }
+}
+
+bool ProjectileSystem::ApplyHit(EntityID targetID, uint32_t bullet, const XMFLOAT3& point) {
+    auto registry = pWorld->GetRegistry();
+    auto& status = registry->GetComponent<StatusComponent>(targetID);
+    // 無敵中は素通りする
+    if (status.invincibleTimer > 0.0f) return false;
+
+    status.TakeDamage(pool.damage[bullet]);
+    status.invincibleTimer = 0.5f;
+    EntityFactory::CreateHitEffect(pWorld, point, 5, { 1.0f, 0.2f, 0.0f, 1.0f });
+    DebugLog("Player Hit!");
+
+    // 弾の向きへノックバック
+    auto& player = registry->GetComponent<PlayerComponent>(targetID);
+    XMVECTOR knockDir = XMVector3Normalize(XMVectorSetY(XMLoadFloat3(&pool.velocity[bullet]), 0.0f));
+    XMVECTOR knockVel = XMVectorSetY(knockDir * 8.0f, 5.0f);
+    XMStoreFloat3(&player.velocity, knockVel);
+    player.isGrounded = false;
+
+    if (auto audio = Game::GetInstance()->GetAudio()) audio->Play("SE_SWITCH");
+    return true;
+}
@@ -4,6 +4,9 @@
 //C: 萔obt@̃ZbgRCA`Xe[gSɃZbg
 =====================================================================*/
 #include "ECS/Systems/RenderSystem.h"
+#include "ECS/Components/PlayerPartComponent.h"
+#include "ECS/Components/EnemyPartComponent.h"
+#include "ECS/Systems/ProjectileSystem.h"
 #include "App/Main.h"
 
 
@@ -89,6 +92,20 @@ void RenderSystem::Init(World* world) {
 	// ǉ: SPHERE ()
 	MeshData sphereData = GeometryGenerator::CreateMesh(ShapeType::SPHERE, Colors::Red);
 	CreateDebugMesh(sphereData, debugMeshSphere);
+
+	// ǉ: e̒ep (Xbg1ɒeƂ̈ʒuƑ傫ׂ)
+	const D3D11_INPUT_ELEMENT_DESC instancedLayout[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 0,  D3D11_INPUT_PER_VERTEX_DATA,   0 },
+		{ "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA,   0 },
+		{ "INSTANCE", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0,  D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+	};
+	if (!graphics->CreateVertexShader(L"Shaders/InstancedVS.hlsl", instancedLayout, ARRAYSIZE(instancedLayout), &pInstancedVS, &pInstancedLayout)) {
+		MessageBoxW(NULL, L"Instanced Vertex Shader Load Failed", L"Error", MB_OK);
+	}
+	graphics->CreateDynamicVertexBuffer(sizeof(XMFLOAT4) * ProjectilePool::CAPACITY, &pInstanceBuffer);
+
+	MeshData projectileData = GeometryGenerator::CreateMesh(ShapeType::SPHERE, Colors::Red);
+	CreateDebugMesh(projectileData, projectileMesh);
 }
 
 void RenderSystem::Update(float dt) {
@@ -148,6 +165,9 @@ void RenderSystem::Draw() {
 	vp.TopLeftY = 0.0f;
 	context->RSSetViewports(1, &vp);
 
+	// ŒXebvԂ̕ԌW
+	const float alpha = pWorld->GetInterpolationAlpha();
+
 	// =====================================================
 // ʏ`惋[v
 // =====================================================
@@ -157,7 +177,7 @@ void RenderSystem::Draw() {
 
 
 		auto& mesh = registry->GetComponent<MeshComponent>(id);
-		auto& trans = registry->GetComponent<TransformComponent>(id);
+		TransformComponent trans = GetRenderTransform(id, registry->GetComponent<TransformComponent>(id), alpha);
 
 
 		XMMATRIX world = CalculateWorldMatrix(trans);
@@ -174,6 +194,9 @@ void RenderSystem::Draw() {
 		context->DrawIndexed(mesh.indexCount, 0, 0);
 	}
 
+	// ǉ: e̒e (1̕`ł܂Ƃ߂)
+	DrawProjectiles(context, viewProj, alpha);
+
 	// =====================================================
 // fobO`
 // =====================================================
@@ -187,7 +210,7 @@ void RenderSystem::Draw() {
 
 
 			auto& col = registry->GetComponent<ColliderComponent>(id);
-			auto& trans = registry->GetComponent<TransformComponent>(id);
+			TransformComponent trans = GetRenderTransform(id, registry->GetComponent<TransformComponent>(id), alpha);
 
 
 			if (col.type == ColliderType::Type_None) continue;
@@ -250,6 +273,90 @@ XMMATRIX RenderSystem::CalculateWorldMatrix(const TransformComponent& t) {
 	return S * R * T;
 }
 
+// -----------------------------------------------------------------------
+// ǉ: `pTransform
+// -----------------------------------------------------------------------
+// ŒXebvœ{̂͑OXebvƂ̊ԂԂB
+// p[c(t[ě݈ʒuɍ킹Ĕzu)́Ae̕Ԃꕪꏏɂ炷
+TransformComponent RenderSystem::GetRenderTransform(EntityID id, const TransformComponent& t, float alpha) {
+	TransformComponent r = t;
+	if (t.interpolate) {
+		r.position = t.InterpolatedPosition(alpha);
+		r.rotation = t.InterpolatedRotation(alpha);
+		return r;
+	}
+
+	auto registry = pWorld->GetRegistry();
+	int parentID = -1;
+	if (registry->HasComponent<PlayerPartComponent>(id)) {
+		parentID = registry->GetComponent<PlayerPartComponent>(id).parentID;
+	}
+	else if (registry->HasComponent<EnemyPartComponent>(id)) {
+		parentID = registry->GetComponent<EnemyPartComponent>(id).parentID;
+	}
+	if (parentID < 0 || !registry->HasComponent<TransformComponent>(parentID)) return r;
+
+	const auto& parent = registry->GetComponent<TransformComponent>(parentID);
+	if (!parent.interpolate) return r;
+
+	XMFLOAT3 ip = parent.InterpolatedPosition(alpha);
+	r.position.x += ip.x - parent.position.x;
+	r.position.y += ip.y - parent.position.y;
+	r.position.z += ip.z - parent.position.z;
+	return r;
+}
+
+// -----------------------------------------------------------------------
+// ǉ: e̒e̕`
+// -----------------------------------------------------------------------
+// ProjectilePool ̒e̓GeBeBbVȂ̂ŁA
+// ʒu𓮓Iobt@ɋl߂ DrawIndexedInstanced 1ŕ`
+void RenderSystem::DrawProjectiles(ID3D11DeviceContext* context, const XMMATRIX& viewProj, float alpha) {
+	auto projectiles = pWorld->GetSystem<ProjectileSystem>();
+	if (!projectiles || !pInstancedVS || !pInstanceBuffer) return;
+
+	const ProjectilePool& pool = projectiles->GetPool();
+	const UINT count = pool.Size();
+	if (count == 0) return;
+
+	D3D11_MAPPED_SUBRESOURCE mapped;
+	if (FAILED(context->Map(pInstanceBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) return;
+
+	// ڂ̓GeBeB̒e (CreateEnemyBullet) Ɠ傫ɂ
+	// (蔻 ProjectilePool::RADIUS Ƃ͍킹Ȃ)
+	const float scale = PROJECTILE_DRAW_SCALE;
+	XMFLOAT4* dst = static_cast<XMFLOAT4*>(mapped.pData);
+	for (UINT i = 0; i < count; ++i) {
+		const XMFLOAT3& p0 = pool.prevPosition[i];
+		const XMFLOAT3& p1 = pool.position[i];
+		dst[i] = XMFLOAT4(
+			p0.x + (p1.x - p0.x) * alpha,
+			p0.y + (p1.y - p0.y) * alpha,
+			p0.z + (p1.z - p0.z) * alpha,
+			scale);
+	}
+	context->Unmap(pInstanceBuffer.Get(), 0);
+
+	// ʒu̓CX^Xf[^ő̂ŁA萔obt@ View * Projection 
+	UpdateConstantBuffer(context, viewProj);
+
+	ID3D11Buffer* buffers[2] = { projectileMesh.pVertexBuffer.Get(), pInstanceBuffer.Get() };
+	UINT strides[2] = { sizeof(Vertex), sizeof(XMFLOAT4) };
+	UINT offsets[2] = { 0, 0 };
+	context->IASetInputLayout(pInstancedLayout.Get());
+	context->VSSetShader(pInstancedVS.Get(), nullptr, 0);
+	context->IASetVertexBuffers(0, 2, buffers, strides, offsets);
+	context->IASetIndexBuffer(projectileMesh.pIndexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+	context->DrawIndexedInstanced(projectileMesh.indexCount, count, 0, 0, 0);
+
+	// ̕`̂߂ɒʏ̃VF[_[֖߂
+	ID3D11Buffer* nullBuffer = nullptr;
+	UINT zero = 0;
+	context->IASetVertexBuffers(1, 1, &nullBuffer, &zero, &zero);
+	context->IASetInputLayout(pInputLayout.Get());
+	context->VSSetShader(pVS.Get(), nullptr, 0);
+}
+
 void RenderSystem::UpdateConstantBuffer(ID3D11DeviceContext* context, XMMATRIX wvp) {
 	ConstantBufferData cbData;
 	cbData.transform = XMMatrixTranspose(wvp);
@@ -9,6 +9,8 @@
 #include "ECS/Components/PlayerComponent.h"
 #include "ECS/Components/EnemyComponent.h"
 #include "ECS/Components/RolesComponent.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "ECS/Systems/ProjectileSystem.h"
 #include "../../../ImGui/imgui.h"
 #include "App/Game.h"
 #include "Engine/Graphics.h"
@@ -16,6 +18,7 @@
 #include <format>
 #include <string>
 #include <cmath>
+#include <algorithm>
 
 // [hۑ
 void UISystem::Init(World* world) {
@@ -130,6 +133,55 @@ void UISystem::Update(float dt) {
 
     ImGui::EndChild();
     ImGui::End(); // Debug Log I
+
+    // -----------------------------------------------------
+    // 3. ǉ: ̓v (ԂƔ̐)
+    // -----------------------------------------------------
+    if (PhysicsSystem* physics = pWorld->GetSystem<PhysicsSystem>()) {
+        const PhysicsCounters& c = physics->GetCounters();
+        const PhysicsStatsHistory& history = physics->GetStatsHistory();
+
+        ImGui::SetNextWindowSize(ImVec2(360, 480), ImGuiCond_FirstUseEver);
+        ImGui::Begin("Physics Stats");
+
+        // ߂̃Xebv̍v (ÂɕԂ悤 head `)
+        std::string overlay = std::format("{:.3f} ms (avg {:.3f} / peak {:.3f})",
+            c.totalMs, history.AverageTotal(), history.PeakTotal());
+        ImGui::PlotLines("##PhysicsTotal", history.totalMs, PhysicsStatsHistory::SIZE, history.head,
+            overlay.c_str(), 0.0f, std::max(1.0f, history.PeakTotal()), ImVec2(0, 60));
+
+        if (ImGui::CollapsingHeader("Phases (ms)", ImGuiTreeNodeFlags_DefaultOpen)) {
+            ImGui::Text("%-14s %8s %8s", "phase", "last", "avg");
+            for (size_t p = 0; p < (size_t)PhysicsPhase::Count; ++p) {
+                ImGui::Text("%-14s %8.3f %8.3f", PHYSICS_PHASE_NAMES[p],
+                    c.phaseMs[p], history.AveragePhase((PhysicsPhase)p));
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Counters", ImGuiTreeNodeFlags_DefaultOpen)) {
+            ImGui::Text("Bodies integrated : %u", c.integratedBodies);
+            ImGui::Text("Awake / sleeping  : %u / %u", c.awakeBodies, c.sleepingBodies);
+            ImGui::Text("Ground rays       : %u", c.groundRays);
+            ImGui::Text("Character sweeps  : %u", c.characterSweeps);
+            ImGui::Text("Broadphase cand.  : %u", c.broadphaseCandidates);
+            ImGui::Text("Narrowphase tests : %u", c.narrowphaseTests);
+            ImGui::Text("Hits / pushes     : %u / %u", c.hits, c.pushes);
+            ImGui::Text("Contact cache     : %u hit / %u miss", c.contactCacheHits, c.contactCacheMisses);
+        }
+
+        // ǉ: e̒e (ProjectileSystem)
+        if (ProjectileSystem* projectiles = pWorld->GetSystem<ProjectileSystem>()) {
+            if (ImGui::CollapsingHeader("Projectiles", ImGuiTreeNodeFlags_DefaultOpen)) {
+                const ProjectileStats& ps = projectiles->GetStats();
+                ImGui::Text("Alive / peak      : %u / %u (cap %u)", ps.alive, ps.peakAlive, ProjectilePool::CAPACITY);
+                ImGui::Text("Spawned           : %u", ps.spawned);
+                ImGui::Text("Wall / target hits: %u / %u", ps.wallHits, ps.targetHits);
+                ImGui::Text("Dropped (total)   : %u", ps.dropped);
+                ImGui::Text("Step time         : %.3f ms", ps.ms);
+            }
+        }
+        ImGui::End();
+    }
 }
 
 void UISystem::Draw(Graphics* pGraphics) {
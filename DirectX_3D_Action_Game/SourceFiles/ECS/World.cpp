@@ -7,4 +7,70 @@
 //XV:
 //2025/12/06:VK쐬
 =====================================================================*/
-#include "ECS/World.h"
\ No newline at end of file
+#include "ECS/World.h"
+#include "ECS/Components/TransformComponent.h"
+#include "App/Main.h"
+#include "App/Game.h"
+#include <cmath>
+
+World::World() {
+	registry = std::make_unique<Registry>();
+	SetFixedTickRate(Config::FIXED_TICK_RATE);
+	SetRandomSeed(Config::RANDOM_SEED != 0 ? Config::RANDOM_SEED : Random::SeedFromClock());
+}
+
+//ǉ: V[h߂ėprƂ̗蒼 (ČpɃO֏o)
+void World::SetRandomSeed(uint64_t seed) {
+	randomSeed = seed;
+	for (size_t i = 0; i < (size_t)RandomStream::Count; ++i) {
+		randoms[i].Seed(seed, Random::MakeStream((RandomStream)i));
+	}
+	DebugLog("Random seed: %llu", (unsigned long long)seed);
+}
+
+void World::SetFixedTickRate(int hz) {
+	if (hz <= 0) return;
+	fixedDeltaTime = 1.0f / static_cast<float>(hz);
+}
+
+/*----------------------------------------------------------------
+//ŒXebvXV
+//  accumulator ɎԂ𗭂߁AfixedDeltaTime ƂɌŒSystem񂷁B
+//  dė܂肷 MAX_FIXED_STEPS őł؂Aĉ͎Ă
+//  (ǂƂĂɏdȂ鈫zh)
+-----------------------------------------------------------------*/
+void World::Update(float dt) {
+	Input* input = Game::GetInstance() ? Game::GetInstance()->GetInput() : nullptr;
+
+	accumulator += dt;
+	int steps = 0;
+	while (accumulator >= fixedDeltaTime && steps < Config::MAX_FIXED_STEPS) {
+		SnapshotTransforms();
+
+		if (input) input->BeginFixedStep();
+		for (auto* sys : fixedSystems) sys->Update(fixedDeltaTime);
+		if (input) input->EndFixedStep();
+
+		accumulator -= fixedDeltaTime;
+		++steps;
+	}
+	if (steps == Config::MAX_FIXED_STEPS && accumulator >= fixedDeltaTime) {
+		accumulator = std::fmod(accumulator, fixedDeltaTime);
+	}
+	lastFixedStepCount = steps;
+	interpolationAlpha = accumulator / fixedDeltaTime;
+
+	//ʏSystem͖t[1 (Aj[VEJE`Ȃ)
+	for (auto* sys : systems) sys->Update(dt);
+}
+
+void World::SnapshotTransforms() {
+	for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+		if (!registry->HasComponent<TransformComponent>(id)) continue;
+		auto& t = registry->GetComponent<TransformComponent>(id);
+		if (!t.interpolate) continue;
+		t.prevPosition = t.position;
+		t.prevRotation = t.rotation;
+		t.hasPrev = true;
+	}
+}
@@ -0,0 +1,670 @@
+/*===================================================================
+// t@C: Collision.cpp
+// Tv: SIMDꊇՓ˃NGij
+//       /arch:AVX2 Ńrhꍇ8[AȊOSSE24[ŏ
+=====================================================================*/
+#include "Engine/Collision.h"
+#include <immintrin.h>
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+
+using namespace DirectX;
+
+namespace Collision {
+
+    // -----------------------------------------------------------------
+    // SIMDbp[ (SSE / AVX œJ[lg񂷂߂̔^)
+    // -----------------------------------------------------------------
+    namespace {
+        struct F4 {
+            static constexpr int WIDTH = 4;
+            __m128 v;
+            static F4 Load(const float* p) { return { _mm_loadu_ps(p) }; }
+            static F4 Set1(float s) { return { _mm_set1_ps(s) }; }
+            static F4 Lanes() { return { _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f) }; }
+            void Store(float* p) const { _mm_storeu_ps(p, v); }
+        };
+        inline F4 operator+(F4 a, F4 b) { return { _mm_add_ps(a.v, b.v) }; }
+        inline F4 operator-(F4 a, F4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+        inline F4 operator*(F4 a, F4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+        inline F4 operator/(F4 a, F4 b) { return { _mm_div_ps(a.v, b.v) }; }
+        inline F4 Min(F4 a, F4 b) { return { _mm_min_ps(a.v, b.v) }; }
+        inline F4 Max(F4 a, F4 b) { return { _mm_max_ps(a.v, b.v) }; }
+        inline F4 Abs(F4 a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+        inline F4 Neg(F4 a) { return { _mm_xor_ps(_mm_set1_ps(-0.0f), a.v) }; }
+        inline F4 Sqrt(F4 a) { return { _mm_sqrt_ps(a.v) }; }
+        inline F4 CmpLt(F4 a, F4 b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+        inline F4 CmpLe(F4 a, F4 b) { return { _mm_cmple_ps(a.v, b.v) }; }
+        inline F4 CmpGt(F4 a, F4 b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+        inline F4 CmpGe(F4 a, F4 b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+        inline F4 And(F4 a, F4 b) { return { _mm_and_ps(a.v, b.v) }; }
+        inline F4 Or(F4 a, F4 b) { return { _mm_or_ps(a.v, b.v) }; }
+        inline F4 AndNot(F4 notA, F4 b) { return { _mm_andnot_ps(notA.v, b.v) }; }
+        // mask Ă郌[ aAȊO b (SSE2݂̂Ŏ)
+        inline F4 Select(F4 mask, F4 a, F4 b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+        inline int MoveMask(F4 a) { return _mm_movemask_ps(a.v); }
+
+#if defined(__AVX2__)
+        struct F8 {
+            static constexpr int WIDTH = 8;
+            __m256 v;
+            static F8 Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+            static F8 Set1(float s) { return { _mm256_set1_ps(s) }; }
+            static F8 Lanes() { return { _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f) }; }
+            void Store(float* p) const { _mm256_storeu_ps(p, v); }
+        };
+        inline F8 operator+(F8 a, F8 b) { return { _mm256_add_ps(a.v, b.v) }; }
+        inline F8 operator-(F8 a, F8 b) { return { _mm256_sub_ps(a.v, b.v) }; }
+        inline F8 operator*(F8 a, F8 b) { return { _mm256_mul_ps(a.v, b.v) }; }
+        inline F8 operator/(F8 a, F8 b) { return { _mm256_div_ps(a.v, b.v) }; }
+        inline F8 Min(F8 a, F8 b) { return { _mm256_min_ps(a.v, b.v) }; }
+        inline F8 Max(F8 a, F8 b) { return { _mm256_max_ps(a.v, b.v) }; }
+        inline F8 Abs(F8 a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+        inline F8 Neg(F8 a) { return { _mm256_xor_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+        inline F8 Sqrt(F8 a) { return { _mm256_sqrt_ps(a.v) }; }
+        inline F8 CmpLt(F8 a, F8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+        inline F8 CmpLe(F8 a, F8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+        inline F8 CmpGt(F8 a, F8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+        inline F8 CmpGe(F8 a, F8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+        inline F8 And(F8 a, F8 b) { return { _mm256_and_ps(a.v, b.v) }; }
+        inline F8 Or(F8 a, F8 b) { return { _mm256_or_ps(a.v, b.v) }; }
+        inline F8 AndNot(F8 notA, F8 b) { return { _mm256_andnot_ps(notA.v, b.v) }; }
+        inline F8 Select(F8 mask, F8 a, F8 b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+        inline int MoveMask(F8 a) { return _mm256_movemask_ps(a.v); }
+        using FWide = F8;
+#else
+        using FWide = F4;
+#endif
+
+        // CƂقڕsƂ݂Ȃ臒l (DirectXCollision Ɠl)
+        constexpr float RAY_EPSILON = 1e-20f;
+
+        // 1̃Xu (tMin/tMax ߁As͈͊OȂ miss 𗧂Ă)
+        template <typename V>
+        inline void Slab(V localOrigin, V localDir, V extent, V& tMin, V& tMax, V& miss) {
+            const V parallel = CmpLt(Abs(localDir), V::Set1(RAY_EPSILON));
+            const V inv = V::Set1(1.0f) / localDir;
+            const V t1 = (Neg(extent) - localOrigin) * inv;
+            const V t2 = (extent - localOrigin) * inv;
+            const V tNear = Select(parallel, V::Set1(-FLT_MAX), Min(t1, t2));
+            const V tFar = Select(parallel, V::Set1(FLT_MAX), Max(t1, t2));
+            miss = Or(miss, And(parallel, CmpGt(Abs(localOrigin), extent)));
+            tMin = Max(tMin, tNear);
+            tMax = Min(tMax, tFar);
+        }
+
+        // 1{̃C [0, count) OBBɑ΂ WIDTH 肷
+        // ߂l: OBB ([̓XJ[ŏ)
+        template <typename V>
+        size_t RaycastKernel(const OBBSoA& b, const RayQuery& ray, size_t count, float& bestDist, int& bestIndex) {
+            constexpr int W = V::WIDTH;
+            const V ox = V::Set1(ray.origin.x), oy = V::Set1(ray.origin.y), oz = V::Set1(ray.origin.z);
+            const V dx = V::Set1(ray.direction.x), dy = V::Set1(ray.direction.y), dz = V::Set1(ray.direction.z);
+            const V rad = V::Set1(ray.radius);
+            const V zero = V::Set1(0.0f);
+            const V lanes = V::Lanes();
+
+            V best = V::Set1(bestDist);
+            V bestIdx = V::Set1(-1.0f);
+
+            size_t i = 0;
+            for (; i + W <= count; i += W) {
+                // S̑Έʒu
+                const V rx = ox - V::Load(&b.cx[i]);
+                const V ry = oy - V::Load(&b.cy[i]);
+                const V rz = oz - V::Load(&b.cz[i]);
+
+                const V a0x = V::Load(&b.r00[i]), a0y = V::Load(&b.r01[i]), a0z = V::Load(&b.r02[i]);
+                const V a1x = V::Load(&b.r10[i]), a1y = V::Load(&b.r11[i]), a1z = V::Load(&b.r12[i]);
+                const V a2x = V::Load(&b.r20[i]), a2y = V::Load(&b.r21[i]), a2z = V::Load(&b.r22[i]);
+
+                V tMin = V::Set1(-FLT_MAX);
+                V tMax = V::Set1(FLT_MAX);
+                V miss = zero;
+
+                Slab(rx * a0x + ry * a0y + rz * a0z, dx * a0x + dy * a0y + dz * a0z, V::Load(&b.ex[i]) + rad, tMin, tMax, miss);
+                Slab(rx * a1x + ry * a1y + rz * a1z, dx * a1x + dy * a1y + dz * a1z, V::Load(&b.ey[i]) + rad, tMin, tMax, miss);
+                Slab(rx * a2x + ry * a2y + rz * a2z, dx * a2x + dy * a2y + dz * a2z, V::Load(&b.ez[i]) + rad, tMin, tMax, miss);
+
+                const V hit = AndNot(miss, And(And(CmpLe(tMin, tMax), CmpGe(tMax, zero)), CmpLt(tMin, best)));
+                if (MoveMask(hit) == 0) continue;
+
+                best = Select(hit, tMin, best);
+                bestIdx = Select(hit, lanes + V::Set1((float)i), bestIdx);
+            }
+
+            // [ԂōŏlI (ȂCfbNX̏ = Ɠ)
+            float lanesDist[W];
+            float lanesIdx[W];
+            best.Store(lanesDist);
+            bestIdx.Store(lanesIdx);
+            for (int l = 0; l < W; ++l) {
+                if (lanesIdx[l] < 0.0f) continue;
+                const int idx = (int)lanesIdx[l];
+                if (lanesDist[l] < bestDist || (lanesDist[l] == bestDist && bestIndex >= 0 && idx < bestIndex)) {
+                    bestDist = lanesDist[l];
+                    bestIndex = idx;
+                }
+            }
+            return i;
+        }
+
+        // 1̑| [0, count) OBBɑ΂ WIDTH 肵ASqbg
+        // ߂l: OBB ([̓XJ[ŏ)
+        template <typename V>
+        size_t SweepKernel(const OBBSoA& b, const RayQuery& ray, size_t count,
+            uint8_t* outHit, float* outToi, size_t& hitCount) {
+            constexpr int W = V::WIDTH;
+            const V ox = V::Set1(ray.origin.x), oy = V::Set1(ray.origin.y), oz = V::Set1(ray.origin.z);
+            const V dx = V::Set1(ray.direction.x), dy = V::Set1(ray.direction.y), dz = V::Set1(ray.direction.z);
+            const V rad = V::Set1(ray.radius);
+            const V maxDist = V::Set1(ray.maxDist);
+            const V zero = V::Set1(0.0f);
+
+            size_t i = 0;
+            for (; i + W <= count; i += W) {
+                const V rx = ox - V::Load(&b.cx[i]);
+                const V ry = oy - V::Load(&b.cy[i]);
+                const V rz = oz - V::Load(&b.cz[i]);
+
+                const V a0x = V::Load(&b.r00[i]), a0y = V::Load(&b.r01[i]), a0z = V::Load(&b.r02[i]);
+                const V a1x = V::Load(&b.r10[i]), a1y = V::Load(&b.r11[i]), a1z = V::Load(&b.r12[i]);
+                const V a2x = V::Load(&b.r20[i]), a2y = V::Load(&b.r21[i]), a2z = V::Load(&b.r22[i]);
+
+                V tMin = V::Set1(-FLT_MAX);
+                V tMax = V::Set1(FLT_MAX);
+                V miss = zero;
+
+                Slab(rx * a0x + ry * a0y + rz * a0z, dx * a0x + dy * a0y + dz * a0z, V::Load(&b.ex[i]) + rad, tMin, tMax, miss);
+                Slab(rx * a1x + ry * a1y + rz * a1z, dx * a1x + dy * a1y + dz * a1z, V::Load(&b.ey[i]) + rad, tMin, tMax, miss);
+                Slab(rx * a2x + ry * a2y + rz * a2z, dx * a2x + dy * a2y + dz * a2z, V::Load(&b.ez[i]) + rad, tMin, tMax, miss);
+
+                const V hit = AndNot(miss, And(And(CmpLe(tMin, tMax), CmpGe(tMax, zero)), CmpLe(tMin, maxDist)));
+                const int mask = MoveMask(hit);
+                Max(tMin, zero).Store(&outToi[i]);
+                for (int l = 0; l < W; ++l) {
+                    outHit[i + l] = (uint8_t)((mask >> l) & 1);
+                    hitCount += outHit[i + l];
+                }
+            }
+            return i;
+        }
+
+        // 1̋ [0, count) OBBɑ΂ WIDTH 肷
+        // ߂l: OBB ([̓XJ[ŏ)
+        template <typename V>
+        size_t SphereKernel(const OBBSoA& b, const XMFLOAT3& center, float radius, size_t count,
+            uint8_t* outHit, float* outPenetration, size_t& hitCount) {
+            constexpr int W = V::WIDTH;
+            const V px = V::Set1(center.x), py = V::Set1(center.y), pz = V::Set1(center.z);
+            const V r = V::Set1(radius);
+            const V rSq = r * r;
+
+            size_t i = 0;
+            for (; i + W <= count; i += W) {
+                const V rx = px - V::Load(&b.cx[i]);
+                const V ry = py - V::Load(&b.cy[i]);
+                const V rz = pz - V::Load(&b.cz[i]);
+
+                // [JW (]̋t = Ƃ̓)
+                const V lx = rx * V::Load(&b.r00[i]) + ry * V::Load(&b.r01[i]) + rz * V::Load(&b.r02[i]);
+                const V ly = rx * V::Load(&b.r10[i]) + ry * V::Load(&b.r11[i]) + rz * V::Load(&b.r12[i]);
+                const V lz = rx * V::Load(&b.r20[i]) + ry * V::Load(&b.r21[i]) + rz * V::Load(&b.r22[i]);
+
+                // ̕\ʏ̍ŋߓ_Ƃ̍
+                const V ex = V::Load(&b.ex[i]), ey = V::Load(&b.ey[i]), ez = V::Load(&b.ez[i]);
+                const V dx = lx - Max(Neg(ex), Min(lx, ex));
+                const V dy = ly - Max(Neg(ey), Min(ly, ey));
+                const V dz = lz - Max(Neg(ez), Min(lz, ez));
+                const V distSq = dx * dx + dy * dy + dz * dz;
+
+                const int mask = MoveMask(CmpLt(distSq, rSq));
+                (r - Sqrt(distSq)).Store(&outPenetration[i]);
+                for (int l = 0; l < W; ++l) {
+                    outHit[i + l] = (uint8_t)((mask >> l) & 1);
+                    hitCount += outHit[i + l];
+                }
+            }
+            return i;
+        }
+    }
+
+    // -----------------------------------------------------------------
+    // OBBSoA
+    // -----------------------------------------------------------------
+    void OBBSoA::Clear() {
+        cx.clear(); cy.clear(); cz.clear();
+        r00.clear(); r01.clear(); r02.clear();
+        r10.clear(); r11.clear(); r12.clear();
+        r20.clear(); r21.clear(); r22.clear();
+        ex.clear(); ey.clear(); ez.clear();
+        ids.clear();
+    }
+
+    void OBBSoA::Truncate(size_t n) {
+        if (n >= Size()) return;
+        cx.resize(n); cy.resize(n); cz.resize(n);
+        r00.resize(n); r01.resize(n); r02.resize(n);
+        r10.resize(n); r11.resize(n); r12.resize(n);
+        r20.resize(n); r21.resize(n); r22.resize(n);
+        ex.resize(n); ey.resize(n); ez.resize(n);
+        ids.resize(n);
+    }
+
+    void OBBSoA::Reserve(size_t n) {
+        cx.reserve(n); cy.reserve(n); cz.reserve(n);
+        r00.reserve(n); r01.reserve(n); r02.reserve(n);
+        r10.reserve(n); r11.reserve(n); r12.reserve(n);
+        r20.reserve(n); r21.reserve(n); r22.reserve(n);
+        ex.reserve(n); ey.reserve(n); ez.reserve(n);
+        ids.reserve(n);
+    }
+
+    void OBBSoA::Add(uint32_t id, const XMFLOAT3& center, const XMFLOAT3& extents, const XMFLOAT3& rotation) {
+        XMFLOAT4X4 m;
+        XMStoreFloat4x4(&m, XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z));
+        Add(id, center, extents, m);
+    }
+
+    void OBBSoA::Add(uint32_t id, const XMFLOAT3& center, const XMFLOAT3& extents, const XMFLOAT4X4& m) {
+        cx.push_back(center.x); cy.push_back(center.y); cz.push_back(center.z);
+        r00.push_back(m.m[0][0]); r01.push_back(m.m[0][1]); r02.push_back(m.m[0][2]);
+        r10.push_back(m.m[1][0]); r11.push_back(m.m[1][1]); r12.push_back(m.m[1][2]);
+        r20.push_back(m.m[2][0]); r21.push_back(m.m[2][1]); r22.push_back(m.m[2][2]);
+        ex.push_back(extents.x); ey.push_back(extents.y); ez.push_back(extents.z);
+        ids.push_back(id);
+    }
+
+    // -----------------------------------------------------------------
+    // XJ[ŃC
+    // -----------------------------------------------------------------
+    bool RaycastOBB(const OBBSoA& b, size_t i, const RayQuery& ray, float& outDist) {
+        const float rx = ray.origin.x - b.cx[i];
+        const float ry = ray.origin.y - b.cy[i];
+        const float rz = ray.origin.z - b.cz[i];
+        const float* axes[3][3] = {
+            { &b.r00[i], &b.r01[i], &b.r02[i] },
+            { &b.r10[i], &b.r11[i], &b.r12[i] },
+            { &b.r20[i], &b.r21[i], &b.r22[i] },
+        };
+        const float ext[3] = { b.ex[i] + ray.radius, b.ey[i] + ray.radius, b.ez[i] + ray.radius };
+
+        float tMin = -FLT_MAX;
+        float tMax = FLT_MAX;
+        for (int a = 0; a < 3; ++a) {
+            const float lo = rx * *axes[a][0] + ry * *axes[a][1] + rz * *axes[a][2];
+            const float ld = ray.direction.x * *axes[a][0] + ray.direction.y * *axes[a][1] + ray.direction.z * *axes[a][2];
+            if (std::fabs(ld) < RAY_EPSILON) {
+                if (std::fabs(lo) > ext[a]) return false;
+                continue;
+            }
+            const float inv = 1.0f / ld;
+            float t1 = (-ext[a] - lo) * inv;
+            float t2 = (ext[a] - lo) * inv;
+            if (t1 > t2) { float t = t1; t1 = t2; t2 = t; }
+            if (t1 > tMin) tMin = t1;
+            if (t2 < tMax) tMax = t2;
+        }
+        if (tMin > tMax || tMax < 0.0f) return false;
+        outDist = tMin;
+        return true;
+    }
+
+    DirectX::XMFLOAT3 OBBFaceNormal(const OBBSoA& b, size_t i, const DirectX::XMFLOAT3& point) {
+        const float rx = point.x - b.cx[i];
+        const float ry = point.y - b.cy[i];
+        const float rz = point.z - b.cz[i];
+        const float axes[3][3] = {
+            { b.r00[i], b.r01[i], b.r02[i] },
+            { b.r10[i], b.r11[i], b.r12[i] },
+            { b.r20[i], b.r21[i], b.r22[i] },
+        };
+        const float ext[3] = { b.ex[i], b.ey[i], b.ez[i] };
+
+        // ʂ͂ݏoĂʂԑ傫 (ɂ鎞͈ԋ߂)
+        int best = 0;
+        float bestOver = -FLT_MAX;
+        float bestLocal = 0.0f;
+        for (int a = 0; a < 3; ++a) {
+            const float local = rx * axes[a][0] + ry * axes[a][1] + rz * axes[a][2];
+            const float over = std::fabs(local) - ext[a];
+            if (over > bestOver) {
+                bestOver = over;
+                best = a;
+                bestLocal = local;
+            }
+        }
+        const float sign = (bestLocal < 0.0f) ? -1.0f : 1.0f;
+        return { axes[best][0] * sign, axes[best][1] * sign, axes[best][2] * sign };
+    }
+
+    // -----------------------------------------------------------------
+    // ꊇC
+    // -----------------------------------------------------------------
+    void RaycastBatch(const OBBSoA& boxes, const RayQuery* rays, RayHit* hits, size_t rayCount) {
+        const size_t count = boxes.Size();
+        for (size_t r = 0; r < rayCount; ++r) {
+            const RayQuery& ray = rays[r];
+            float bestDist = ray.maxDist;
+            int bestIndex = -1;
+
+            // SIMD
+            const size_t done = RaycastKernel<FWide>(boxes, ray, count, bestDist, bestIndex);
+
+            // [̓XJ[
+            for (size_t i = done; i < count; ++i) {
+                float dist = 0.0f;
+                if (RaycastOBB(boxes, i, ray, dist) && dist < bestDist) {
+                    bestDist = dist;
+                    bestIndex = (int)i;
+                }
+            }
+
+            RayHit& out = hits[r];
+            out.hit = (bestIndex >= 0);
+            out.distance = bestDist;
+            out.index = bestIndex;
+            out.id = out.hit ? boxes.ids[bestIndex] : INVALID_ID;
+        }
+    }
+
+    // -----------------------------------------------------------------
+    //  vs OBB
+    // -----------------------------------------------------------------
+    bool SphereOverlapOBB(const OBBSoA& b, size_t i, const XMFLOAT3& center, float radius, float& outPenetration) {
+        const float rx = center.x - b.cx[i];
+        const float ry = center.y - b.cy[i];
+        const float rz = center.z - b.cz[i];
+
+        const float lx = rx * b.r00[i] + ry * b.r01[i] + rz * b.r02[i];
+        const float ly = rx * b.r10[i] + ry * b.r11[i] + rz * b.r12[i];
+        const float lz = rx * b.r20[i] + ry * b.r21[i] + rz * b.r22[i];
+
+        const float dx = lx - std::fmax(-b.ex[i], std::fmin(lx, b.ex[i]));
+        const float dy = ly - std::fmax(-b.ey[i], std::fmin(ly, b.ey[i]));
+        const float dz = lz - std::fmax(-b.ez[i], std::fmin(lz, b.ez[i]));
+        const float distSq = dx * dx + dy * dy + dz * dz;
+
+        outPenetration = radius - std::sqrt(distSq);
+        return distSq < radius * radius;
+    }
+
+    size_t SphereOverlapBatch(const OBBSoA& boxes, const XMFLOAT3& center, float radius,
+        uint8_t* outHit, float* outPenetration) {
+        const size_t count = boxes.Size();
+        size_t hitCount = 0;
+
+        const size_t done = SphereKernel<FWide>(boxes, center, radius, count, outHit, outPenetration, hitCount);
+
+        // [̓XJ[
+        for (size_t i = done; i < count; ++i) {
+            const bool hit = SphereOverlapOBB(boxes, i, center, radius, outPenetration[i]);
+            outHit[i] = hit ? 1 : 0;
+            if (hit) ++hitCount;
+        }
+        return hitCount;
+    }
+
+    // -----------------------------------------------------------------
+    // | vs OBB (Sqbg)
+    // -----------------------------------------------------------------
+    size_t SweepSphereBatch(const OBBSoA& boxes, const RayQuery& ray, uint8_t* outHit, float* outToi) {
+        const size_t count = boxes.Size();
+        size_t hitCount = 0;
+
+        const size_t done = SweepKernel<FWide>(boxes, ray, count, outHit, outToi, hitCount);
+
+        // [̓XJ[
+        for (size_t i = done; i < count; ++i) {
+            float dist = 0.0f;
+            const bool hit = RaycastOBB(boxes, i, ray, dist) && dist <= ray.maxDist;
+            outHit[i] = hit ? 1 : 0;
+            outToi[i] = std::fmax(dist, 0.0f);
+            if (hit) ++hitCount;
+        }
+        return hitCount;
+    }
+
+    // -----------------------------------------------------------------
+    // JvZ vs OBB
+    // -----------------------------------------------------------------
+    namespace {
+        //  vs  (̃[J, S_ETCY h)
+        //  P(t) = a + d*t (t=0`1) Ɣ̋^2 ́Ae
+        // max(0, |p(t)| - h)^2 ̘a = 敪2̓ʊ֐ɂȂB
+        // ܂_ (p(t) = }h ƂȂ t, ő6) ŋԂ𕪂A
+        // eԂ2̍ŏlΌȍŋߓ_܂
+        float SegmentBoxClosestT(const XMFLOAT3& a, const XMFLOAT3& d, const XMFLOAT3& h, float& outDistSq)
+        {
+            const float pa[3] = { a.x, a.y, a.z };
+            const float pd[3] = { d.x, d.y, d.z };
+            const float ph[3] = { h.x, h.y, h.z };
+
+            // Ԃ̋E ([ + ܂_)
+            float ts[8];
+            int count = 0;
+            ts[count++] = 0.0f;
+            for (int i = 0; i < 3; ++i) {
+                if (std::abs(pd[i]) < 1e-12f) continue;
+                float t0 = (-ph[i] - pa[i]) / pd[i];
+                float t1 = ( ph[i] - pa[i]) / pd[i];
+                if (t0 > 0.0f && t0 < 1.0f) ts[count++] = t0;
+                if (t1 > 0.0f && t1 < 1.0f) ts[count++] = t1;
+            }
+            ts[count++] = 1.0f;
+            std::sort(ts, ts + count);
+
+            float bestT = 0.0f;
+            float bestDistSq = FLT_MAX;
+            for (int k = 0; k + 1 < count; ++k) {
+                float t0 = ts[k];
+                float t1 = ts[k + 1];
+                float mid = (t0 + t1) * 0.5f;
+
+                // ԓłǂ̖ʂ̊Oɂ邩2 A t^2 + 2B t + ... ܂
+                float A = 0.0f, B = 0.0f;
+                for (int i = 0; i < 3; ++i) {
+                    float p = pa[i] + pd[i] * mid;
+                    if (p > ph[i]) { A += pd[i] * pd[i]; B += pd[i] * (pa[i] - ph[i]); }
+                    else if (p < -ph[i]) { A += pd[i] * pd[i]; B += pd[i] * (pa[i] + ph[i]); }
+                }
+                float t = (A > 1e-12f) ? std::max(t0, std::min(t1, -B / A)) : t0;
+
+                float distSq = 0.0f;
+                for (int i = 0; i < 3; ++i) {
+                    float p = pa[i] + pd[i] * t;
+                    float e = std::abs(p) - ph[i];
+                    if (e > 0.0f) distSq += e * e;
+                }
+                if (distSq < bestDistSq) {
+                    bestDistSq = distSq;
+                    bestT = t;
+                }
+            }
+            outDistSq = bestDistSq;
+            return bestT;
+        }
+
+        // ɂ߂荞łꍇ́uł[_v߂
+        // [ m(t) = min(h - |p(t)|) ͋敪1̉֐Ȃ̂ŁA
+        // ől [ / e p=0 / 2̒̌_ ̂ǂꂩŎ
+        float SegmentBoxDeepestT(const XMFLOAT3& a, const XMFLOAT3& d, const XMFLOAT3& h)
+        {
+            const float pa[3] = { a.x, a.y, a.z };
+            const float pd[3] = { d.x, d.y, d.z };
+            const float ph[3] = { h.x, h.y, h.z };
+
+            auto depthAt = [&](float t) {
+                float m = FLT_MAX;
+                for (int i = 0; i < 3; ++i) {
+                    m = std::min(m, ph[i] - std::abs(pa[i] + pd[i] * t));
+                }
+                return m;
+            };
+
+            float bestT = 0.0f;
+            float bestDepth = depthAt(0.0f);
+            auto tryT = [&](float t) {
+                if (!(t > 0.0f && t <= 1.0f)) return;
+                float m = depthAt(t);
+                if (m > bestDepth) { bestDepth = m; bestT = t; }
+            };
+
+            tryT(1.0f);
+            for (int i = 0; i < 3; ++i) {
+                if (std::abs(pd[i]) < 1e-12f) continue;
+                tryT(-pa[i] / pd[i]);
+            }
+            // h_i - s_i p_i(t) = h_j - s_j p_j(t)  (s = }1)
+            for (int i = 0; i < 3; ++i) {
+                for (int j = i + 1; j < 3; ++j) {
+                    for (int si = -1; si <= 1; si += 2) {
+                        for (int sj = -1; sj <= 1; sj += 2) {
+                            float denom = si * pd[i] - sj * pd[j];
+                            if (std::abs(denom) < 1e-12f) continue;
+                            tryT((ph[i] - ph[j] - si * pa[i] + sj * pa[j]) / denom);
+                        }
+                    }
+                }
+            }
+            return bestT;
+        }
+    }
+
+    bool CapsuleOBBContact(const XMFLOAT3& segStart, const XMFLOAT3& segEnd, float radius,
+        const XMFLOAT4X4& boxWorldF, const XMFLOAT4X4& boxInvWorldF, const XMFLOAT3& half,
+        XMFLOAT3& outPush, float& outGap) {
+        outPush = { 0.0f, 0.0f, 0.0f };
+        const XMMATRIX boxWorld = XMLoadFloat4x4(&boxWorldF);
+        const XMMATRIX boxInvWorld = XMLoadFloat4x4(&boxInvWorldF);
+
+        // c𔠂̃[JԂ
+        XMFLOAT3 segA, segD;
+        XMStoreFloat3(&segA, XMVector3TransformCoord(XMLoadFloat3(&segStart), boxInvWorld));
+        XMStoreFloat3(&segD, XMVector3TransformCoord(XMLoadFloat3(&segEnd), boxInvWorld) - XMLoadFloat3(&segA));
+
+        float distSq;
+        float t = SegmentBoxClosestT(segA, segD, half, distSq);
+        outGap = std::sqrt(distSq) - radius;
+
+        if (distSq >= (radius * radius) + 0.0001f) return false;
+
+        float dist = std::sqrt(distSq);
+        float pen = radius - dist;
+        if (pen <= 0.0f) pen = 0.001f;
+        XMVECTOR pushL;
+        if (dist > 0.00001f) {
+            // 󂢐ڐG: ŋߓ_痣
+            XMFLOAT3 p = { segA.x + segD.x * t, segA.y + segD.y * t, segA.z + segD.z * t };
+            float dx = p.x - std::max<float>(-half.x, std::min<float>(p.x, half.x));
+            float dy = p.y - std::max<float>(-half.y, std::min<float>(p.y, half.y));
+            float dz = p.z - std::max<float>(-half.z, std::min<float>(p.z, half.z));
+            pushL = XMVectorSet(dx / dist, dy / dist, dz / dist, 0);
+        }
+        else {
+            // c̒: ł[_ԋ߂ʂ̕
+            t = SegmentBoxDeepestT(segA, segD, half);
+            XMFLOAT3 p = { segA.x + segD.x * t, segA.y + segD.y * t, segA.z + segD.z * t };
+            float dX = half.x - std::abs(p.x); float dY = half.y - std::abs(p.y); float dZ = half.z - std::abs(p.z);
+            if (dX < dY && dX < dZ) pushL = XMVectorSet((p.x > 0 ? 1.0f : -1.0f), 0, 0, 0);
+            else if (dY < dZ)       pushL = XMVectorSet(0, (p.y > 0 ? 1.0f : -1.0f), 0, 0);
+            else                    pushL = XMVectorSet(0, 0, (p.z > 0 ? 1.0f : -1.0f), 0);
+            pen = radius + std::min({ dX, dY, dZ });
+        }
+        XMStoreFloat3(&outPush, XMVector3TransformNormal(pushL, boxWorld) * pen);
+        return true;
+    }
+
+    // -----------------------------------------------------------------
+    // UniformGrid
+    // -----------------------------------------------------------------
+    namespace {
+        // Z̏ (L1ĂH߂Ȃ悤)
+        constexpr int GRID_MAX_CELLS = 256 * 256;
+
+        inline int CellOf(float v, float invCell) { return (int)std::floor(v * invCell); }
+    }
+
+    void UniformGrid::Clear() {
+        cellsX = cellsZ = 0;
+        cellStart.clear();
+        items.clear();
+    }
+
+    void UniformGrid::Build(const OBBSoA& b, float size) {
+        Clear();
+        const size_t count = b.Size();
+        if (count == 0) return;
+
+        // eOBB̃[hAABB (XẐ)
+        std::vector<float> minX(count), maxX(count), minZ(count), maxZ(count);
+        float worldMinX = FLT_MAX, worldMaxX = -FLT_MAX, worldMinZ = FLT_MAX, worldMaxZ = -FLT_MAX;
+        for (size_t i = 0; i < count; ++i) {
+            const float hx = std::fabs(b.r00[i]) * b.ex[i] + std::fabs(b.r10[i]) * b.ey[i] + std::fabs(b.r20[i]) * b.ez[i];
+            const float hz = std::fabs(b.r02[i]) * b.ex[i] + std::fabs(b.r12[i]) * b.ey[i] + std::fabs(b.r22[i]) * b.ez[i];
+            minX[i] = b.cx[i] - hx; maxX[i] = b.cx[i] + hx;
+            minZ[i] = b.cz[i] - hz; maxZ[i] = b.cz[i] + hz;
+            worldMinX = std::fmin(worldMinX, minX[i]); worldMaxX = std::fmax(worldMaxX, maxX[i]);
+            worldMinZ = std::fmin(worldMinZ, minZ[i]); worldMaxZ = std::fmax(worldMaxZ, maxZ[i]);
+        }
+
+        // Z𒴂ȂZ{Xɑ傫
+        cellSize = (size > 0.0f) ? size : 1.0f;
+        for (;;) {
+            invCellSize = 1.0f / cellSize;
+            originX = CellOf(worldMinX, invCellSize);
+            originZ = CellOf(worldMinZ, invCellSize);
+            cellsX = CellOf(worldMaxX, invCellSize) - originX + 1;
+            cellsZ = CellOf(worldMaxZ, invCellSize) - originZ + 1;
+            if ((long long)cellsX * cellsZ <= GRID_MAX_CELLS) break;
+            cellSize *= 2.0f;
+        }
+
+        // 1pX: ZƂ̌𐔂 / 2pX: l߂
+        cellStart.assign((size_t)cellsX * cellsZ + 1, 0);
+        std::vector<uint32_t> cursor;
+        for (int pass = 0; pass < 2; ++pass) {
+            if (pass == 1) {
+                for (size_t c = 1; c < cellStart.size(); ++c) cellStart[c] += cellStart[c - 1];
+                items.resize(cellStart.back());
+                cursor.assign(cellStart.begin(), cellStart.end() - 1);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                const int x0 = CellOf(minX[i], invCellSize) - originX, x1 = CellOf(maxX[i], invCellSize) - originX;
+                const int z0 = CellOf(minZ[i], invCellSize) - originZ, z1 = CellOf(maxZ[i], invCellSize) - originZ;
+                for (int z = z0; z <= z1; ++z) {
+                    for (int x = x0; x <= x1; ++x) {
+                        const size_t cell = (size_t)z * cellsX + x;
+                        if (pass == 0) ++cellStart[cell + 1];
+                        else items[cursor[cell]++] = (uint32_t)i;
+                    }
+                }
+            }
+        }
+    }
+
+    void UniformGrid::QuerySegment(const XMFLOAT3& a, const XMFLOAT3& b, float radius,
+        std::vector<uint32_t>& outIndices) const {
+        outIndices.clear();
+        if (cellsX == 0 || cellsZ == 0) return;
+
+        const int x0 = std::max(CellOf(std::fmin(a.x, b.x) - radius, invCellSize) - originX, 0);
+        const int x1 = std::min(CellOf(std::fmax(a.x, b.x) + radius, invCellSize) - originX, cellsX - 1);
+        const int z0 = std::max(CellOf(std::fmin(a.z, b.z) - radius, invCellSize) - originZ, 0);
+        const int z1 = std::min(CellOf(std::fmax(a.z, b.z) + radius, invCellSize) - originZ, cellsZ - 1);
+        if (x0 > x1 || z0 > z1) return;
+
+        for (int z = z0; z <= z1; ++z) {
+            for (int x = x0; x <= x1; ++x) {
+                const size_t cell = (size_t)z * cellsX + x;
+                outIndices.insert(outIndices.end(), items.begin() + cellStart[cell], items.begin() + cellStart[cell + 1]);
+            }
+        }
+
+        // Zɂ܂OBB1񂾂Ԃ
+        // (ObhɏԂȂ̂ŁAXbh瓯ɌĂł悢)
+        std::sort(outIndices.begin(), outIndices.end());
+        outIndices.erase(std::unique(outIndices.begin(), outIndices.end()), outIndices.end());
+    }
+}
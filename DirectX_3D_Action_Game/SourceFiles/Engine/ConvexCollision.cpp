@@ -0,0 +1,555 @@
+/*===================================================================
+// ファイル: ConvexCollision.cpp
+// 概要: サポート関数による凸形状の当たり判定（実装部）
+//       GJK は単体(最大4点)上の原点への最近点を重心座標で持ち、
+//       最近点 (A側/B側) もそこから求める
+=====================================================================*/
+#include "Engine/ConvexCollision.h"
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <initializer_list>
+
+using namespace DirectX;
+
+namespace Collision {
+
+    namespace {
+        // GJK の反復回数の上限 (箱・凸包でも普通は 3～6 回で収束する)
+        constexpr int GJK_MAX_ITERATIONS = 32;
+        // 収束判定: これ以上近づかなければ最近点とみなす (距離^2 に対する比)
+        constexpr float GJK_REL_EPS = 1e-6f;
+        // 芯同士がこれより近ければ重なりとして EPA に回す
+        constexpr float GJK_OVERLAP_DIST = 1e-5f;
+
+        constexpr int EPA_MAX_ITERATIONS = 32;
+        constexpr int EPA_MAX_VERTICES = 64;
+        constexpr int EPA_MAX_FACES = 128;
+        constexpr int EPA_MAX_EDGES = 64;
+        // 面をこれ以上押し広げられなければ、その面までの距離を深さとする
+        constexpr float EPA_TOLERANCE = 1e-4f;
+        // 新しい頂点がこれより面の平面に近ければ、その面も見えているとして消す
+        // (箱同士の差は同じ平面に三角形が並ぶので、0 で切ると平面上の点で裏返った面ができる)
+        constexpr float EPA_COPLANAR = 1e-5f;
+
+        inline XMFLOAT3 Add(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+        inline XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+        inline XMFLOAT3 Mul(const XMFLOAT3& a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+        inline XMFLOAT3 Neg(const XMFLOAT3& a) { return { -a.x, -a.y, -a.z }; }
+        inline float Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+        inline XMFLOAT3 Cross(const XMFLOAT3& a, const XMFLOAT3& b) {
+            return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+
+        // ミンコフスキー差 A - B の頂点 (どちらの点から作ったかも覚えておく)
+        struct SupportPoint {
+            XMFLOAT3 w;     // a - b
+            XMFLOAT3 a;
+            XMFLOAT3 b;
+        };
+
+        // withMargin = true なら丸みを含めた表面のサポート点
+        SupportPoint SupportOf(const ConvexShape& a, const ConvexShape& b, const XMFLOAT3& dir, bool withMargin) {
+            SupportPoint p;
+            p.a = a.Support(dir);
+            p.b = b.Support(Neg(dir));
+            if (withMargin) {
+                const float lenSq = Dot(dir, dir);
+                if (lenSq > 1e-20f) {
+                    const XMFLOAT3 n = Mul(dir, 1.0f / std::sqrt(lenSq));
+                    p.a = Add(p.a, Mul(n, a.radius));
+                    p.b = Sub(p.b, Mul(n, b.radius));
+                }
+            }
+            p.w = Sub(p.a, p.b);
+            return p;
+        }
+
+        // 単体 (点・線分・三角形・四面体) と、原点への最近点の重心座標
+        struct Simplex {
+            SupportPoint p[4];
+            float lambda[4] = {};
+            int count = 0;
+
+            // 使う頂点だけ残して詰める
+            void Keep(std::initializer_list<int> indices, std::initializer_list<float> weights) {
+                SupportPoint kept[4];
+                int n = 0;
+                for (int i : indices) kept[n++] = p[i];
+                n = 0;
+                for (float w : weights) lambda[n++] = w;
+                for (int i = 0; i < n; ++i) p[i] = kept[i];
+                count = n;
+            }
+            XMFLOAT3 Point() const {
+                XMFLOAT3 v = { 0.0f, 0.0f, 0.0f };
+                for (int i = 0; i < count; ++i) v = Add(v, Mul(p[i].w, lambda[i]));
+                return v;
+            }
+            void Witness(XMFLOAT3& outA, XMFLOAT3& outB) const {
+                outA = outB = { 0.0f, 0.0f, 0.0f };
+                for (int i = 0; i < count; ++i) {
+                    outA = Add(outA, Mul(p[i].a, lambda[i]));
+                    outB = Add(outB, Mul(p[i].b, lambda[i]));
+                }
+            }
+        };
+
+        // 三角形 (i0,i1,i2) 上の原点への最近点 (Ericson の領域判定)
+        // 結果は simplex を最近点を含む面/辺/頂点まで縮めて書く
+        void ClosestOnTriangle(Simplex& s, int i0, int i1, int i2) {
+            const XMFLOAT3 a = s.p[i0].w, b = s.p[i1].w, c = s.p[i2].w;
+            const XMFLOAT3 ab = Sub(b, a), ac = Sub(c, a);
+
+            const XMFLOAT3 ap = Neg(a);
+            const float d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+            if (d1 <= 0.0f && d2 <= 0.0f) { s.Keep({ i0 }, { 1.0f }); return; }
+
+            const XMFLOAT3 bp = Neg(b);
+            const float d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+            if (d3 >= 0.0f && d4 <= d3) { s.Keep({ i1 }, { 1.0f }); return; }
+
+            const float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+                const float t = d1 / (d1 - d3);
+                s.Keep({ i0, i1 }, { 1.0f - t, t });
+                return;
+            }
+
+            const XMFLOAT3 cp = Neg(c);
+            const float d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+            if (d6 >= 0.0f && d5 <= d6) { s.Keep({ i2 }, { 1.0f }); return; }
+
+            const float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+                const float t = d2 / (d2 - d6);
+                s.Keep({ i0, i2 }, { 1.0f - t, t });
+                return;
+            }
+
+            const float va = d3 * d6 - d5 * d4;
+            if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+                const float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                s.Keep({ i1, i2 }, { 1.0f - t, t });
+                return;
+            }
+
+            const float denom = 1.0f / (va + vb + vc);
+            const float v = vb * denom, w = vc * denom;
+            s.Keep({ i0, i1, i2 }, { 1.0f - v - w, v, w });
+        }
+
+        // 面 (a,b,c) の平面について、原点が d と反対側にあるか
+        // (四面体がつぶれている時も外側として扱い、面ごとの最近点に任せる)
+        bool OriginOutsideFace(const XMFLOAT3& a, const XMFLOAT3& b, const XMFLOAT3& c, const XMFLOAT3& d) {
+            const XMFLOAT3 n = Cross(Sub(b, a), Sub(c, a));
+            const float signOrigin = -Dot(a, n);
+            const float signD = Dot(Sub(d, a), n);
+            if (signD * signD < 1e-12f * Dot(n, n)) return true;
+            return signOrigin * signD < 0.0f;
+        }
+
+        // 単体上の原点への最近点を求めて、単体を縮める
+        // 戻り値: 原点が四面体の内側にある (= 重なっている)
+        bool ClosestOnSimplex(Simplex& s) {
+            switch (s.count) {
+            case 1:
+                s.lambda[0] = 1.0f;
+                return false;
+            case 2: {
+                const XMFLOAT3 a = s.p[0].w;
+                const XMFLOAT3 ab = Sub(s.p[1].w, a);
+                const float lenSq = Dot(ab, ab);
+                const float t = (lenSq > 1e-20f) ? -Dot(a, ab) / lenSq : 0.0f;
+                if (t <= 0.0f) s.Keep({ 0 }, { 1.0f });
+                else if (t >= 1.0f) s.Keep({ 1 }, { 1.0f });
+                else s.Keep({ 0, 1 }, { 1.0f - t, t });
+                return false;
+            }
+            case 3:
+                ClosestOnTriangle(s, 0, 1, 2);
+                return false;
+            default: {
+                // 原点の外側にある面のうち、最近点が一番近いもの
+                static constexpr int FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+                Simplex best;
+                float bestDistSq = FLT_MAX;
+                bool outside = false;
+                for (const auto& f : FACES) {
+                    if (!OriginOutsideFace(s.p[f[0]].w, s.p[f[1]].w, s.p[f[2]].w, s.p[f[3]].w)) continue;
+                    outside = true;
+                    Simplex candidate = s;
+                    ClosestOnTriangle(candidate, f[0], f[1], f[2]);
+                    const XMFLOAT3 v = candidate.Point();
+                    const float distSq = Dot(v, v);
+                    if (distSq < bestDistSq) {
+                        bestDistSq = distSq;
+                        best = candidate;
+                    }
+                }
+                if (!outside) return true;
+                s = best;
+                return false;
+            }
+            }
+        }
+
+        // GJK 本体
+        // 戻り値: 離れている (false なら原点を含む単体が s に残る)
+        bool RunGjk(const ConvexShape& a, const ConvexShape& b, bool withMargin, Simplex& s, XMFLOAT3& v, int& iterations) {
+            XMFLOAT3 dir = Sub(a.center, b.center);
+            if (Dot(dir, dir) < 1e-12f) dir = { 1.0f, 0.0f, 0.0f };
+            s.count = 1;
+            s.p[0] = SupportOf(a, b, dir, withMargin);
+            s.lambda[0] = 1.0f;
+            v = s.p[0].w;
+
+            iterations = 0;
+            float prevDistSq = FLT_MAX;
+            while (iterations < GJK_MAX_ITERATIONS) {
+                ++iterations;
+                const float distSq = Dot(v, v);
+                if (distSq < GJK_OVERLAP_DIST * GJK_OVERLAP_DIST) return false;
+
+                const SupportPoint w = SupportOf(a, b, Neg(v), withMargin);
+                // これ以上原点に近づけない
+                if (distSq - Dot(v, w.w) <= GJK_REL_EPS * distSq) return true;
+                // 同じ頂点が出てきた (数値誤差で足踏みしている)
+                bool duplicate = false;
+                for (int i = 0; i < s.count; ++i) {
+                    const XMFLOAT3 d = Sub(s.p[i].w, w.w);
+                    if (Dot(d, d) < 1e-12f) { duplicate = true; break; }
+                }
+                if (duplicate) return true;
+
+                s.p[s.count++] = w;
+                if (ClosestOnSimplex(s)) return false;
+                v = s.Point();
+
+                const float newDistSq = Dot(v, v);
+                if (newDistSq >= prevDistSq) return true; // 近づかなくなった
+                prevDistSq = newDistSq;
+            }
+            return true;
+        }
+
+        // GJK が原点を含む点/線分/三角形で終わった時に、四面体まで膨らませる
+        // 差の形に体積がなければ (点と点・点と線分など) 膨らませられないので false
+        bool BlowUpToTetrahedron(const ConvexShape& a, const ConvexShape& b, bool withMargin, Simplex& s) {
+            static const XMFLOAT3 AXES[6] = {
+                { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f },
+                { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f },
+            };
+            constexpr float MIN_GROW = 1e-6f;
+
+            if (s.count == 1) {
+                for (const XMFLOAT3& d : AXES) {
+                    SupportPoint p = SupportOf(a, b, d, withMargin);
+                    const XMFLOAT3 e = Sub(p.w, s.p[0].w);
+                    if (Dot(e, e) > MIN_GROW) { s.p[s.count++] = p; break; }
+                }
+                if (s.count < 2) return false;
+            }
+            if (s.count == 2) {
+                const XMFLOAT3 line = Sub(s.p[1].w, s.p[0].w);
+                // 線分に垂直な向き (一番直交に近い軸との外積)
+                const XMFLOAT3 ax = std::abs(line.x) < std::abs(line.y)
+                    ? (std::abs(line.x) < std::abs(line.z) ? AXES[0] : AXES[4])
+                    : (std::abs(line.y) < std::abs(line.z) ? AXES[2] : AXES[4]);
+                const XMFLOAT3 perp1 = Cross(line, ax);
+                const XMFLOAT3 perp2 = Cross(line, perp1);
+                const XMFLOAT3 dirs[4] = { perp1, perp2, Neg(perp1), Neg(perp2) };
+                const float lineLenSq = Dot(line, line);
+                for (const XMFLOAT3& d : dirs) {
+                    SupportPoint p = SupportOf(a, b, d, withMargin);
+                    const XMFLOAT3 e = Cross(line, Sub(p.w, s.p[0].w));
+                    if (Dot(e, e) > MIN_GROW * lineLenSq) { s.p[s.count++] = p; break; }
+                }
+                if (s.count < 3) return false;
+            }
+            if (s.count == 3) {
+                const XMFLOAT3 n = Cross(Sub(s.p[1].w, s.p[0].w), Sub(s.p[2].w, s.p[0].w));
+                const float nLen = std::sqrt(Dot(n, n));
+                if (nLen < 1e-12f) return false;
+                for (const XMFLOAT3& d : { n, Neg(n) }) {
+                    SupportPoint p = SupportOf(a, b, d, withMargin);
+                    if (std::abs(Dot(Sub(p.w, s.p[0].w), n)) > MIN_GROW * nLen) { s.p[s.count++] = p; break; }
+                }
+                if (s.count < 4) return false;
+            }
+            return true;
+        }
+
+        // 体積のない芯の差 (点・線分・平面) に垂直な向きのうち、hint (中心の差) に一番近いもの
+        // 芯同士が交わっているだけなら、この向きに丸みの分だけ動かすのが一番浅い
+        XMFLOAT3 FlatNormal(const Simplex& s, const XMFLOAT3& hint) {
+            XMFLOAT3 n = hint;
+            bool found = false;
+            if (s.count >= 3) {
+                // 平面: その法線 (向きは hint にそろえる)
+                const XMFLOAT3 face = Cross(Sub(s.p[1].w, s.p[0].w), Sub(s.p[2].w, s.p[0].w));
+                if (Dot(face, face) > 1e-12f) {
+                    n = (Dot(face, hint) >= 0.0f) ? face : Neg(face);
+                    found = true;
+                }
+            }
+            if (!found && s.count >= 2) {
+                // 線分: hint から線分の向きの成分を除く。hint が線分と平行なら、一番直交に近い軸との外積
+                const XMFLOAT3 line = Sub(s.p[1].w, s.p[0].w);
+                const float lineLenSq = Dot(line, line);
+                if (lineLenSq > 1e-12f) {
+                    n = Sub(hint, Mul(line, Dot(hint, line) / lineLenSq));
+                    if (Dot(n, n) < 1e-12f * lineLenSq) {
+                        const XMFLOAT3 ax = (std::abs(line.x) <= std::abs(line.y) && std::abs(line.x) <= std::abs(line.z))
+                            ? XMFLOAT3{ 1.0f, 0.0f, 0.0f }
+                            : (std::abs(line.y) <= std::abs(line.z) ? XMFLOAT3{ 0.0f, 1.0f, 0.0f } : XMFLOAT3{ 0.0f, 0.0f, 1.0f });
+                        n = Cross(line, ax);
+                    }
+                }
+            }
+            // 点 (球同士など): hint のまま。中心まで一致していれば上へ
+            const float lenSq = Dot(n, n);
+            return (lenSq > 1e-12f) ? Mul(n, 1.0f / std::sqrt(lenSq)) : XMFLOAT3{ 0.0f, 1.0f, 0.0f };
+        }
+
+        // EPA: 原点を含む四面体から、原点に一番近い表面までの距離と向きを求める
+        // 戻り値の normal は A-B の外向き (A を -normal * depth 動かすと離れる)
+        bool RunEpa(const ConvexShape& a, const ConvexShape& b, bool withMargin, const Simplex& seed,
+            XMFLOAT3& outNormal, float& outDepth, int& iterations) {
+            struct Face { int i0, i1, i2; XMFLOAT3 n; float d; };
+            XMFLOAT3 verts[EPA_MAX_VERTICES];
+            Face faces[EPA_MAX_FACES];
+            int vertCount = 0, faceCount = 0;
+
+            for (int i = 0; i < 4; ++i) verts[vertCount++] = seed.p[i].w;
+            const XMFLOAT3 centroid = Mul(Add(Add(verts[0], verts[1]), Add(verts[2], verts[3])), 0.25f);
+
+            auto makeFace = [&](int i0, int i1, int i2) -> bool {
+                if (faceCount >= EPA_MAX_FACES) return false;
+                Face f = { i0, i1, i2, Cross(Sub(verts[i1], verts[i0]), Sub(verts[i2], verts[i0])), 0.0f };
+                const float len = std::sqrt(Dot(f.n, f.n));
+                if (len < 1e-12f) {
+                    // つぶれた面は選ばれないように遠くに置く
+                    f.n = { 0.0f, 0.0f, 0.0f };
+                    f.d = FLT_MAX;
+                }
+                else {
+                    f.n = Mul(f.n, 1.0f / len);
+                    f.d = Dot(f.n, verts[i0]);
+                }
+                faces[faceCount++] = f;
+                return true;
+            };
+
+            // 最初の四面体 (面は重心から外向きにそろえる)
+            static constexpr int TET[4][3] = { { 0, 1, 2 }, { 0, 3, 1 }, { 0, 2, 3 }, { 1, 3, 2 } };
+            for (const auto& t : TET) {
+                int i0 = t[0], i1 = t[1], i2 = t[2];
+                const XMFLOAT3 n = Cross(Sub(verts[i1], verts[i0]), Sub(verts[i2], verts[i0]));
+                if (Dot(n, Sub(centroid, verts[i0])) > 0.0f) std::swap(i1, i2);
+                makeFace(i0, i1, i2);
+            }
+
+            iterations = 0;
+            int best = 0;
+            while (true) {
+                best = -1;
+                for (int f = 0; f < faceCount; ++f) {
+                    if (best < 0 || faces[f].d < faces[best].d) best = f;
+                }
+                if (best < 0 || faces[best].d == FLT_MAX) return false;
+                if (iterations >= EPA_MAX_ITERATIONS || vertCount >= EPA_MAX_VERTICES) break;
+                ++iterations;
+
+                const Face closest = faces[best];
+                const SupportPoint p = SupportOf(a, b, closest.n, withMargin);
+                if (Dot(p.w, closest.n) - closest.d < EPA_TOLERANCE) break;
+
+                // 新しい頂点から見える面を消し、その縁 (地平線) と新しい頂点で面を張る
+                const int newIndex = vertCount;
+                verts[vertCount++] = p.w;
+                int edges[EPA_MAX_EDGES][2];
+                int edgeCount = 0;
+                auto addEdge = [&](int e0, int e1) {
+                    for (int e = 0; e < edgeCount; ++e) {
+                        // 隣の面と共有する辺 (向きが逆) は地平線ではない
+                        if (edges[e][0] == e1 && edges[e][1] == e0) {
+                            edges[e][0] = edges[edgeCount - 1][0];
+                            edges[e][1] = edges[edgeCount - 1][1];
+                            --edgeCount;
+                            return true;
+                        }
+                    }
+                    if (edgeCount >= EPA_MAX_EDGES) return false;
+                    edges[edgeCount][0] = e0;
+                    edges[edgeCount][1] = e1;
+                    ++edgeCount;
+                    return true;
+                };
+                bool overflow = false;
+                for (int f = 0; f < faceCount;) {
+                    const Face& face = faces[f];
+                    if (face.d != FLT_MAX && Dot(face.n, Sub(p.w, verts[face.i0])) > -EPA_COPLANAR) {
+                        overflow |= !addEdge(face.i0, face.i1);
+                        overflow |= !addEdge(face.i1, face.i2);
+                        overflow |= !addEdge(face.i2, face.i0);
+                        faces[f] = faces[--faceCount];
+                    }
+                    else {
+                        ++f;
+                    }
+                }
+                if (overflow) { faces[faceCount++] = closest; best = faceCount - 1; break; }
+                for (int e = 0; e < edgeCount; ++e) {
+                    if (!makeFace(edges[e][0], edges[e][1], newIndex)) { overflow = true; break; }
+                }
+                if (overflow) { faces[faceCount++] = closest; best = faceCount - 1; break; }
+            }
+
+            outNormal = faces[best].n;
+            outDepth = std::max(0.0f, faces[best].d);
+            return true;
+        }
+    }
+
+    // -----------------------------------------------------------------
+    // 形状
+    // -----------------------------------------------------------------
+    ConvexShape ConvexShape::Sphere(const XMFLOAT3& center, float radius) {
+        ConvexShape s;
+        s.core = Core::Point;
+        s.center = center;
+        s.radius = radius;
+        return s;
+    }
+
+    ConvexShape ConvexShape::Capsule(const XMFLOAT3& center, const XMFLOAT3& axisY, float halfLen, float radius) {
+        ConvexShape s;
+        s.core = Core::Segment;
+        s.center = center;
+        s.axis[1] = axisY;
+        s.half = { 0.0f, halfLen, 0.0f };
+        s.radius = radius;
+        return s;
+    }
+
+    ConvexShape ConvexShape::Box(const XMFLOAT4X4& world, const XMFLOAT3& halfExtents) {
+        ConvexShape s;
+        s.core = Core::Box;
+        s.center = { world.m[3][0], world.m[3][1], world.m[3][2] };
+        s.axis[0] = { world.m[0][0], world.m[0][1], world.m[0][2] };
+        s.axis[1] = { world.m[1][0], world.m[1][1], world.m[1][2] };
+        s.axis[2] = { world.m[2][0], world.m[2][1], world.m[2][2] };
+        s.half = halfExtents;
+        return s;
+    }
+
+    ConvexShape ConvexShape::Hull(const XMFLOAT4X4& world, const XMFLOAT3& scale,
+        const XMFLOAT3* points, uint32_t pointCount) {
+        ConvexShape s = Box(world, scale);
+        s.core = Core::Hull;
+        s.points = points;
+        s.pointCount = pointCount;
+        return s;
+    }
+
+    XMFLOAT3 ConvexShape::Support(const XMFLOAT3& dir) const {
+        switch (core) {
+        case Core::Point:
+            return center;
+        case Core::Segment:
+            return Add(center, Mul(axis[1], Dot(dir, axis[1]) >= 0.0f ? half.y : -half.y));
+        case Core::Box: {
+            XMFLOAT3 p = center;
+            p = Add(p, Mul(axis[0], Dot(dir, axis[0]) >= 0.0f ? half.x : -half.x));
+            p = Add(p, Mul(axis[1], Dot(dir, axis[1]) >= 0.0f ? half.y : -half.y));
+            p = Add(p, Mul(axis[2], Dot(dir, axis[2]) >= 0.0f ? half.z : -half.z));
+            return p;
+        }
+        case Core::Hull:
+        default: {
+            // 方向をローカルに戻し、倍率を掛けた頂点との内積で一番遠い頂点を選ぶ
+            const XMFLOAT3 local = {
+                Dot(dir, axis[0]) * half.x,
+                Dot(dir, axis[1]) * half.y,
+                Dot(dir, axis[2]) * half.z,
+            };
+            uint32_t bestIndex = 0;
+            float bestDot = -FLT_MAX;
+            for (uint32_t i = 0; i < pointCount; ++i) {
+                const float d = Dot(points[i], local);
+                if (d > bestDot) { bestDot = d; bestIndex = i; }
+            }
+            if (pointCount == 0) return center;
+            const XMFLOAT3& q = points[bestIndex];
+            XMFLOAT3 p = center;
+            p = Add(p, Mul(axis[0], q.x * half.x));
+            p = Add(p, Mul(axis[1], q.y * half.y));
+            p = Add(p, Mul(axis[2], q.z * half.z));
+            return p;
+        }
+        }
+    }
+
+    // -----------------------------------------------------------------
+    // 判定
+    // -----------------------------------------------------------------
+    bool GjkClosestPoints(const ConvexShape& a, const ConvexShape& b,
+        float& outDist, XMFLOAT3& outPointA, XMFLOAT3& outPointB, int* outIterations) {
+        Simplex s;
+        XMFLOAT3 v;
+        int iterations = 0;
+        const bool separated = RunGjk(a, b, false, s, v, iterations);
+        if (outIterations) *outIterations = iterations;
+        if (!separated) return false;
+        outDist = std::sqrt(Dot(v, v));
+        s.Witness(outPointA, outPointB);
+        return true;
+    }
+
+    bool ConvexOverlap(const ConvexShape& a, const ConvexShape& b, ConvexContact& out) {
+        out.epaIterations = 0;
+        const float margin = a.radius + b.radius;
+
+        // 1. 芯同士の最近点 (離れていれば、距離から丸みを引くだけで済む)
+        float coreDist;
+        XMFLOAT3 pa, pb;
+        if (GjkClosestPoints(a, b, coreDist, pa, pb, &out.gjkIterations) && coreDist > GJK_OVERLAP_DIST) {
+            out.normal = Mul(Sub(pa, pb), 1.0f / coreDist);
+            out.distance = coreDist - margin;
+            return out.distance < 0.0f;
+        }
+
+        // 2. 芯まで重なっている: 原点を囲む四面体を作って EPA
+        //    芯の差に体積があれば (箱・凸包が相手) 芯だけで求めて丸みを足す (面が平らなので正確に収束する)
+        //    なければ (球同士・交わるカプセルなど) 芯の差は原点を通る点/線分/平面なので、
+        //    それに垂直に丸みの分だけ押すのが厳密な答え (丸みを含めた EPA は球面を多面体で
+        //    追いかけるので収束しない)
+        //    芯の EPA が面を作れなかった時だけ、丸みを含めた表面で求め直す
+        for (bool withMargin : { false, true }) {
+            Simplex s;
+            XMFLOAT3 v;
+            int iterations = 0;
+            if (RunGjk(a, b, withMargin, s, v, iterations)) continue;
+            if (!BlowUpToTetrahedron(a, b, withMargin, s)) {
+                if (withMargin) continue;
+                out.normal = FlatNormal(s, Sub(a.center, b.center));
+                out.distance = -margin;
+                return true;
+            }
+            XMFLOAT3 n;
+            float depth;
+            if (!RunEpa(a, b, withMargin, s, n, depth, out.epaIterations)) continue;
+            out.normal = Neg(n);
+            out.distance = -(withMargin ? depth : depth + margin);
+            return true;
+        }
+
+        // 3. どちらの EPA も求まらない: 中心同士の向きに丸みの分だけ押す
+        XMFLOAT3 d = Sub(a.center, b.center);
+        const float len = std::sqrt(Dot(d, d));
+        out.normal = (len > 1e-6f) ? Mul(d, 1.0f / len) : XMFLOAT3{ 0.0f, 1.0f, 0.0f };
+        out.distance = -margin;
+        return true;
+    }
+}
@@ -239,6 +239,18 @@ bool Graphics::InitD2D(IDXGISwapChain* swapChain)
 
 // _VF[_[쐬
 bool Graphics::CreateVertexShader(const std::wstring& filename, ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppInputLayout)
+{
+    // ̓CAEgi_f[^̌`j̒`
+    // Vertex.h ̍\ƍ킹Kv܂
+    D3D11_INPUT_ELEMENT_DESC layout[] = {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+    };
+    return CreateVertexShader(filename, layout, ARRAYSIZE(layout), ppVertexShader, ppInputLayout);
+}
+
+bool Graphics::CreateVertexShader(const std::wstring& filename, const D3D11_INPUT_ELEMENT_DESC* layout, UINT layoutCount,
+    ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppInputLayout)
 {
     ComPtr<ID3DBlob> pVSBlob;
     // hlslt@CRpC (Gg[|Cg:main, f:vs_5_0)
@@ -251,15 +263,8 @@ bool Graphics::CreateVertexShader(const std::wstring& filename, ID3D11VertexShad
     HRESULT hr = pDevice->CreateVertexShader(pVSBlob->GetBufferPointer(), pVSBlob->GetBufferSize(), nullptr, ppVertexShader);
     if (FAILED(hr)) return false;
 
-    // ̓CAEgi_f[^̌`j̒`
-    // Vertex.h ̍\ƍ킹Kv܂
-    D3D11_INPUT_ELEMENT_DESC layout[] = {
-        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-        { "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-    };
-
     hr = pDevice->CreateInputLayout(
-        layout, ARRAYSIZE(layout),
+        layout, layoutCount,
         pVSBlob->GetBufferPointer(),
         pVSBlob->GetBufferSize(),
         ppInputLayout
@@ -331,6 +336,20 @@ bool Graphics::CreateVertexBuffer(const std::vector<Vertex>& vertices, ID3D11Buf
     return (SUCCEEDED(hr));
 }
 
+bool Graphics::CreateDynamicVertexBuffer(UINT byteWidth, ID3D11Buffer** ppBuffer)
+{
+    if (byteWidth == 0) return false;
+
+    D3D11_BUFFER_DESC bd = {};
+    bd.Usage = D3D11_USAGE_DYNAMIC;
+    bd.ByteWidth = byteWidth;
+    bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    HRESULT hr = pDevice->CreateBuffer(&bd, nullptr, ppBuffer);
+    return (SUCCEEDED(hr));
+}
+
 bool Graphics::CreateIndexBuffer(const std::vector<UINT>& indices, ID3D11Buffer** ppBuffer)
 {
     if (indices.empty()) return false;
@@ -4,6 +4,8 @@ void Input::Initialize(HWND hWnd) {
     m_hWnd = hWnd;
     currentKeys.fill(false);
     previousKeys.fill(false);
+    latchedDown.fill(false);
+    latchedUp.fill(false);
 }
 
 void Input::Update() {
@@ -12,18 +14,30 @@ void Input::Update() {
     for (int i = 0; i < 256; ++i) {
         // ŏʃrbgĂΉĂ
         currentKeys[i] = (GetAsyncKeyState(i) & 0x8000) != 0;
+
+        // ŒXebvpɗ߂Ă
+        if (currentKeys[i] && !previousKeys[i]) latchedDown[i] = true;
+        if (!currentKeys[i] && previousKeys[i]) latchedUp[i] = true;
     }
 }
+
+void Input::EndFixedStep() {
+    m_inFixedStep = false;
+    latchedDown.fill(false);
+    latchedUp.fill(false);
+}
 // --- L[{[h ---
 bool Input::IsKey(int key) const {
     return currentKeys[key];
 }
 
 bool Input::IsKeyDown(int key) const {
+    if (m_inFixedStep) return latchedDown[key];
     return currentKeys[key] && !previousKeys[key];
 }
 
 bool Input::IsKeyUp(int key) const {
+    if (m_inFixedStep) return latchedUp[key];
     return !currentKeys[key] && previousKeys[key];
 }
 //}EX
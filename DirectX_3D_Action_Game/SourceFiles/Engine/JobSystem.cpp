@@ -0,0 +1,96 @@
+/*===================================================================
+// t@C: JobSystem.cpp
+// Tv: ȈՃWuVXeij
+=====================================================================*/
+#include "Engine/JobSystem.h"
+#include <algorithm>
+
+JobSystem::JobSystem(unsigned workerCount) {
+    if (workerCount == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        workerCount = (hw > 1) ? hw - 1 : 0;
+    }
+    workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        // 0Ԃ͌ĂяoȂ̂ŁA[J[1Ԃ
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    wakeCv.notify_all();
+    for (auto& t : workers) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void JobSystem::RunChunks(unsigned threadIndex) {
+    const size_t chunkCount = (jobCount + jobGrain - 1) / jobGrain;
+    for (;;) {
+        const size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= chunkCount) break;
+        const size_t begin = chunk * jobGrain;
+        const size_t end = std::min(begin + jobGrain, jobCount);
+        (*job)(begin, end, threadIndex);
+    }
+}
+
+void JobSystem::WorkerLoop(unsigned threadIndex) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeCv.wait(lock, [&] { return quit || generation != seen; });
+            if (quit) return;
+            seen = generation;
+            // ̎dɎQȂ[J[͎҂
+            if (threadIndex > jobThreads) continue;
+        }
+
+        RunChunks(threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0) doneCv.notify_one();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grain, const RangeFunc& func, unsigned maxThreads) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+
+    unsigned threads = GetThreadCount();
+    if (maxThreads > 0) threads = std::min(threads, maxThreads);
+    const size_t chunkCount = (count + grain - 1) / grain;
+    threads = (unsigned)std::min<size_t>(threads, chunkCount);
+
+    // قǂ̗ʂȂ΂̏ŏ
+    if (threads <= 1) {
+        func(0, count, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &func;
+        jobCount = count;
+        jobGrain = grain;
+        jobThreads = threads - 1;
+        nextChunk.store(0, std::memory_order_relaxed);
+        running = threads - 1;
+        ++generation;
+    }
+    wakeCv.notify_all();
+
+    // Ăяo0ԂƂĎQ
+    RunChunks(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCv.wait(lock, [&] { return running == 0; });
+    job = nullptr;
+}
@@ -0,0 +1,53 @@
+/*===================================================================
+// ファイル: SpatialHash.cpp
+// 概要: 点の空間ハッシュ（実装部）
+=====================================================================*/
+#include "Engine/SpatialHash.h"
+
+void SpatialHash::Clear() {
+    pendingIds.clear();
+    pendingPositions.clear();
+    ids.clear();
+    positions.clear();
+}
+
+void SpatialHash::Add(uint32_t id, const DirectX::XMFLOAT3& position) {
+    pendingIds.push_back(id);
+    pendingPositions.push_back(position);
+}
+
+void SpatialHash::Build(float size) {
+    cellSize = (size > 0.0f) ? size : 1.0f;
+    invCellSize = 1.0f / cellSize;
+
+    // バケット数は点の数の2倍以上の2のべき乗 (ぶつかりを減らす)
+    const size_t count = pendingIds.size();
+    uint32_t bucketCount = 64;
+    while (bucketCount < count * 2) bucketCount <<= 1;
+    mask = bucketCount - 1;
+
+    // 1パス目: バケットごとの個数を数える / 2パス目: Add した順のまま詰める
+    bucketStart.assign((size_t)bucketCount + 1, 0);
+    pendingBuckets.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const DirectX::XMFLOAT3& p = pendingPositions[i];
+        const uint32_t bucket = BucketOf(CellOf(p.x, invCellSize), CellOf(p.z, invCellSize));
+        pendingBuckets[i] = bucket;
+        ++bucketStart[bucket + 1];
+    }
+    for (size_t b = 1; b < bucketStart.size(); ++b) bucketStart[b] += bucketStart[b - 1];
+
+    ids.resize(count);
+    positions.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        // bucketStart[bucket] を書き込み位置として進め、最後に1つずらして戻す
+        const uint32_t dst = bucketStart[pendingBuckets[i]]++;
+        ids[dst] = pendingIds[i];
+        positions[dst] = pendingPositions[i];
+    }
+    for (size_t b = bucketStart.size() - 1; b > 0; --b) bucketStart[b] = bucketStart[b - 1];
+    bucketStart[0] = 0;
+
+    pendingIds.clear();
+    pendingPositions.clear();
+}
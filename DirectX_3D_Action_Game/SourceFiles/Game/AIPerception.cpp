@@ -0,0 +1,54 @@
+/*===================================================================
+// ファイル: AIPerception.cpp
+// 概要: 敵AIの知覚（実装部）
+=====================================================================*/
+#include "Game/AIPerception.h"
+#include "ECS/ECS.h"
+#include "ECS/Components/TransformComponent.h"
+#include "ECS/Components/PlayerComponent.h"
+#include "ECS/Components/StatusComponent.h"
+
+using namespace DirectX;
+
+void AIPerception::Update(Registry* registry) {
+    targets.clear();
+    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+        if (!registry->HasComponent<PlayerComponent>(id)) continue;
+        if (!registry->HasComponent<TransformComponent>(id)) continue;
+
+        PerceivedTarget t;
+        t.id = id;
+        const auto& trans = registry->GetComponent<TransformComponent>(id);
+        t.position = trans.position;
+        t.yaw = trans.rotation.y;
+        t.team = 0;
+        t.alive = !registry->HasComponent<StatusComponent>(id) || registry->GetComponent<StatusComponent>(id).hp > 0;
+        t.active = registry->GetComponent<PlayerComponent>(id).isActive;
+        targets.push_back(t);
+    }
+}
+
+int AIPerception::FindNearest(const XMFLOAT3& from, float* outDistSq) const {
+    int best = -1;
+    float bestDistSq = 0.0f;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        if (!IsTargetable(targets[i])) continue;
+        const float d = DistanceSqTo(from, (int)i);
+        if (best < 0 || d < bestDistSq) {
+            best = (int)i;
+            bestDistSq = d;
+        }
+    }
+    if (outDistSq) *outDistSq = bestDistSq;
+    return best;
+}
+
+XMVECTOR AIPerception::DirectionTo(const XMFLOAT3& from, int index) const {
+    return XMVector3Normalize(XMLoadFloat3(&targets[index].position) - XMLoadFloat3(&from));
+}
+
+float AIPerception::DistanceSqTo(const XMFLOAT3& from, int index) const {
+    const float dx = targets[index].position.x - from.x;
+    const float dz = targets[index].position.z - from.z;
+    return dx * dx + dz * dz;
+}
@@ -0,0 +1,65 @@
+/*===================================================================
+// ファイル: AIScheduler.cpp
+// 概要: 敵AIの思考スケジューラ（実装部）
+=====================================================================*/
+#include "Game/AIScheduler.h"
+#include "ECS/ECS.h"
+#include "ECS/Components/CameraComponent.h"
+#include <cmath>
+
+using namespace DirectX;
+
+// 画面端の判定を広げる量 (敵の大きさ + カメラが振られる分)
+static constexpr float SCREEN_MARGIN = 3.0f;
+
+void AIScheduler::BeginStep(Registry* registry) {
+    ++step;
+    nearEntries.clear();
+    entries.clear();
+    stats = AISchedulerStats();
+
+    // 前回の描画で使ったカメラ (なければ全部画面内として扱う)
+    hasCamera = false;
+    for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+        if (!registry->HasComponent<CameraComponent>(id)) continue;
+        const CameraComponent& cam = registry->GetComponent<CameraComponent>(id);
+        XMStoreFloat4x4(&view, cam.view);
+        tanHalfY = std::tan(cam.fov * 0.5f);
+        tanHalfX = tanHalfY * cam.aspectRatio;
+        farZ = cam.farZ;
+        hasCamera = true;
+        break;
+    }
+}
+
+bool AIScheduler::IsOnScreen(const XMFLOAT3& position) const {
+    if (!hasCamera) return true;
+    XMFLOAT3 v;
+    XMStoreFloat3(&v, XMVector3TransformCoord(XMLoadFloat3(&position), XMLoadFloat4x4(&view)));
+    if (v.z < -SCREEN_MARGIN || v.z > farZ + SCREEN_MARGIN) return false;
+    if (std::fabs(v.x) > v.z * tanHalfX + SCREEN_MARGIN) return false;
+    if (std::fabs(v.y) > v.z * tanHalfY + SCREEN_MARGIN) return false;
+    return true;
+}
+
+AILod AIScheduler::Classify(const XMFLOAT3& position, float distToTarget) const {
+    if (distToTarget < nearDistance) return AILod::Near;
+    if (distToTarget < farDistance && IsOnScreen(position)) return AILod::Mid;
+    return AILod::Far;
+}
+
+void AIScheduler::Submit(uint32_t slot, EntityID id, AILod lod, float elapsed, float dt) {
+    ++stats.submitted;
+    const uint32_t period = LOD_PERIOD[(int)lod];
+    Entry e = { slot, id, lod, (dt > 0.0f) ? elapsed / (dt * period) : 1.0f };
+
+    if (lod == AILod::Near) {
+        nearEntries.push_back(e);
+        return;
+    }
+    // IDで番をずらす (同じ間隔の敵が同じステップに固まらない)
+    // 番を待たずに間隔ぶん経っていれば、予算切れで後回しにされた分なので入れる
+    const bool myTurn = ((step + id) % period) == 0;
+    if (!myTurn && e.overdue < 1.0f) return;
+    entries.push_back(e);
+}
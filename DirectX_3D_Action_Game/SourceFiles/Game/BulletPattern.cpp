@@ -0,0 +1,35 @@
+/*===================================================================
+// ファイル: BulletPattern.cpp
+// 概要: 弾幕パターンの定義（パターン表）
+=====================================================================*/
+#include "Game/BulletPattern.h"
+#include <DirectXMath.h>
+
+// 数値は BulletPatternID の順に並べる
+static const BulletPatternDesc PATTERNS[(int)BulletPatternID::Count] = {
+    // RingBarrage: 0.1秒ごとに4方向。ボスと一緒に 2rad/s で回る
+    {
+        .ringCount = 4, .spread = DirectX::XM_2PI, .cadence = 0.1f, .rotationSpeed = 2.0f, .aim = AimMode::Ring,
+        .spawnHeight = 1.0f, .speed = 10.0f, .lifeTime = 5.0f, .damage = 20, .duration = 3.0f,
+    },
+    // RapidFire: 0.5秒ごとに1発を標的へ
+    {
+        .ringCount = 1, .cadence = 0.5f, .aim = AimMode::AtTarget,
+        .spawnHeight = 1.0f, .speed = 10.0f, .lifeTime = 5.0f, .damage = 30, .duration = 2.0f,
+    },
+    // RapidFireP2: 0.3秒ごと、短く
+    {
+        .ringCount = 1, .cadence = 0.3f, .aim = AimMode::AtTarget,
+        .spawnHeight = 1.0f, .speed = 10.0f, .lifeTime = 5.0f, .damage = 30, .duration = 1.5f,
+    },
+    // BitLaser: 半径5で回る4つのビットから、0.2秒ごとに標的へ
+    {
+        .ringCount = 1, .cadence = 0.2f, .aim = AimMode::AtTarget,
+        .emitterCount = 4, .emitterRadius = 5.0f, .emitterSpin = 2.0f,
+        .spawnHeight = 2.0f, .speed = 10.0f, .lifeTime = 5.0f, .damage = 15, .duration = 2.0f,
+    },
+};
+
+const BulletPatternDesc& GetBulletPattern(BulletPatternID id) {
+    return PATTERNS[(int)id];
+}
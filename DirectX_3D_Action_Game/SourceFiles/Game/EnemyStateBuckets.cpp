@@ -0,0 +1,49 @@
+/*===================================================================
+// ファイル: EnemyStateBuckets.cpp
+// 概要: 状態ごとの敵のIDの列（実装部）
+=====================================================================*/
+#include "Game/EnemyStateBuckets.h"
+
+void EnemyStateBuckets::BeginStep() {
+    if (stateOf.size() != ECSConfig::MAX_ENTITIES) {
+        stateOf.assign(ECSConfig::MAX_ENTITIES, NONE);
+        indexOf.assign(ECSConfig::MAX_ENTITIES, 0);
+        seen.assign(ECSConfig::MAX_ENTITIES, 0);
+    }
+    ++stamp;
+    transitions = 0;
+}
+
+void EnemyStateBuckets::Set(EntityID id, EnemyState state) {
+    if (id >= stateOf.size()) return;
+    seen[id] = stamp;
+    const uint8_t s = (uint8_t)state;
+    if (stateOf[id] == s) return;
+
+    if (stateOf[id] != NONE) {
+        Remove(id);
+        ++transitions;
+    }
+    stateOf[id] = s;
+    indexOf[id] = (uint32_t)ids[s].size();
+    ids[s].push_back(id);
+}
+
+void EnemyStateBuckets::Remove(EntityID id) {
+    std::vector<EntityID>& list = ids[stateOf[id]];
+    const uint32_t i = indexOf[id];
+    const EntityID last = list.back();
+    list[i] = last;
+    indexOf[last] = i;
+    list.pop_back();
+    stateOf[id] = NONE;
+}
+
+void EnemyStateBuckets::RemoveUnseen() {
+    for (auto& list : ids) {
+        // 後ろから見る (抜いた所には、もう見た末尾の敵が入る)
+        for (size_t i = list.size(); i-- > 0;) {
+            if (seen[list[i]] != stamp) Remove(list[i]);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/*===================================================================
+// ファイル: FlowField.cpp
+// 概要: 標的へ向かう流れ場（実装部）
+=====================================================================*/
+#include "Game/FlowField.h"
+#include <chrono>
+#include <cmath>
+
+using namespace DirectX;
+
+bool FlowField::Update(const NavGrid& g, const XMFLOAT3& goal) {
+    int gx, gz;
+    if (!g.CellOf(goal, gx, gz)) {
+        // 標的がグリッドの外: 流れ場は使わない
+        grid = nullptr;
+        return false;
+    }
+    if (grid == &g && gridVersion == g.Version() && gx == goalX && gz == goalZ) return false;
+
+    grid = &g;
+    gridVersion = g.Version();
+    goalX = gx;
+    goalZ = gz;
+    Rebuild();
+    return true;
+}
+
+void FlowField::Rebuild() {
+    const auto start = std::chrono::steady_clock::now();
+    const NavGrid& g = *grid;
+    const int w = g.Width();
+    const size_t cellCount = (size_t)g.CellCount();
+    cost.assign(cellCount, UNREACHED);
+    next.assign(cellCount, NO_NEXT);
+    if (visibleCapacity < cellCount) {
+        visible = std::make_unique<std::atomic<uint8_t>[]>(cellCount);
+        visibleCapacity = cellCount;
+    }
+    for (size_t i = 0; i < cellCount; ++i) visible[i].store(VIS_UNKNOWN, std::memory_order_relaxed);
+    reachableCells = 0;
+
+    // ダイクストラ法 (標的のセルは壁際で塞がっていても出発点にする)
+    // コストが小さな整数なので、ヒープの代わりに距離ごとのバケツを順に空けていく
+    for (auto& b : buckets) b.clear();
+    const uint32_t goalIndex = (uint32_t)g.Index(goalX, goalZ);
+    cost[goalIndex] = 0;
+    buckets[0].push_back(goalIndex);
+    size_t pending = 1;
+    for (uint32_t d = 0; pending > 0; ++d) {
+        // 一歩は 10 か 14 なので、処理中のバケツに積まれることはない
+        std::vector<uint32_t>& bucket = buckets[d % BUCKET_COUNT];
+        for (const uint32_t index : bucket) {
+            if (cost[index] != d) continue;     // もっと近い経路で処理済み
+            ++reachableCells;
+
+            const int x = (int)(index % w), z = (int)(index / w);
+            const uint8_t mask = g.StepMask(x, z);
+            for (int k = 0; k < 8; ++k) {
+                if (!(mask & (1u << k))) continue;
+                const uint32_t ni = (uint32_t)g.Index(x + NavGrid::NEIGHBOR_X[k], z + NavGrid::NEIGHBOR_Z[k]);
+                const uint32_t nd = d + NavGrid::NEIGHBOR_COST[k];
+                if (nd >= cost[ni]) continue;
+                cost[ni] = nd;
+                buckets[nd % BUCKET_COUNT].push_back(ni);
+                ++pending;
+            }
+        }
+        pending -= bucket.size();
+        bucket.clear();
+    }
+
+    // セルごとに一番近づける隣を選ぶ
+    // 塞がったセル (壁際に押し込まれた敵) も、空いている隣へ抜け出せるように選んでおく
+    for (int z = 0; z < g.Height(); ++z) {
+        for (int x = 0; x < w; ++x) {
+            const size_t index = (size_t)g.Index(x, z);
+            if (index == goalIndex) continue;
+            const uint8_t mask = g.StepMask(x, z);
+            uint32_t best = cost[index];
+            for (int k = 0; k < 8; ++k) {
+                if (!(mask & (1u << k))) continue;
+                const uint32_t c = cost[g.Index(x + NavGrid::NEIGHBOR_X[k], z + NavGrid::NEIGHBOR_Z[k])];
+                if (c < best) {
+                    best = c;
+                    next[index] = (uint8_t)k;
+                }
+            }
+        }
+    }
+    visible[goalIndex].store(VIS_YES, std::memory_order_relaxed);
+
+    lastBuildUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool FlowField::Sample(const XMFLOAT3& position, XMFLOAT3& outDir) const {
+    if (!grid) return false;
+    int x, z;
+    if (!grid->CellOf(position, x, z)) return false;
+    const size_t index = (size_t)grid->Index(x, z);
+
+    // 標的まで見通せるセルは、セルを伝わずにまっすぐ向かう
+    // (グリッドと標的のセルだけで決まるので、同時に調べて同じ値を書いても問題ない)
+    uint8_t vis = visible[index].load(std::memory_order_relaxed);
+    if (vis == VIS_UNKNOWN) {
+        const bool los = cost[index] != UNREACHED && !grid->IsBlocked(x, z) &&
+                         grid->LineOfSight(x, z, goalX, goalZ);
+        vis = los ? VIS_YES : VIS_NO;
+        visible[index].store(vis, std::memory_order_relaxed);
+    }
+    if (vis == VIS_YES) return false;
+
+    const uint8_t k = next[index];
+    if (k == NO_NEXT) return false;
+
+    // 隣のセルの中心へ (セルの中の位置から向かうので、8方向に縛られない)
+    const XMFLOAT3 target = grid->CellCenter(x + NavGrid::NEIGHBOR_X[k], z + NavGrid::NEIGHBOR_Z[k], position.y);
+    const float dx = target.x - position.x;
+    const float dz = target.z - position.z;
+    const float len = std::sqrt(dx * dx + dz * dz);
+    if (len < 1e-4f) return false;
+    outDir = { dx / len, 0.0f, dz / len };
+    return true;
+}
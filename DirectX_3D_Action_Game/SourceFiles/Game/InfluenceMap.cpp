@@ -0,0 +1,182 @@
+/*===================================================================
+// ファイル: InfluenceMap.cpp
+// 概要: 遠距離の敵の立ち位置選び用の影響マップ（実装部）
+=====================================================================*/
+#include "Game/InfluenceMap.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+void InfluenceMap::BeginStep(const NavGrid& g) {
+    stats.refreshed = 0;
+    stats.sources = 0;
+    sources.clear();
+
+    if (grid != &g || gridVersion != g.Version()) {
+        grid = &g;
+        gridVersion = g.Version();
+        Rebuild();
+    }
+    std::fill(agentCount.begin(), agentCount.end(), (uint16_t)0);
+}
+
+// 壁が変わった時だけ: マスの大きさを決め、通れるかと cover を作る
+void InfluenceMap::Rebuild() {
+    width = height = 0;
+    cursor = 0;
+    if (!grid->IsValid()) {
+        stats.cells = 0;
+        return;
+    }
+
+    width = (grid->Width() + COARSE - 1) / COARSE;
+    height = (grid->Height() + COARSE - 1) / COARSE;
+    cellSize = grid->CellSize() * COARSE;
+    const XMFLOAT3 c0 = grid->CellCenter(0, 0, 0.0f);
+    originX = c0.x - grid->CellSize() * 0.5f;
+    originZ = c0.z - grid->CellSize() * 0.5f;
+
+    const size_t count = (size_t)width * height;
+    threat.assign(count, 0.0f);
+    crowd.assign(count, 0.0f);
+    cover.assign(count, 0.0f);
+    walkable.assign(count, 0);
+    agentCount.assign(count, 0);
+    stats.cells = (uint32_t)count;
+
+    for (int cz = 0; cz < height; ++cz) {
+        for (int cx = 0; cx < width; ++cx) {
+            const int x0 = cx * COARSE, z0 = cz * COARSE;
+            // マスの中で通れるセル
+            int open = 0;
+            for (int z = z0; z < z0 + COARSE; ++z)
+                for (int x = x0; x < x0 + COARSE; ++x)
+                    if (!grid->IsBlocked(x, z)) ++open;
+            // マスを1セル広げた縁の、塞がったセル (範囲外は壁と見なさない)
+            int ring = 0, wall = 0;
+            for (int z = z0 - 1; z <= z0 + COARSE; ++z) {
+                for (int x = x0 - 1; x <= x0 + COARSE; ++x) {
+                    if (x >= x0 && x < x0 + COARSE && z >= z0 && z < z0 + COARSE) continue;
+                    if (!grid->InBounds(x, z)) continue;
+                    ++ring;
+                    if (grid->IsBlocked(x, z)) ++wall;
+                }
+            }
+            const int i = Index(cx, cz);
+            walkable[i] = (open * 2 >= COARSE * COARSE) ? 1 : 0;
+            // 縁の半分が壁なら cover は最大
+            cover[i] = (ring > 0) ? std::min(1.0f, 2.0f * wall / ring) : 0.0f;
+        }
+    }
+}
+
+void InfluenceMap::AddThreat(const XMFLOAT3& position, float yaw) {
+    sources.push_back({ position.x, position.z, std::sin(yaw), std::cos(yaw) });
+    stats.sources = (uint32_t)sources.size();
+}
+
+void InfluenceMap::AddAgent(const XMFLOAT3& position) {
+    int x, z;
+    if (!CoarseOf(position, x, z)) return;
+    uint16_t& n = agentCount[Index(x, z)];
+    if (n < 0xFFFF) ++n;
+}
+
+// 一番危ない脅威の元の値 (近いほど、正面ほど大きい)
+float InfluenceMap::ComputeThreat(float x, float z) const {
+    float result = 0.0f;
+    for (const Source& s : sources) {
+        const float dx = x - s.x, dz = z - s.z;
+        const float dist = std::sqrt(dx * dx + dz * dz);
+        if (dist >= THREAT_RADIUS) continue;
+        float facing = 1.0f;
+        if (dist > 1e-4f) {
+            const float dot = (dx * s.forwardX + dz * s.forwardZ) / dist;
+            facing = THREAT_BEHIND + (1.0f - THREAT_BEHIND) * std::max(0.0f, dot);
+        }
+        result = std::max(result, (1.0f - dist / THREAT_RADIUS) * facing);
+    }
+    return result;
+}
+
+void InfluenceMap::Refresh() {
+    if (!IsValid()) return;
+    const uint32_t count = (uint32_t)threat.size();
+    const uint32_t n = std::min(cellsPerStep, count);
+    for (uint32_t k = 0; k < n; ++k) {
+        const uint32_t i = cursor;
+        cursor = (cursor + 1 == count) ? 0 : cursor + 1;
+        const int cx = (int)(i % (uint32_t)width), cz = (int)(i / (uint32_t)width);
+        const XMFLOAT3 c = Center(cx, cz);
+        threat[i] = ComputeThreat(c.x, c.z);
+        crowd[i] = std::min(1.0f, agentCount[i] / CROWD_FULL);
+    }
+    stats.refreshed = n;
+}
+
+bool InfluenceMap::CoarseOf(const XMFLOAT3& p, int& outX, int& outZ) const {
+    if (!IsValid()) return false;
+    outX = (int)std::floor((p.x - originX) / cellSize);
+    outZ = (int)std::floor((p.z - originZ) / cellSize);
+    return outX >= 0 && outZ >= 0 && outX < width && outZ < height;
+}
+
+XMFLOAT3 InfluenceMap::Center(int x, int z) const {
+    return { originX + (x + 0.5f) * cellSize, 0.0f, originZ + (z + 0.5f) * cellSize };
+}
+
+bool InfluenceMap::FindPosition(const XMFLOAT3& from, const XMFLOAT3& target, float preferredRange,
+                                XMFLOAT3& outPos) const {
+    int fx, fz;
+    if (!CoarseOf(from, fx, fz)) return false;
+    const float invRange = 1.0f / std::max(preferredRange, 1.0f);
+
+    int bestX = fx, bestZ = fz;
+    float bestScore = -1e30f;
+    for (int dz = -SEARCH_RADIUS; dz <= SEARCH_RADIUS; ++dz) {
+        for (int dx = -SEARCH_RADIUS; dx <= SEARCH_RADIUS; ++dx) {
+            const int x = fx + dx, z = fz + dz;
+            if (x < 0 || z < 0 || x >= width || z >= height) continue;
+            const int i = Index(x, z);
+            // 今いるマスは通れなくても候補に残す (壁際で立ち往生しないように)
+            const bool here = (dx == 0 && dz == 0);
+            if (!walkable[i] && !here) continue;
+
+            const XMFLOAT3 c = here ? from : Center(x, z);
+            const float tx = c.x - target.x, tz = c.z - target.z;
+            const float rangeError = std::abs(std::sqrt(tx * tx + tz * tz) - preferredRange) * invRange;
+            // 自分の分は混み具合から除く
+            const float crowdHere = here ? std::max(0.0f, crowd[i] - 1.0f / CROWD_FULL) : crowd[i];
+            const float score = -weights.range * rangeError
+                                - weights.threat * threat[i]
+                                - weights.crowd * crowdHere
+                                + weights.cover * cover[i]
+                                - weights.travel * (float)std::max(std::abs(dx), std::abs(dz));
+            if (score > bestScore) {
+                bestScore = score;
+                bestX = x;
+                bestZ = z;
+            }
+        }
+    }
+    if (bestX == fx && bestZ == fz) return false;
+    outPos = Center(bestX, bestZ);
+    outPos.y = from.y;
+    return true;
+}
+
+float InfluenceMap::ThreatAt(const XMFLOAT3& p) const {
+    int x, z;
+    return CoarseOf(p, x, z) ? threat[Index(x, z)] : 0.0f;
+}
+
+float InfluenceMap::CrowdAt(const XMFLOAT3& p) const {
+    int x, z;
+    return CoarseOf(p, x, z) ? crowd[Index(x, z)] : 0.0f;
+}
+
+float InfluenceMap::CoverAt(const XMFLOAT3& p) const {
+    int x, z;
+    return CoarseOf(p, x, z) ? cover[Index(x, z)] : 0.0f;
+}
@@ -0,0 +1,119 @@
+/*===================================================================
+// ファイル: NavGrid.cpp
+// 概要: 敵の移動用の通行グリッド（実装部）
+=====================================================================*/
+#include "Game/NavGrid.h"
+#include <cmath>
+#include <cfloat>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace DirectX;
+
+// 箱の回転込みの半サイズ (ワールド軸方向)
+static void WorldHalfExtents(const Collision::OBBSoA& b, size_t i, float& hx, float& hy, float& hz) {
+    hx = std::fabs(b.r00[i]) * b.ex[i] + std::fabs(b.r10[i]) * b.ey[i] + std::fabs(b.r20[i]) * b.ez[i];
+    hy = std::fabs(b.r01[i]) * b.ex[i] + std::fabs(b.r11[i]) * b.ey[i] + std::fabs(b.r21[i]) * b.ez[i];
+    hz = std::fabs(b.r02[i]) * b.ex[i] + std::fabs(b.r12[i]) * b.ey[i] + std::fabs(b.r22[i]) * b.ez[i];
+}
+
+void NavGrid::Build(const Collision::OBBSoA& statics, const Settings& s) {
+    ++version;
+    width = height = 0;
+    blocked.clear();
+    stepMask.clear();
+    const size_t count = statics.Size();
+    if (count == 0) return;
+
+    // 範囲は静的コライダー全体 (床も含む) のAABB
+    float minX = FLT_MAX, maxX = -FLT_MAX, minZ = FLT_MAX, maxZ = -FLT_MAX;
+    for (size_t i = 0; i < count; ++i) {
+        float hx, hy, hz;
+        WorldHalfExtents(statics, i, hx, hy, hz);
+        minX = std::min(minX, statics.cx[i] - hx); maxX = std::max(maxX, statics.cx[i] + hx);
+        minZ = std::min(minZ, statics.cz[i] - hz); maxZ = std::max(maxZ, statics.cz[i] + hz);
+    }
+
+    cellSize = (s.cellSize > 0.0f) ? s.cellSize : 1.0f;
+    for (;;) {
+        width = (int)std::ceil((maxX - minX) / cellSize);
+        height = (int)std::ceil((maxZ - minZ) / cellSize);
+        if ((long long)width * height <= MAX_CELLS) break;
+        cellSize *= 2.0f;
+    }
+    width = std::max(width, 1);
+    height = std::max(height, 1);
+    invCellSize = 1.0f / cellSize;
+    originX = minX;
+    originZ = minZ;
+    blocked.assign((size_t)width * height, 0);
+
+    // 歩く高さを塞ぐ箱だけ、半径分太らせて焼き込む
+    const float walkTop = s.walkY + s.stepHeight;
+    const float headY = s.walkY + s.agentHeight;
+    for (size_t i = 0; i < count; ++i) {
+        float hx, hy, hz;
+        WorldHalfExtents(statics, i, hx, hy, hz);
+        if (statics.cy[i] + hy <= walkTop) continue;   // 床
+        if (statics.cy[i] - hy >= headY) continue;     // 頭上
+
+        const int x0 = std::max(0, (int)std::floor((statics.cx[i] - hx - s.agentRadius - originX) * invCellSize));
+        const int x1 = std::min(width - 1, (int)std::floor((statics.cx[i] + hx + s.agentRadius - originX) * invCellSize));
+        const int z0 = std::max(0, (int)std::floor((statics.cz[i] - hz - s.agentRadius - originZ) * invCellSize));
+        const int z1 = std::min(height - 1, (int)std::floor((statics.cz[i] + hz + s.agentRadius - originZ) * invCellSize));
+        for (int z = z0; z <= z1; ++z) {
+            for (int x = x0; x <= x1; ++x) {
+                uint8_t& cell = blocked[Index(x, z)];
+                if (cell) continue;
+                // セルの中心に置いたエージェントが箱に触れるか (高さは箱の中心で見る = XZの距離)
+                const XMFLOAT3 c = CellCenter(x, z, statics.cy[i]);
+                float penetration;
+                if (Collision::SphereOverlapOBB(statics, i, c, s.agentRadius, penetration)) cell = 1;
+            }
+        }
+    }
+
+    // 進める隣を先に求めておく (経路探索の内側のループで何度も引くため)
+    stepMask.assign((size_t)width * height, 0);
+    for (int z = 0; z < height; ++z) {
+        for (int x = 0; x < width; ++x) {
+            uint8_t mask = 0;
+            for (int k = 0; k < 8; ++k) {
+                const int nx = x + NEIGHBOR_X[k], nz = z + NEIGHBOR_Z[k];
+                if (IsBlocked(nx, nz)) continue;
+                if (k >= 4 && (IsBlocked(nx, z) || IsBlocked(x, nz))) continue;
+                mask |= (uint8_t)(1u << k);
+            }
+            stepMask[Index(x, z)] = mask;
+        }
+    }
+}
+
+bool NavGrid::CellOf(const XMFLOAT3& p, int& outX, int& outZ) const {
+    if (!IsValid()) return false;
+    outX = (int)std::floor((p.x - originX) * invCellSize);
+    outZ = (int)std::floor((p.z - originZ) * invCellSize);
+    return InBounds(outX, outZ);
+}
+
+bool NavGrid::LineOfSight(int ax, int az, int bx, int bz) const {
+    // セルの中心同士を結ぶ線分が通るセルを順にたどる
+    int dx = std::abs(bx - ax), dz = std::abs(bz - az);
+    const int sx = (bx > ax) ? 1 : -1, sz = (bz > az) ? 1 : -1;
+    int x = ax, z = az;
+    int n = 1 + dx + dz;
+    int err = dx - dz;
+    dx *= 2;
+    dz *= 2;
+    while (n > 0) {
+        if (IsBlocked(x, z)) return false;
+        if (err > 0) { x += sx; err -= dz; --n; }
+        else if (err < 0) { z += sz; err += dx; --n; }
+        else {
+            // ちょうど角を通る: 両隣のどちらかが塞がっていれば通れない
+            if (n > 1 && (IsBlocked(x + sx, z) || IsBlocked(x, z + sz))) return false;
+            x += sx; z += sz; err += dx - dz; n -= 2;
+        }
+    }
+    return true;
+}
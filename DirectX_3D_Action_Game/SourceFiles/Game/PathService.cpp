@@ -0,0 +1,256 @@
+/*===================================================================
+// ファイル: PathService.cpp
+// 概要: NavGrid 上のA*経路探索（実装部）
+=====================================================================*/
+#include "Game/PathService.h"
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <cstdlib>
+
+using namespace DirectX;
+
+// 8方向に動ける時の距離の目安 (縦横10 / 斜め14)
+static uint32_t Octile(int ax, int az, int bx, int bz) {
+    const int dx = std::abs(ax - bx), dz = std::abs(az - bz);
+    return (uint32_t)(10 * std::max(dx, dz) + 4 * std::min(dx, dz));
+}
+
+void PathService::BeginStep(const NavGrid& g) {
+    ++step;
+    stats = {};
+
+    if (grid != &g || gridVersion != g.Version()) {
+        // 壁が変わったら、探索中のものも含めて全部やり直し
+        grid = &g;
+        gridVersion = g.Version();
+        paths.clear();
+        queue.clear();
+        searchKey = 0;
+        const size_t cellCount = (size_t)g.CellCount();
+        stamp.assign(cellCount, 0);
+        gCost.assign(cellCount, 0);
+        parent.assign(cellCount, 0);
+        closed.assign(cellCount, 0);
+        searchId = 0;
+        return;
+    }
+
+    // しばらく使われていない経路を捨てる (探索待ちは残す)
+    for (auto it = paths.begin(); it != paths.end();) {
+        if (it->second.status != Status::Pending && step - it->second.lastUsed > keepSteps) it = paths.erase(it);
+        else ++it;
+    }
+}
+
+bool PathService::SnapCell(const XMFLOAT3& position, uint32_t& outIndex) const {
+    int x, z;
+    if (!grid || !grid->CellOf(position, x, z)) return false;
+
+    // 格子に丸める (範囲の端ははみ出さないように)
+    x = std::min(x - x % SHARE_CELLS + SHARE_CELLS / 2, grid->Width() - 1);
+    z = std::min(z - z % SHARE_CELLS + SHARE_CELLS / 2, grid->Height() - 1);
+    if (!grid->IsBlocked(x, z)) {
+        outIndex = (uint32_t)grid->Index(x, z);
+        return true;
+    }
+
+    // 塞がっていれば、近い順に空いているセルを探す
+    for (int r = 1; r <= SNAP_SEARCH_RADIUS; ++r) {
+        for (int dz = -r; dz <= r; ++dz) {
+            for (int dx = -r; dx <= r; ++dx) {
+                if (std::max(std::abs(dx), std::abs(dz)) != r) continue;
+                if (grid->IsBlocked(x + dx, z + dz)) continue;
+                outIndex = (uint32_t)grid->Index(x + dx, z + dz);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint64_t PathService::KeyFor(const XMFLOAT3& start, const XMFLOAT3& goal) const {
+    // 開始も丸める (同じ丸めセルにいる間は動いていても同じ経路を引く。
+    // ずれた分は Steer が今いるセルからの見通しで吸収する)
+    uint32_t startIndex, goalIndex;
+    if (!SnapCell(start, startIndex) || !SnapCell(goal, goalIndex)) return 0;
+    return MakeKey(startIndex, goalIndex);
+}
+
+void PathService::Request(uint64_t key) {
+    if (key == 0) return;
+    ++stats.requests;
+    auto [it, inserted] = paths.try_emplace(key);
+    it->second.lastUsed = step;
+    if (inserted) queue.push_back(key);
+    else ++stats.cacheHits;
+}
+
+void PathService::Touch(uint64_t key) {
+    auto it = paths.find(key);
+    if (it != paths.end()) it->second.lastUsed = step;
+}
+
+bool PathService::IsCurrent(uint64_t key, const XMFLOAT3& goal) const {
+    if (key == 0 || paths.find(key) == paths.end()) return false;
+    uint32_t goalIndex;
+    return SnapCell(goal, goalIndex) && goalIndex == GoalOf(key);
+}
+
+PathService::Status PathService::GetStatus(uint64_t key) const {
+    auto it = paths.find(key);
+    return (it == paths.end()) ? Status::None : it->second.status;
+}
+
+bool PathService::Steer(uint64_t key, const XMFLOAT3& position, uint16_t& waypoint, XMFLOAT3& outDir) const {
+    auto it = paths.find(key);
+    if (it == paths.end() || it->second.status != Status::Ready) return false;
+    const Path& path = it->second;
+
+    int x, z;
+    if (!grid->CellOf(position, x, z)) return false;
+    const int w = grid->Width();
+    const uint32_t here = (uint32_t)grid->Index(x, z);
+
+    // 今いるセルから見通せる一番先の曲がり角まで進める
+    size_t i = std::min<size_t>(waypoint, path.corners.size() - 1);
+    if (path.corners[i] == here && i + 1 < path.corners.size()) ++i;
+    while (i + 1 < path.corners.size()) {
+        const uint32_t c = path.corners[i + 1];
+        if (!grid->LineOfSight(x, z, (int)(c % w), (int)(c / w))) break;
+        ++i;
+    }
+    waypoint = (uint16_t)i;
+    if (path.corners[i] == here) return false;  // 着いた
+
+    const uint32_t c = path.corners[i];
+    const XMFLOAT3 target = grid->CellCenter((int)(c % w), (int)(c / w), position.y);
+    const float dx = target.x - position.x;
+    const float dz = target.z - position.z;
+    const float len = std::sqrt(dx * dx + dz * dz);
+    if (len < 1e-4f) return false;
+    outDir = { dx / len, 0.0f, dz / len };
+    return true;
+}
+
+void PathService::Process() {
+    uint32_t budget = maxExpansionsPerStep;
+    while (budget > 0) {
+        if (searchKey == 0) {
+            // 次の依頼へ (探索待ちの間に捨てられたものは飛ばす)
+            while (!queue.empty() && paths.find(queue.front()) == paths.end()) queue.pop_front();
+            if (queue.empty()) break;
+            BeginSearch(queue.front());
+            queue.pop_front();
+        }
+        if (!StepSearch(budget)) break;
+    }
+    stats.pending = (uint32_t)queue.size() + (searchKey != 0 ? 1u : 0u);
+    stats.cached = (uint32_t)paths.size();
+}
+
+void PathService::BeginSearch(uint64_t key) {
+    searchKey = key;
+    if (++searchId == 0) {
+        // 番号が一周したら印を消す
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+    const uint32_t s = StartOf(key), goal = GoalOf(key);
+    const int w = grid->Width();
+    stamp[s] = searchId;
+    gCost[s] = 0;
+    parent[s] = s;
+    closed[s] = 0;
+    open.clear();
+    open.push_back(((uint64_t)Octile((int)(s % w), (int)(s / w), (int)(goal % w), (int)(goal / w)) << 32) | s);
+}
+
+bool PathService::StepSearch(uint32_t& budget) {
+    const NavGrid& g = *grid;
+    const int w = g.Width();
+    const uint32_t goal = GoalOf(searchKey);
+    const int gx = (int)(goal % w), gz = (int)(goal / w);
+    const auto greater = std::greater<uint64_t>();
+
+    while (!open.empty()) {
+        if (budget == 0) return false;     // 続きは次のステップ
+        std::pop_heap(open.begin(), open.end(), greater);
+        const uint32_t index = (uint32_t)open.back();
+        open.pop_back();
+        if (closed[index]) continue;
+        closed[index] = 1;
+        --budget;
+        ++stats.expansions;
+
+        if (index == goal) {
+            FinishSearch(true);
+            return true;
+        }
+
+        // 開始セルは壁際で塞がっていてもよい (StepMask は塞がったセルからも抜け出せる)
+        const int x = (int)(index % w), z = (int)(index / w);
+        const uint8_t mask = g.StepMask(x, z);
+        for (int k = 0; k < 8; ++k) {
+            if (!(mask & (1u << k))) continue;
+            const int nx = x + NavGrid::NEIGHBOR_X[k], nz = z + NavGrid::NEIGHBOR_Z[k];
+            const uint32_t ni = (uint32_t)g.Index(nx, nz);
+            const uint32_t ng = gCost[index] + NavGrid::NEIGHBOR_COST[k];
+            if (stamp[ni] == searchId) {
+                if (closed[ni] || ng >= gCost[ni]) continue;
+            }
+            else {
+                stamp[ni] = searchId;
+                closed[ni] = 0;
+            }
+            gCost[ni] = ng;
+            parent[ni] = index;
+            open.push_back(((uint64_t)(ng + Octile(nx, nz, gx, gz)) << 32) | ni);
+            std::push_heap(open.begin(), open.end(), greater);
+        }
+    }
+    FinishSearch(false);
+    return true;
+}
+
+void PathService::FinishSearch(bool found) {
+    auto it = paths.find(searchKey);
+    searchKey = 0;
+    ++stats.completed;
+    if (it == paths.end()) return;
+    Path& path = it->second;
+    if (!found) {
+        path.status = Status::Failed;
+        return;
+    }
+
+    // 目標から親をたどって、開始セルからの順に並べる
+    cellPath.clear();
+    uint32_t c = GoalOf(it->first);
+    for (;;) {
+        cellPath.push_back(c);
+        if (parent[c] == c) break;
+        c = parent[c];
+    }
+    std::reverse(cellPath.begin(), cellPath.end());
+    Smooth(cellPath, path.corners);
+    path.status = Status::Ready;
+}
+
+void PathService::Smooth(const std::vector<uint32_t>& cells, std::vector<uint32_t>& outCorners) const {
+    // 今の角から見通せる限り先へ伸ばし、見通せなくなる手前を次の角にする
+    const int w = grid->Width();
+    outCorners.clear();
+    size_t anchor = 0;
+    while (anchor + 1 < cells.size()) {
+        const int ax = (int)(cells[anchor] % w), az = (int)(cells[anchor] / w);
+        size_t next = anchor + 1;
+        while (next + 1 < cells.size() &&
+               grid->LineOfSight(ax, az, (int)(cells[next + 1] % w), (int)(cells[next + 1] / w))) {
+            ++next;
+        }
+        outCorners.push_back(cells[next]);
+        anchor = next;
+    }
+    if (outCorners.empty()) outCorners.push_back(cells.front());   // 開始セルが目標
+}
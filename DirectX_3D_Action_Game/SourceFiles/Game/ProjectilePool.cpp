@@ -0,0 +1,67 @@
+/*===================================================================
+// ファイル: ProjectilePool.cpp
+// 概要: エンティティを作らない弾の置き場（実装部）
+=====================================================================*/
+#include "Game/ProjectilePool.h"
+
+using namespace DirectX;
+
+ProjectilePool::ProjectilePool() {
+    position.reserve(CAPACITY);
+    prevPosition.reserve(CAPACITY);
+    velocity.reserve(CAPACITY);
+    life.reserve(CAPACITY);
+    damage.reserve(CAPACITY);
+}
+
+bool ProjectilePool::Spawn(const XMFLOAT3& p, const XMFLOAT3& v, float lifeTime, int dmg) {
+    if (position.size() >= CAPACITY) {
+        ++dropped;
+        return false;
+    }
+    // 撃ったステップは発射位置から掃引する
+    position.push_back(p);
+    prevPosition.push_back(p);
+    velocity.push_back(v);
+    life.push_back(lifeTime);
+    damage.push_back(dmg);
+    return true;
+}
+
+void ProjectilePool::Integrate(float dt) {
+    const size_t n = position.size();
+    for (size_t i = 0; i < n; ++i) {
+        prevPosition[i] = position[i];
+        position[i].x += velocity[i].x * dt;
+        position[i].y += velocity[i].y * dt;
+        position[i].z += velocity[i].z * dt;
+        life[i] -= dt;
+    }
+}
+
+void ProjectilePool::RemoveDead() {
+    size_t n = position.size();
+    for (size_t i = 0; i < n;) {
+        if (life[i] > 0.0f) { ++i; continue; }
+        // 末尾と入れ替えて詰める
+        --n;
+        position[i] = position[n];
+        prevPosition[i] = prevPosition[n];
+        velocity[i] = velocity[n];
+        life[i] = life[n];
+        damage[i] = damage[n];
+    }
+    position.resize(n);
+    prevPosition.resize(n);
+    velocity.resize(n);
+    life.resize(n);
+    damage.resize(n);
+}
+
+void ProjectilePool::Clear() {
+    position.clear();
+    prevPosition.clear();
+    velocity.clear();
+    life.clear();
+    damage.clear();
+}
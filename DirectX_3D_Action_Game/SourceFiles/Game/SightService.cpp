@@ -0,0 +1,77 @@
+/*===================================================================
+// ファイル: SightService.cpp
+// 概要: 遠距離の敵の見通し判定（実装部）
+=====================================================================*/
+#include "Game/SightService.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "Engine/JobSystem.h"
+#include <cmath>
+
+using namespace DirectX;
+
+void SightService::BeginStep(uint32_t version) {
+    ++step;
+    stats = {};
+    rays.clear();
+
+    if (entries.size() != ECSConfig::MAX_ENTITIES) entries.resize(ECSConfig::MAX_ENTITIES);
+    if (version != staticVersion) {
+        // 壁が変わったら全部調べ直す
+        staticVersion = version;
+        for (auto& e : entries) e.expires = 0;
+    }
+}
+
+// 21ビットずつ3軸を詰める (範囲は ±CELL_SIZE * 100万なので実用上はみ出さない)
+uint64_t SightService::CellKey(const XMFLOAT3& p) {
+    const float inv = 1.0f / CELL_SIZE;
+    const uint64_t x = (uint64_t)((int64_t)std::floor(p.x * inv) + (1 << 20)) & 0x1FFFFF;
+    const uint64_t y = (uint64_t)((int64_t)std::floor(p.y * inv) + (1 << 20)) & 0x1FFFFF;
+    const uint64_t z = (uint64_t)((int64_t)std::floor(p.z * inv) + (1 << 20)) & 0x1FFFFF;
+    return (x << 42) | (y << 21) | z;
+}
+
+void SightService::Request(EntityID id, const XMFLOAT3& eye, const XMFLOAT3& target) {
+    if (id >= entries.size()) return;
+    ++stats.requests;
+
+    const uint64_t eyeCell = CellKey(eye);
+    const uint64_t targetCell = CellKey(target);
+    const Entry& e = entries[id];
+    if (e.expires >= step && e.eyeCell == eyeCell && e.targetCell == targetCell) {
+        ++stats.cacheHits;
+        return;
+    }
+    rays.push_back({ id, eye, target, eyeCell, targetCell });
+}
+
+void SightService::Resolve(const PhysicsSystem* physics, JobSystem* jobs) {
+    stats.rays = (uint32_t)rays.size();
+    if (rays.empty()) return;
+
+    const unsigned threads = jobs ? jobs->GetThreadCount() : 1;
+    if (candidates.size() < threads) candidates.resize(threads);
+    blockedCount.assign(threads, 0);
+
+    // 敵ごとに書く場所が別なので、結果はそのまま entries に書く
+    auto cast = [&](size_t begin, size_t end, unsigned thread) {
+        for (size_t i = begin; i < end; ++i) {
+            const Ray& ray = rays[i];
+            float dist;
+            const bool hit = physics &&
+                physics->SweepSphereStatic(ray.eye, ray.target, RAY_RADIUS, dist, candidates[thread]);
+            if (hit) ++blockedCount[thread];
+
+            Entry& e = entries[ray.id];
+            e.eyeCell = ray.eyeCell;
+            e.targetCell = ray.targetCell;
+            // 調べ直す時期を敵ごとにずらして、同じステップに固まらないようにする
+            e.expires = step + ttlSteps + (ray.id & 7);
+            e.visible = hit ? 0 : 1;
+        }
+    };
+    if (jobs) jobs->ParallelFor(rays.size(), RAY_GRAIN, cast);
+    else cast(0, rays.size(), 0);
+
+    for (uint32_t n : blockedCount) stats.blocked += n;
+}
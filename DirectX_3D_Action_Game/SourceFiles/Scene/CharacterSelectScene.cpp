@@ -204,9 +204,10 @@ void CharacterSelectScene::Draw() {
         float headerY = 50.0f;
 
         // Ob`
-        bool isGlitch = (rand() % 100 < 3); // 3%̊m
-        float offX = isGlitch ? (rand() % 6 - 3.0f) : 0.0f;
-        float offY = isGlitch ? (rand() % 6 - 3.0f) : 0.0f;
+        Random& rng = pWorld->GetRandom(RandomStream::UI);
+        bool isGlitch = rng.Chance(3); // 3%̊m
+        float offX = isGlitch ? (float)rng.Int(-3, 3) : 0.0f;
+        float offY = isGlitch ? (float)rng.Int(-3, 3) : 0.0f;
         uint32_t headerCol = isGlitch ? 0xFF00FFFF : 0xFFFFFFFF;
 
         pGraphics->DrawString(L"SELECT CHARACTER", 100.0f + offX, headerY + offY, 48.0f, headerCol);
@@ -17,6 +17,7 @@
 #include "ECS/Components/TransformComponent.h"
 #include "ECS/Systems/ParticleSystem.h"
 #include "ECS/Components/MovingComponent.h"
+#include "ECS/Components/ColliderComponent.h"
 
 // VXe
 #include "ECS/Systems/RenderSystem.h"
@@ -29,6 +30,7 @@
 #include "ECS/Systems/ActionSystem.h"
 #include "ECS/Systems/UISystem.h"
 #include "ECS/Systems/MovingSystem.h"
+#include "ECS/Systems/ProjectileSystem.h"
 
 #include <iostream>
 #include <cstdlib>
@@ -44,12 +46,18 @@ void GameScene::Initialize() {
     // 1. VXeo^
     // ---------------------------------------------------------
     // o^dvłiUpdate͓o^Ɏs܂j
-    pWorld->AddSystem<PlayerSystem>()->Init(pWorld.get());
-    pWorld->AddSystem<EnemySystem>()->Init(pWorld.get());
-    pWorld->AddSystem<ActionSystem>()->Init(pWorld.get());
-    pWorld->AddSystem<PhysicsSystem>()->Init(pWorld.get());
+    // ǉ: Q[WbNƕ͌ŒXebv (Config::FIXED_TICK_RATE) ŉ
+    //        (`FPSςĂEׂςȂ悤)
+    pWorld->AddFixedSystem<PlayerSystem>()->Init(pWorld.get());
+    pWorld->AddFixedSystem<EnemySystem>()->Init(pWorld.get());
+    pWorld->AddFixedSystem<ActionSystem>()->Init(pWorld.get());
+    // C: ͕̒Oɓ (ɏ̂𓯂Xebvŉ^Ԃ)
+    pWorld->AddFixedSystem<MovingSystem>()->Init(pWorld.get());
+    pWorld->AddFixedSystem<PhysicsSystem>()->Init(pWorld.get());
+    // ǉ: e̒e (v[) ͕̌ɓ (vC[̈ʒu܂Ă瓖Ă)
+    pWorld->AddFixedSystem<ProjectileSystem>()->Init(pWorld.get());
+    // 牺͖t[ (ŒXebv̌Ɏs)
     pWorld->AddSystem<ParticleSystem>()->Init(pWorld.get());
-    pWorld->AddSystem<MovingSystem>()->Init(pWorld.get());
     m_pEnemyAnimSystem = pWorld->AddSystem<EnemyAnimationSystem>();
     m_pEnemyAnimSystem->Init(pWorld.get());
 
@@ -181,6 +189,9 @@ void GameScene::Initialize() {
     // ---------------------------------------------------------
     // 4. G̐WbN (Փx)
     // ---------------------------------------------------------
+    // ǉ: zu̒I̓V[̃V[hōs (V[hȂ瓯zu)
+    Random& rng = pWorld->GetRandom(RandomStream::Spawn);
+
     if (phase == 3) {
         // === tF[Y3: BOSS BATTLE ===
         AppLog::AddLog("WARNING: BOSS BATTLE!");
@@ -229,17 +240,17 @@ void GameScene::Initialize() {
 
             // oʒu (Xe[W)
             switch (currentStage) {
-            case 1: x = (rand() % 30) - 15.0f; z = 5.0f + (rand() % 15); break;
-            case 2: x = (rand() % 24) - 12.0f; z = (rand() % 24) - 12.0f; if (abs(x) < 5 && abs(z) < 5) x += 10; break;
+            case 1: x = (float)rng.Int(-15, 15); z = (float)rng.Int(5, 20); break;
+            case 2: x = (float)rng.Int(-12, 12); z = (float)rng.Int(-12, 12); if (abs(x) < 5 && abs(z) < 5) x += 10; break;
             case 3:
-                if (rand() % 3 == 0) { x = -8; z = 8; }
-                else if (rand() % 2 == 0) { x = 8; z = 8; }
+                if (rng.UInt(3) == 0) { x = -8; z = 8; }
+                else if (rng.UInt(2) == 0) { x = 8; z = 8; }
                 else { x = 8; z = -8; }
-                x += (rand() % 6) - 3.0f; z += (rand() % 6) - 3.0f;
+                x += (float)rng.Int(-3, 3); z += (float)rng.Int(-3, 3);
                 break;
-            case 4: x = (rand() % 36) - 18.0f; z = (rand() % 36) - 18.0f; break;
+            case 4: x = (float)rng.Int(-18, 18); z = (float)rng.Int(-18, 18); break;
             case 5:
-                float angle = (rand() % 360) * 3.14f / 180.0f;
+                float angle = rng.Float(0.0f, DirectX::XM_2PI);
                 float r = 20.0f;
                 x = cosf(angle) * r; z = sinf(angle) * r;
                 break;
@@ -250,7 +261,7 @@ void GameScene::Initialize() {
             float scale = 1.0f;
             DirectX::XMFLOAT4 color = { 1.0f, 0.2f, 0.2f, 1.0f }; // 
 
-            int rnd = rand() % 100; // 0~99
+            int rnd = (int)rng.UInt(100); // 0~99
 
             if (currentStage == 1) {
                 // STAGE 1: قڎĜ
@@ -372,13 +383,17 @@ void GameScene::Initialize() {
             // Xe[W4 (p) ȂAꕔ̏㉺ɓ
             if (currentStage == 4) {
                 // 10%̊mœɂ
-                if (rand() % 100 < 2) {
+                if (rng.Chance(2)) {
                     pWorld->AddComponent<MovingComponent>(floorID, MovingComponent{
                         .startPos = { (float)x + 1.0f, -1.0f, (float)z + 1.0f },
                         .moveVec  = { 0.0f, 3.0f, 0.0f }, // 3m
-                        .speed    = 1.0f + (rand()%10)/10.0f,
-                        .time     = (float)(rand()%100)
+                        .speed    = rng.Float(1.0f, 2.0f),
+                        .time     = (float)rng.UInt(100)
                     });
+                    // ǉ:  Kinematic ɂĐÓIObhO (Ă蒼Ȃ)
+                    pWorld->GetComponent<ColliderComponent>(floorID).layer = CollisionLayer::Kinematic;
+                    // ŒXebvœ̂ŕ`͕Ԃ
+                    pWorld->GetComponent<TransformComponent>(floorID).interpolate = true;
                 }
             }
         }
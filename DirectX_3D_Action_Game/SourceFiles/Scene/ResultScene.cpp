@@ -179,9 +179,10 @@ void ResultScene::Draw() {
     }
     // --- ʃS (Ob`o) ---
     float scale = 1.0f + sinf(rs_blinkTimer * 3.0f) * 0.05f; // ۓ
-    bool isGlitch = (rand() % 100 < 5);
-    float offX = isGlitch ? (rand() % 10 - 5.0f) : 0.0f;
-    float offY = isGlitch ? (rand() % 10 - 5.0f) : 0.0f;
+    Random& rng = pWorld->GetRandom(RandomStream::UI);
+    bool isGlitch = rng.Chance(5);
+    float offX = isGlitch ? (float)rng.Int(-5, 5) : 0.0f;
+    float offY = isGlitch ? (float)rng.Int(-5, 5) : 0.0f;
 
     if (isClear) {
         // [MISSION ACCOMPLISHED]
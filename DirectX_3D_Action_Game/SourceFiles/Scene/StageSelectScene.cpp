@@ -124,8 +124,9 @@ void StageSelectScene::Draw() {
     }
 
     // --- wb_[ (Ob`) ---
-    bool isGlitch = (rand() % 100 < 2);
-    float offX = isGlitch ? (rand() % 4 - 2.0f) : 0.0f;
+    Random& rng = pWorld->GetRandom(RandomStream::UI);
+    bool isGlitch = rng.Chance(2);
+    float offX = isGlitch ? (float)rng.Int(-2, 2) : 0.0f;
     uint32_t headCol = isGlitch ? 0xFFFFFFFF : 0xFF00FF00; // 
 
     g->DrawString(L"MISSION SELECT", 100.0f + offX, 50.0f, 48.0f, headCol);
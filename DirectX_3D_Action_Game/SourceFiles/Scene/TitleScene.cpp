@@ -41,12 +41,13 @@ void TitleScene::Initialize() {
 
     // ̏ (100)
     stars.clear();
+    Random& rng = pWorld->GetRandom(RandomStream::UI);
     for (int i = 0; i < 100; ++i) {
         Star s;
-        s.x = (float)(rand() % Config::SCREEN_WIDTH);
-        s.y = (float)(rand() % Config::SCREEN_HEIGHT);
-        s.speed = 2.0f + (rand() % 100) / 10.0f; // 2.0 ~ 12.0
-        s.size = 1.0f + (rand() % 3);
+        s.x = (float)rng.UInt(Config::SCREEN_WIDTH);
+        s.y = (float)rng.UInt(Config::SCREEN_HEIGHT);
+        s.speed = rng.Float(2.0f, 12.0f); // 2.0 ~ 12.0
+        s.size = 1.0f + rng.UInt(3);
         stars.push_back(s);
     }
 }
@@ -61,11 +62,12 @@ void TitleScene::Update(float dt) {
     blinkTimer += dt;
 
     // ̈ړXV (E獶֗)
+    Random& rng = pWorld->GetRandom(RandomStream::UI);
     for (auto& s : stars) {
         s.x -= s.speed; // 
         if (s.x < 0) {
             s.x = (float)Config::SCREEN_WIDTH;
-            s.y = (float)(rand() % Config::SCREEN_HEIGHT);
+            s.y = (float)rng.UInt(Config::SCREEN_HEIGHT);
         }
     }
     // ---------------------------------------------------------
@@ -189,9 +191,10 @@ void TitleScene::Draw() {
         float logoY = 200.0f;
 
         // Ob` (_)
-        bool isGlitch = (rand() % 100 < 5);
-        float offsetX = isGlitch ? (rand() % 10 - 5.0f) : 0.0f;
-        float offsetY = isGlitch ? (rand() % 10 - 5.0f) : 0.0f;
+        Random& rng = pWorld->GetRandom(RandomStream::UI);
+        bool isGlitch = rng.Chance(5);
+        float offsetX = isGlitch ? (float)rng.Int(-5, 5) : 0.0f;
+        float offsetY = isGlitch ? (float)rng.Int(-5, 5) : 0.0f;
         uint32_t logoCol = isGlitch ? 0xFFFFFFFF : 0xFF00FFFF; // Ob`͔Aʏ̓VA
 
         // CS
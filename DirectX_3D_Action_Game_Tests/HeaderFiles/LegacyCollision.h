@@ -0,0 +1,31 @@
+/*===================================================================
+// ファイル: LegacyCollision.h
+// 概要: 置き換える前の当たり判定 (比較用の基準)
+//       PhysicsSystem から判定の部分だけを抜き出したもので、ゲームでは使わない
+=====================================================================*/
+#pragma once
+#include <DirectXMath.h>
+
+namespace Legacy {
+
+    // 線分(p1-q1) と 線分(p2-q2) の最短距離の2乗 (outC1/outC2 に最近点)
+    // 元: 4997fc4 の PhysicsSystem.cpp (カプセルと箱の辺の判定に使っていたもの)
+    float SegmentToSegmentDistSq(DirectX::XMVECTOR p1, DirectX::XMVECTOR q1,
+        DirectX::XMVECTOR p2, DirectX::XMVECTOR q2, DirectX::XMVECTOR& outC1, DirectX::XMVECTOR& outC2);
+
+    // カプセル vs OBB (芯を radius*0.05 刻みで調べ、さらに箱の12辺と線分同士の距離を調べる)
+    // 元: 4997fc4 の PhysicsSystem::CheckAndResolve の判定部分
+    // boxWorld は回転 * 平行移動。逆行列は毎回ここで求める (元の通り)
+    bool CapsuleOBBSampled(const DirectX::XMFLOAT3& segStart, const DirectX::XMFLOAT3& segEnd, float radius,
+        const DirectX::XMFLOAT4X4& boxWorld, const DirectX::XMFLOAT3& extents, DirectX::XMFLOAT3& outPush);
+
+    // レイ vs OBB (BoundingOrientedBox::Intersects。向きは回転角からクォータニオンを作る)
+    // 元: 4997fc4 の PhysicsSystem.cpp の RaycastGround
+    bool RaycastBoundingOBB(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents, const DirectX::XMFLOAT3& rotation,
+        const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float& outDist);
+
+    // 球 vs OBB (箱のワールド行列を作って逆行列でローカルへ移し、最近点との距離を見る)
+    // 元: 4997fc4 の PhysicsSystem::CheckAttackSphereHit の判定部分
+    bool SphereOverlapInverse(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents, const DirectX::XMFLOAT3& rotation,
+        const DirectX::XMFLOAT3& sphereCenter, float radius, float& outPenetration);
+}
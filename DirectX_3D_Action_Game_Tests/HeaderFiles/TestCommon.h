@@ -0,0 +1,48 @@
+/*===================================================================
+// ファイル: TestCommon.h
+// 概要: テスト・ベンチマーク用の共通部品
+//       判定マクロ (失敗を数えて続ける)、計時、結果の表示
+//       乱数はゲームと同じ Random (PCG32) を固定シードで使う
+=====================================================================*/
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+
+namespace Test {
+
+    // 失敗した判定の数 (main の戻り値になる)
+    extern int failures;
+    // 通った判定の数
+    extern int passes;
+
+    void ReportFailure(const char* file, int line, const char* message);
+
+    // 経過時間 (ナノ秒)
+    class Timer {
+    public:
+        Timer() : start(std::chrono::steady_clock::now()) {}
+        void Reset() { start = std::chrono::steady_clock::now(); }
+        double ElapsedNs() const {
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+    private:
+        std::chrono::steady_clock::time_point start;
+    };
+
+    // 最適化で計算ごと消されないように結果を混ぜておく先
+    extern volatile float sink;
+
+    // ベンチマークの1行
+    inline void PrintBench(const char* name, double totalNs, double count, const char* unit) {
+        std::printf("  %-44s %9.1f ns/%s\n", name, totalNs / count, unit);
+    }
+}
+
+// 失敗しても止めずに数えて続ける (同じテストの他の判定も見たいので)
+#define TEST_CHECK(expr) \
+    do { if (expr) ++Test::passes; else Test::ReportFailure(__FILE__, __LINE__, #expr); } while (0)
+
+#define TEST_CHECK_NEAR(a, b, tol) \
+    do { if (std::fabs((double)(a) - (double)(b)) <= (double)(tol)) ++Test::passes; \
+         else Test::ReportFailure(__FILE__, __LINE__, #a " ~= " #b); } while (0)
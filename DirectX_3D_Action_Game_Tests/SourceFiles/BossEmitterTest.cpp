@@ -0,0 +1,72 @@
+/*===================================================================
+// ファイル: BossEmitterTest.cpp
+// 概要: ボスの弾幕の発射装置 (ProjectileSystem::RunEmitters) のテスト
+//       1. 撃っている最中のボスがノックバックされたら、そのステップから撃たず、
+//          パターンが打ち切られるか (怯んでいる間に弾幕を撃ち続けない)
+//       2. 立ち直った後に撃ち直したパターンは普通に撃てるか
+//       プレイヤーは置かない (当たり判定は PhysicsParallelTest の方で見る)
+=====================================================================*/
+#include "TestCommon.h"
+#include "App/Main.h"
+#include "ECS/World.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "ECS/Systems/ProjectileSystem.h"
+#include "ECS/Components/TransformComponent.h"
+#include "ECS/Components/EnemyComponent.h"
+#include "ECS/Components/PatternEmitterComponent.h"
+#include "Game/BulletPattern.h"
+
+using namespace DirectX;
+
+namespace {
+
+    constexpr float DT = 1.0f / 60.0f;
+
+    // 何ステップか回して、撃った弾の数を返す
+    uint32_t Run(ProjectileSystem* projectiles, int steps) {
+        uint32_t spawned = 0;
+        for (int i = 0; i < steps; ++i) {
+            projectiles->Update(DT);
+            spawned += projectiles->GetStats().spawned;
+        }
+        return spawned;
+    }
+
+    void TestStunnedBossStopsFiring() {
+        World world;
+        world.SetRandomSeed(45);
+        world.AddFixedSystem<PhysicsSystem>()->Init(&world);
+        ProjectileSystem* projectiles = world.AddFixedSystem<ProjectileSystem>();
+        projectiles->Init(&world);
+
+        EntityID boss = world.CreateEntity().Build();
+        world.AddComponent<TransformComponent>(boss, TransformComponent{ .position = { 0.0f, 2.0f, 0.0f } });
+        world.AddComponent<EnemyComponent>(boss, EnemyComponent{ .type = EnemyType::Boss });
+        world.AddComponent<PatternEmitterComponent>(boss);
+        auto& emitter = world.GetComponent<PatternEmitterComponent>(boss);
+        auto& enemy = world.GetComponent<EnemyComponent>(boss);
+
+        // 全方位弾幕 (標的がいなくても撃つ) を撃ち始める
+        emitter.Start(BulletPatternID::RingBarrage, 0.0f, 0.0f);
+        const uint32_t before = Run(projectiles, 30);
+        TEST_CHECK(before > 0);
+        TEST_CHECK(emitter.active);
+
+        // ノックバックされたステップから撃たない
+        enemy.knockbackTimer = 0.5f;
+        TEST_CHECK(Run(projectiles, 1) == 0);
+        TEST_CHECK(!emitter.active);
+        TEST_CHECK(Run(projectiles, 20) == 0);
+
+        // 立ち直った後に撃ち始めたパターンは撃てる
+        enemy.knockbackTimer = 0.0f;
+        TEST_CHECK(Run(projectiles, 10) == 0);  // 打ち切ったパターンは再開しない
+        emitter.Start(BulletPatternID::RingBarrage, 0.0f, 0.0f);
+        TEST_CHECK(Run(projectiles, 30) > 0);
+        std::printf("  boss       fired %u bullets in 0.5s, 0 while stunned\n", before);
+    }
+}
+
+void RunBossEmitterTests() {
+    TestStunnedBossStopsFiring();
+}
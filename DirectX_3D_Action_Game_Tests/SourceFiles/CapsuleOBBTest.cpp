@@ -0,0 +1,227 @@
+/*===================================================================
+// ファイル: CapsuleOBBTest.cpp
+// 概要: カプセル vs OBB の厳密解 (Collision::CapsuleOBBContact) のテスト
+//       1. 答えが分かる配置で、押し出しの向きと深さを確かめる
+//       2. ランダムな組で、置き換える前のサンプリング版 (Legacy) と比べる
+//       3. 1組あたりの手間を両方で測る
+=====================================================================*/
+#include "TestCommon.h"
+#include "LegacyCollision.h"
+#include "Engine/Collision.h"
+#include "Engine/Random.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <algorithm>
+
+using namespace DirectX;
+
+namespace {
+
+    struct CapsuleBoxPair {
+        XMFLOAT3 segStart, segEnd;
+        float radius;
+        XMFLOAT4X4 world, invWorld;
+        XMFLOAT3 extents;
+    };
+
+    // 回転 * 平行移動 (GetOBB・ColliderCache と同じ作り方)
+    void SetBox(CapsuleBoxPair& p, const XMFLOAT3& center, const XMFLOAT3& rotation, const XMFLOAT3& extents) {
+        const XMMATRIX world = XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z) *
+            XMMatrixTranslation(center.x, center.y, center.z);
+        XMVECTOR det;
+        XMStoreFloat4x4(&p.world, world);
+        XMStoreFloat4x4(&p.invWorld, XMMatrixInverse(&det, world));
+        p.extents = extents;
+    }
+
+    void SetCapsule(CapsuleBoxPair& p, const XMFLOAT3& center, const XMFLOAT3& axis, float halfLen, float radius) {
+        p.segStart = { center.x - axis.x * halfLen, center.y - axis.y * halfLen, center.z - axis.z * halfLen };
+        p.segEnd = { center.x + axis.x * halfLen, center.y + axis.y * halfLen, center.z + axis.z * halfLen };
+        p.radius = radius;
+    }
+
+    float Length(const XMFLOAT3& v) { return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z); }
+    float Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    bool Exact(const CapsuleBoxPair& p, XMFLOAT3& push, float& gap) {
+        return Collision::CapsuleOBBContact(p.segStart, p.segEnd, p.radius, p.world, p.invWorld, p.extents, push, gap);
+    }
+
+    // -----------------------------------------------------------------
+    // 答えが分かる配置
+    // -----------------------------------------------------------------
+    void TestAnalytic() {
+        const XMFLOAT3 up = { 0.0f, 1.0f, 0.0f };
+        CapsuleBoxPair p;
+        XMFLOAT3 push;
+        float gap;
+
+        // 床 (上面 y=0.5) に立つカプセル: 足元が 0.1 めり込む → 真上に 0.1
+        SetBox(p, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 5.0f, 0.5f, 5.0f });
+        SetCapsule(p, { 1.0f, 0.5f + 0.4f + 0.5f - 0.1f, 2.0f }, up, 0.4f, 0.5f);
+        TEST_CHECK(Exact(p, push, gap));
+        TEST_CHECK_NEAR(push.x, 0.0f, 1e-5f);
+        TEST_CHECK_NEAR(push.y, 0.1f, 1e-4f);
+        TEST_CHECK_NEAR(push.z, 0.0f, 1e-5f);
+        TEST_CHECK_NEAR(gap, -0.1f, 1e-4f);
+
+        // 同じ床から 0.2 浮いている → 当たらず、隙間 0.2
+        SetCapsule(p, { 1.0f, 0.5f + 0.4f + 0.5f + 0.2f, 2.0f }, up, 0.4f, 0.5f);
+        TEST_CHECK(!Exact(p, push, gap));
+        TEST_CHECK_NEAR(gap, 0.2f, 1e-4f);
+
+        // Y軸に45度回した箱の角 (x = 1*√2) に横から触れるカプセル → 角から離れる +X へ
+        SetBox(p, { 0.0f, 0.0f, 0.0f }, { 0.0f, XM_PIDIV4, 0.0f }, { 1.0f, 1.0f, 1.0f });
+        const float corner = std::sqrt(2.0f);
+        SetCapsule(p, { corner + 0.3f, 0.0f, 0.0f }, up, 0.5f, 0.4f);
+        TEST_CHECK(Exact(p, push, gap));
+        TEST_CHECK_NEAR(push.x, 0.1f, 1e-4f);
+        TEST_CHECK_NEAR(push.y, 0.0f, 1e-5f);
+        TEST_CHECK_NEAR(push.z, 0.0f, 1e-5f);
+
+        // 芯の長さ0 (球) と箱の頂点: 隙間 = 頂点までの距離 - 半径
+        SetBox(p, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+        SetCapsule(p, { 1.2f, 1.3f, 1.1f }, up, 0.0f, 0.5f);
+        const float toCorner = std::sqrt(0.04f + 0.09f + 0.01f);
+        TEST_CHECK(Exact(p, push, gap));
+        TEST_CHECK_NEAR(gap, toCorner - 0.5f, 1e-4f);
+        TEST_CHECK_NEAR(Length(push), 0.5f - toCorner, 1e-4f);
+        TEST_CHECK_NEAR(push.x / Length(push), 0.2f / toCorner, 1e-3f);
+
+        // 芯が箱を斜めに貫く: 一番深い点は箱の中心。一番近い面 (z, 半サイズ0.6) から押し出す
+        SetBox(p, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.8f, 0.6f });
+        const float s = 1.0f / std::sqrt(3.0f);
+        SetCapsule(p, { 0.0f, 0.0f, 0.0f }, { s, s, s }, 3.0f, 0.25f);
+        TEST_CHECK(Exact(p, push, gap));
+        TEST_CHECK_NEAR(std::fabs(push.z), 0.6f + 0.25f, 1e-4f);
+        TEST_CHECK_NEAR(push.x, 0.0f, 1e-5f);
+        TEST_CHECK_NEAR(push.y, 0.0f, 1e-5f);
+        TEST_CHECK_NEAR(gap, -0.25f, 1e-4f);
+
+        // 面と平行な芯が2つの面の外 (辺の斜め外) にいる: 辺から斜め45度に離れる
+        SetBox(p, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+        const float off = 1.0f + 0.3f / std::sqrt(2.0f);
+        SetCapsule(p, { off, 0.0f, off }, up, 0.5f, 0.4f);
+        TEST_CHECK(Exact(p, push, gap));
+        TEST_CHECK_NEAR(gap, -0.1f, 1e-4f);
+        TEST_CHECK_NEAR(push.x, push.z, 1e-5f);
+        TEST_CHECK_NEAR(push.y, 0.0f, 1e-5f);
+    }
+
+    // -----------------------------------------------------------------
+    // ランダムな組 (upright: ゲームと同じ縦向きのカプセルだけ)
+    // -----------------------------------------------------------------
+    std::vector<CapsuleBoxPair> MakePairs(Random& rng, size_t count, bool upright) {
+        std::vector<CapsuleBoxPair> pairs(count);
+        for (CapsuleBoxPair& p : pairs) {
+            const XMFLOAT3 ext = { rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f) };
+            const XMFLOAT3 rot = { rng.Float(-XM_PI, XM_PI), rng.Float(-XM_PI, XM_PI), rng.Float(-XM_PI, XM_PI) };
+            SetBox(p, { rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f) }, rot, ext);
+
+            XMFLOAT3 axis = { 0.0f, 1.0f, 0.0f };
+            if (!upright) {
+                XMStoreFloat3(&axis, XMVector3Normalize(XMVectorSet(
+                    rng.Float(-1.0f, 1.0f), rng.Float(-1.0f, 1.0f), rng.Float(-1.0f, 1.0f), 0.0f)));
+            }
+            const float radius = rng.Float(0.2f, 1.0f);
+            const float halfLen = rng.Float(0.0f, 1.5f);
+            // 箱の周り (半分くらいが当たる範囲) に置く
+            const float reach = std::max({ ext.x, ext.y, ext.z }) + radius + halfLen * 0.5f;
+            const XMFLOAT3 c = {
+                p.world.m[3][0] + rng.Float(-reach, reach),
+                p.world.m[3][1] + rng.Float(-reach, reach),
+                p.world.m[3][2] + rng.Float(-reach, reach),
+            };
+            SetCapsule(p, c, axis, halfLen, radius);
+        }
+        return pairs;
+    }
+
+    void CompareWithSampled(const char* label, const std::vector<CapsuleBoxPair>& pairs) {
+        int hits = 0, deep = 0, boundaryMisses = 0, ties = 0;
+        float maxDepthError = 0.0f, minNormalDot = 1.0f;
+
+        for (const CapsuleBoxPair& p : pairs) {
+            XMFLOAT3 pushNew, pushOld;
+            float gap;
+            const bool hitNew = Exact(p, pushNew, gap);
+            const bool hitOld = Legacy::CapsuleOBBSampled(p.segStart, p.segEnd, p.radius, p.world, p.extents, pushOld);
+
+            // サンプリングの刻み (芯の長さ / 分割数)。古い方の誤差はこの半分まで
+            const float segLen = Length({ p.segEnd.x - p.segStart.x, p.segEnd.y - p.segStart.y, p.segEnd.z - p.segStart.z });
+            const float step = segLen / (float)(static_cast<int>(segLen / (p.radius * 0.05f)) + 1);
+            const float depthTol = step * 0.5f + 1e-4f;
+
+            if (hitNew != hitOld) {
+                // 表面ぎりぎりの組だけは、刻みの分だけずれてよい
+                if (std::fabs(gap) <= depthTol) ++boundaryMisses;
+                else TEST_CHECK(hitNew == hitOld);
+                continue;
+            }
+            if (!hitNew) continue;
+            ++hits;
+            if (gap <= -p.radius + 1e-6f) ++deep;
+
+            const float depthNew = Length(pushNew);
+            const float depthOld = Length(pushOld);
+            TEST_CHECK_NEAR(depthNew, depthOld, depthTol);
+            maxDepthError = std::max(maxDepthError, std::fabs(depthNew - depthOld));
+
+            // 押し出しの向き。芯が箱の中で、同じ深さの面が2つある時だけは別の面を選んでよい
+            const float dot = Dot(pushNew, pushOld) / std::max(depthNew * depthOld, 1e-12f);
+            if (dot < 0.99f && std::fabs(depthNew - depthOld) <= depthTol && gap <= -p.radius + 1e-6f) {
+                ++ties;
+                continue;
+            }
+            // めり込みがごく浅い時は、向きが刻みの分だけ揺れる
+            if (depthNew <= 1e-3f) continue;
+            TEST_CHECK(dot >= 0.99f);
+            minNormalDot = std::min(minNormalDot, dot);
+        }
+        std::printf("  %-10s pairs %zu  hits %d (deep %d)  max depth err %.5f  min normal dot %.5f"
+                    "  boundary %d  deep, other face within tol %d\n",
+            label, pairs.size(), hits, deep, maxDepthError, minNormalDot, boundaryMisses, ties);
+    }
+
+    // -----------------------------------------------------------------
+    // 1組あたりの手間
+    // -----------------------------------------------------------------
+    void Bench(const std::vector<CapsuleBoxPair>& pairs) {
+        constexpr int REPEAT = 5;
+        XMFLOAT3 push;
+        float gap;
+
+        Test::Timer timer;
+        float acc = 0.0f;
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const CapsuleBoxPair& p : pairs) {
+                if (Exact(p, push, gap)) acc += push.y;
+            }
+        }
+        const double exactNs = timer.ElapsedNs();
+
+        timer.Reset();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const CapsuleBoxPair& p : pairs) {
+                if (Legacy::CapsuleOBBSampled(p.segStart, p.segEnd, p.radius, p.world, p.extents, push)) acc += push.y;
+            }
+        }
+        const double sampledNs = timer.ElapsedNs();
+        Test::sink = Test::sink + acc;
+
+        const double count = (double)pairs.size() * REPEAT;
+        Test::PrintBench("CapsuleOBBContact (exact)", exactNs, count, "pair");
+        Test::PrintBench("CapsuleOBBSampled (old, sampled + 12 edges)", sampledNs, count, "pair");
+    }
+}
+
+void RunCapsuleOBBTests() {
+    TestAnalytic();
+
+    Random rng(28, 0);
+    const std::vector<CapsuleBoxPair> upright = MakePairs(rng, 100000, true);
+    const std::vector<CapsuleBoxPair> tilted = MakePairs(rng, 100000, false);
+    CompareWithSampled("upright", upright);
+    CompareWithSampled("tilted", tilted);
+    Bench(upright);
+}
@@ -0,0 +1,350 @@
+/*===================================================================
+// ファイル: CollisionBatchTest.cpp
+// 概要: SIMD一括判定 (RaycastBatch / SphereOverlapBatch / SweepSphereBatch) のテスト
+//       1. 一括版とスカラー版 (RaycastOBB / SphereOverlapOBB) の結果が同じか
+//       2. スカラー版と置き換える前の判定 (BoundingOrientedBox・逆行列) が同じか
+//       箱の数は SIMD の幅で割り切れない数も含め、端数のレーンも通す
+//       3. 1組 (レイ・球 × 箱) あたりの手間を3つで比べる
+=====================================================================*/
+#include "TestCommon.h"
+#include "LegacyCollision.h"
+#include "Engine/Collision.h"
+#include "Engine/Random.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <algorithm>
+#include <cfloat>
+
+using namespace DirectX;
+
+namespace {
+
+    // 一括判定の箱と、置き換える前の判定に渡す元の値
+    struct BoxSet {
+        Collision::OBBSoA soa;
+        std::vector<XMFLOAT3> center, extents, rotation;
+    };
+
+    BoxSet MakeBoxes(Random& rng, size_t count) {
+        BoxSet set;
+        set.soa.Reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const XMFLOAT3 c = { rng.Float(-20.0f, 20.0f), rng.Float(-2.0f, 2.0f), rng.Float(-20.0f, 20.0f) };
+            const XMFLOAT3 e = { rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f) };
+            const XMFLOAT3 r = { rng.Float(-XM_PI, XM_PI), rng.Float(-XM_PI, XM_PI), rng.Float(-XM_PI, XM_PI) };
+            set.soa.Add((uint32_t)(1000 + i), c, e, r);
+            set.center.push_back(c);
+            set.extents.push_back(e);
+            set.rotation.push_back(r);
+        }
+        return set;
+    }
+
+    // 箱の方へ向かうレイ (半分くらいはどれかの箱に当たる)
+    Collision::RayQuery MakeRay(Random& rng, const BoxSet& boxes, float radius) {
+        Collision::RayQuery ray;
+        ray.origin = { rng.Float(-25.0f, 25.0f), rng.Float(-4.0f, 4.0f), rng.Float(-25.0f, 25.0f) };
+        XMFLOAT3 aim = { rng.Float(-20.0f, 20.0f), 0.0f, rng.Float(-20.0f, 20.0f) };
+        if (boxes.soa.Size() > 0) aim = boxes.center[rng.UInt((uint32_t)boxes.soa.Size())];
+        aim.x += rng.Float(-2.0f, 2.0f);
+        aim.y += rng.Float(-2.0f, 2.0f);
+        aim.z += rng.Float(-2.0f, 2.0f);
+        XMStoreFloat3(&ray.direction, XMVector3Normalize(XMLoadFloat3(&aim) - XMLoadFloat3(&ray.origin)));
+        ray.maxDist = rng.Float(5.0f, 60.0f);
+        ray.radius = radius;
+        return ray;
+    }
+
+    // 表面ぎりぎりの組 (箱を eps 太らせた時と細らせた時で答えが変わる) か
+    // こういう組だけは、計算の順番の違いで答えが分かれてよい
+    bool IsGrazing(const Collision::OBBSoA& boxes, size_t i, Collision::RayQuery ray, bool useMaxDist) {
+        constexpr float EPS = 1e-3f;
+        float dFat = 0.0f, dThin = 0.0f;
+        ray.radius += EPS;
+        bool fat = Collision::RaycastOBB(boxes, i, ray, dFat);
+        ray.radius -= 2.0f * EPS;
+        bool thin = Collision::RaycastOBB(boxes, i, ray, dThin);
+        if (useMaxDist) {
+            fat = fat && dFat <= ray.maxDist + EPS;
+            thin = thin && dThin <= ray.maxDist - EPS;
+        }
+        return fat != thin;
+    }
+
+    float Tolerance(float value) { return 1e-4f * (1.0f + std::fabs(value)); }
+
+    // SIMD の幅 (4 / 8) の前後と倍数の前後。0個と1個 (全部端数) も含める
+    const size_t BOX_COUNTS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 15, 16, 17, 23, 24, 25, 31, 33, 63, 65, 257 };
+    constexpr int QUERIES_PER_COUNT = 200;
+
+    // -----------------------------------------------------------------
+    // レイ
+    // -----------------------------------------------------------------
+    void TestRaycast(Random& rng) {
+        int hits = 0, ties = 0, grazing = 0;
+        for (size_t count : BOX_COUNTS) {
+            const BoxSet boxes = MakeBoxes(rng, count);
+            std::vector<Collision::RayQuery> rays;
+            for (int q = 0; q < QUERIES_PER_COUNT; ++q) rays.push_back(MakeRay(rng, boxes, 0.0f));
+            std::vector<Collision::RayHit> out(rays.size());
+            Collision::RaycastBatch(boxes.soa, rays.data(), out.data(), rays.size());
+
+            for (size_t r = 0; r < rays.size(); ++r) {
+                const Collision::RayQuery& ray = rays[r];
+
+                // スカラー版で一番近い箱 (同じ距離なら小さい番号)
+                float best = ray.maxDist;
+                int bestIndex = -1;
+                for (size_t i = 0; i < count; ++i) {
+                    float d;
+                    if (Collision::RaycastOBB(boxes.soa, i, ray, d) && d < best) {
+                        best = d;
+                        bestIndex = (int)i;
+                    }
+                }
+                const Collision::RayHit& hit = out[r];
+                TEST_CHECK(hit.hit == (bestIndex >= 0));
+                if (bestIndex < 0) {
+                    TEST_CHECK(hit.index == -1 && hit.id == Collision::INVALID_ID);
+                }
+                else {
+                    ++hits;
+                    TEST_CHECK_NEAR(hit.distance, best, Tolerance(best));
+                    if (hit.index == bestIndex) {
+                        TEST_CHECK(hit.id == boxes.soa.ids[bestIndex]);
+                    }
+                    else {
+                        // 別の箱でも、同じ距離で当たっていればよい
+                        ++ties;
+                        TEST_CHECK(hit.index >= 0 && hit.id == boxes.soa.ids[hit.index]);
+                    }
+                }
+
+                // 置き換える前の判定 (箱ごと)
+                for (size_t i = 0; i < count; ++i) {
+                    float dNew = 0.0f, dOld = 0.0f;
+                    const bool hitNew = Collision::RaycastOBB(boxes.soa, i, ray, dNew);
+                    const bool hitOld = Legacy::RaycastBoundingOBB(boxes.center[i], boxes.extents[i], boxes.rotation[i],
+                        ray.origin, ray.direction, dOld);
+                    if (hitNew != hitOld) {
+                        if (IsGrazing(boxes.soa, i, ray, false)) ++grazing;
+                        else TEST_CHECK(hitNew == hitOld);
+                        continue;
+                    }
+                    if (hitNew) TEST_CHECK_NEAR(dNew, dOld, 1e-3f * (1.0f + std::fabs(dOld)));
+                }
+            }
+        }
+        std::printf("  raycast    counts %zu  rays %d  nearest hits %d  equal-distance ties %d  grazing vs old %d\n",
+            std::size(BOX_COUNTS), (int)std::size(BOX_COUNTS) * QUERIES_PER_COUNT, hits, ties, grazing);
+    }
+
+    // -----------------------------------------------------------------
+    // 球
+    // -----------------------------------------------------------------
+    void TestSphere(Random& rng) {
+        int hits = 0, boundary = 0;
+        for (size_t count : BOX_COUNTS) {
+            const BoxSet boxes = MakeBoxes(rng, count);
+            // 配列は余分に取って、書きすぎていないかも見る
+            std::vector<uint8_t> outHit(count + 8, 0xCD);
+            std::vector<float> outPen(count + 8, -123.0f);
+
+            for (int q = 0; q < QUERIES_PER_COUNT; ++q) {
+                XMFLOAT3 c = { rng.Float(-20.0f, 20.0f), rng.Float(-2.0f, 2.0f), rng.Float(-20.0f, 20.0f) };
+                if (count > 0) {
+                    const XMFLOAT3& box = boxes.center[rng.UInt((uint32_t)count)];
+                    c = { box.x + rng.Float(-3.0f, 3.0f), box.y + rng.Float(-3.0f, 3.0f), box.z + rng.Float(-3.0f, 3.0f) };
+                }
+                const float radius = rng.Float(0.1f, 2.5f);
+                const size_t hitCount = Collision::SphereOverlapBatch(boxes.soa, c, radius, outHit.data(), outPen.data());
+
+                size_t expectedCount = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    float pen = 0.0f, penOld = 0.0f;
+                    const bool hit = Collision::SphereOverlapOBB(boxes.soa, i, c, radius, pen);
+                    const bool hitOld = Legacy::SphereOverlapInverse(boxes.center[i], boxes.extents[i], boxes.rotation[i],
+                        c, radius, penOld);
+                    TEST_CHECK(outHit[i] <= 1);
+                    TEST_CHECK_NEAR(outPen[i], pen, Tolerance(pen));
+                    // 表面ちょうどの組だけは一括版とスカラー版で分かれてよい
+                    if ((outHit[i] != 0) != hit) {
+                        if (std::fabs(pen) <= Tolerance(radius)) ++boundary;
+                        else TEST_CHECK((outHit[i] != 0) == hit);
+                    }
+                    if (outHit[i]) ++expectedCount;
+                    if (hit) ++hits;
+
+                    if (hit != hitOld) {
+                        if (std::fabs(pen) <= 1e-3f) ++boundary;
+                        else TEST_CHECK(hit == hitOld);
+                    }
+                    else if (hit) {
+                        TEST_CHECK_NEAR(pen, penOld, 1e-3f * (1.0f + radius));
+                    }
+                }
+                TEST_CHECK(hitCount == expectedCount);
+                for (size_t i = count; i < count + 8; ++i) TEST_CHECK(outHit[i] == 0xCD && outPen[i] == -123.0f);
+            }
+        }
+        std::printf("  sphere     hits %d  on-surface splits %d\n", hits, boundary);
+    }
+
+    // -----------------------------------------------------------------
+    // 掃引球 (全ヒット)
+    // -----------------------------------------------------------------
+    void TestSweep(Random& rng) {
+        int hits = 0, grazing = 0;
+        for (size_t count : BOX_COUNTS) {
+            const BoxSet boxes = MakeBoxes(rng, count);
+            std::vector<uint8_t> outHit(count + 8, 0xCD);
+            std::vector<float> outToi(count + 8, -123.0f);
+
+            for (int q = 0; q < QUERIES_PER_COUNT; ++q) {
+                const Collision::RayQuery ray = MakeRay(rng, boxes, rng.Float(0.05f, 1.0f));
+                const size_t hitCount = Collision::SweepSphereBatch(boxes.soa, ray, outHit.data(), outToi.data());
+
+                size_t expectedCount = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    float d = 0.0f;
+                    const bool hit = Collision::RaycastOBB(boxes.soa, i, ray, d) && d <= ray.maxDist;
+                    TEST_CHECK(outHit[i] <= 1);
+                    if ((outHit[i] != 0) != hit) {
+                        if (IsGrazing(boxes.soa, i, ray, true)) ++grazing;
+                        else TEST_CHECK((outHit[i] != 0) == hit);
+                    }
+                    else if (hit) {
+                        ++hits;
+                        TEST_CHECK_NEAR(outToi[i], std::max(d, 0.0f), Tolerance(d));
+                    }
+                    if (outHit[i]) ++expectedCount;
+
+                    // 置き換える前の判定: 箱を半径だけ太らせた BoundingOrientedBox (同じ近似)
+                    const XMFLOAT3 fat = { boxes.extents[i].x + ray.radius, boxes.extents[i].y + ray.radius, boxes.extents[i].z + ray.radius };
+                    float dOld = 0.0f;
+                    const bool hitOld = Legacy::RaycastBoundingOBB(boxes.center[i], fat, boxes.rotation[i],
+                        ray.origin, ray.direction, dOld) && dOld <= ray.maxDist;
+                    if (hitOld != hit) {
+                        if (IsGrazing(boxes.soa, i, ray, true)) ++grazing;
+                        else TEST_CHECK(hitOld == hit);
+                    }
+                    else if (hit) {
+                        TEST_CHECK_NEAR(std::max(dOld, 0.0f), std::max(d, 0.0f), 1e-3f * (1.0f + std::fabs(d)));
+                    }
+                }
+                TEST_CHECK(hitCount == expectedCount);
+                for (size_t i = count; i < count + 8; ++i) TEST_CHECK(outHit[i] == 0xCD && outToi[i] == -123.0f);
+            }
+        }
+        std::printf("  sweep      hits %d  grazing %d\n", hits, grazing);
+    }
+
+    // -----------------------------------------------------------------
+    // 手間 (ゲームの静的な箱くらいの数。端数のレーンも入るよう 8 で割り切れない数)
+    // -----------------------------------------------------------------
+    void Bench(Random& rng) {
+        constexpr size_t BOXES = 1027;
+        constexpr size_t QUERIES = 512;
+        const BoxSet boxes = MakeBoxes(rng, BOXES);
+        std::vector<Collision::RayQuery> rays, sweeps;
+        std::vector<XMFLOAT3> spheres;
+        for (size_t q = 0; q < QUERIES; ++q) {
+            rays.push_back(MakeRay(rng, boxes, 0.0f));
+            sweeps.push_back(MakeRay(rng, boxes, 0.3f));
+            spheres.push_back({ rng.Float(-20.0f, 20.0f), rng.Float(-2.0f, 2.0f), rng.Float(-20.0f, 20.0f) });
+        }
+        const double pairs = (double)BOXES * QUERIES;
+        std::vector<Collision::RayHit> hits(QUERIES);
+        std::vector<uint8_t> outHit(BOXES);
+        std::vector<float> outValue(BOXES);
+        float acc = 0.0f;
+        Test::Timer timer;
+
+        // レイ (一番近い箱)
+        timer.Reset();
+        Collision::RaycastBatch(boxes.soa, rays.data(), hits.data(), QUERIES);
+        for (const Collision::RayHit& h : hits) acc += h.distance;
+        Test::PrintBench("RaycastBatch", timer.ElapsedNs(), pairs, "pair");
+
+        timer.Reset();
+        for (const Collision::RayQuery& ray : rays) {
+            float best = ray.maxDist;
+            for (size_t i = 0; i < BOXES; ++i) {
+                float d;
+                if (Collision::RaycastOBB(boxes.soa, i, ray, d) && d < best) best = d;
+            }
+            acc += best;
+        }
+        Test::PrintBench("RaycastOBB (scalar loop)", timer.ElapsedNs(), pairs, "pair");
+
+        timer.Reset();
+        for (const Collision::RayQuery& ray : rays) {
+            float best = ray.maxDist;
+            for (size_t i = 0; i < BOXES; ++i) {
+                float d;
+                if (Legacy::RaycastBoundingOBB(boxes.center[i], boxes.extents[i], boxes.rotation[i], ray.origin, ray.direction, d) &&
+                    d < best) best = d;
+            }
+            acc += best;
+        }
+        Test::PrintBench("BoundingOrientedBox (old)", timer.ElapsedNs(), pairs, "pair");
+
+        // 球
+        timer.Reset();
+        for (const XMFLOAT3& c : spheres) acc += (float)Collision::SphereOverlapBatch(boxes.soa, c, 1.0f, outHit.data(), outValue.data());
+        Test::PrintBench("SphereOverlapBatch", timer.ElapsedNs(), pairs, "pair");
+
+        timer.Reset();
+        for (const XMFLOAT3& c : spheres) {
+            for (size_t i = 0; i < BOXES; ++i) {
+                float pen;
+                if (Collision::SphereOverlapOBB(boxes.soa, i, c, 1.0f, pen)) acc += pen;
+            }
+        }
+        Test::PrintBench("SphereOverlapOBB (scalar loop)", timer.ElapsedNs(), pairs, "pair");
+
+        timer.Reset();
+        for (const XMFLOAT3& c : spheres) {
+            for (size_t i = 0; i < BOXES; ++i) {
+                float pen;
+                if (Legacy::SphereOverlapInverse(boxes.center[i], boxes.extents[i], boxes.rotation[i], c, 1.0f, pen)) acc += pen;
+            }
+        }
+        Test::PrintBench("matrix inverse per pair (old)", timer.ElapsedNs(), pairs, "pair");
+
+        // 掃引球 (全ヒット)
+        timer.Reset();
+        for (const Collision::RayQuery& ray : sweeps) acc += (float)Collision::SweepSphereBatch(boxes.soa, ray, outHit.data(), outValue.data());
+        Test::PrintBench("SweepSphereBatch", timer.ElapsedNs(), pairs, "pair");
+
+        timer.Reset();
+        for (const Collision::RayQuery& ray : sweeps) {
+            for (size_t i = 0; i < BOXES; ++i) {
+                float d;
+                if (Collision::RaycastOBB(boxes.soa, i, ray, d) && d <= ray.maxDist) acc += d;
+            }
+        }
+        Test::PrintBench("RaycastOBB with radius (scalar loop)", timer.ElapsedNs(), pairs, "pair");
+
+        timer.Reset();
+        for (const Collision::RayQuery& ray : sweeps) {
+            for (size_t i = 0; i < BOXES; ++i) {
+                const XMFLOAT3 fat = { boxes.extents[i].x + ray.radius, boxes.extents[i].y + ray.radius, boxes.extents[i].z + ray.radius };
+                float d;
+                if (Legacy::RaycastBoundingOBB(boxes.center[i], fat, boxes.rotation[i], ray.origin, ray.direction, d) &&
+                    d <= ray.maxDist) acc += d;
+            }
+        }
+        Test::PrintBench("BoundingOrientedBox, fattened (old)", timer.ElapsedNs(), pairs, "pair");
+
+        Test::sink = Test::sink + acc;
+    }
+}
+
+void RunCollisionBatchTests() {
+    Random rng(27, 0);
+    TestRaycast(rng);
+    TestSphere(rng);
+    TestSweep(rng);
+    Bench(rng);
+}
@@ -0,0 +1,630 @@
+/*===================================================================
+// ファイル: ConvexCollisionTest.cpp
+// 概要: GJK/EPA (Collision::ConvexOverlap, GjkClosestPoints) のテスト
+//       1. 球・箱・カプセル・凸包の組を、答えが式で分かる配置で確かめる
+//          (箱同士は軸をそろえた組を丸ごと回すので、回っていても答えが分かる)
+//       2. 単体がつぶれる配置 (中心が一致・接するだけ・芯が同一直線/平行・面の上の点)
+//       3. EPA が上限に当たらず収束しているかを反復回数で見る
+//       4. 1組あたりの手間を、OBB専用の判定 (SphereOverlapOBB, CapsuleOBBContact) と比べる
+=====================================================================*/
+#include "TestCommon.h"
+#include "LegacyCollision.h"
+#include "Engine/ConvexCollision.h"
+#include "Engine/Collision.h"
+#include "Engine/Random.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <algorithm>
+#include <cfloat>
+
+using namespace DirectX;
+using Collision::ConvexShape;
+using Collision::ConvexContact;
+
+namespace {
+
+    // ConvexCollision.cpp の反復回数の上限 (これに達したら収束していない)
+    constexpr int GJK_MAX_ITERATIONS = 32;
+    constexpr int EPA_MAX_ITERATIONS = 32;
+
+    // 深さ・距離の許容誤差 (EPA_TOLERANCE = 1e-4 と浮動小数の誤差の分)
+    constexpr float TOL = 1e-3f;
+
+    // 単位立方体 (±0.5)。ゲームの凸包と同じく、倍率を掛けて使う
+    const XMFLOAT3 CUBE_POINTS[8] = {
+        { -0.5f, -0.5f, -0.5f }, { 0.5f, -0.5f, -0.5f }, { -0.5f, 0.5f, -0.5f }, { 0.5f, 0.5f, -0.5f },
+        { -0.5f, -0.5f, 0.5f }, { 0.5f, -0.5f, 0.5f }, { -0.5f, 0.5f, 0.5f }, { 0.5f, 0.5f, 0.5f },
+    };
+    // 正八面体 |x|+|y|+|z| <= 1
+    const XMFLOAT3 OCTA_POINTS[6] = {
+        { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f },
+        { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f },
+    };
+
+    float Length(const XMFLOAT3& v) { return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z); }
+    float Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    XMFLOAT3 Scale(const XMFLOAT3& v, float s) { return { v.x * s, v.y * s, v.z * s }; }
+
+    // 回転 * 平行移動 (GetOBB・ColliderCache と同じ作り方)
+    XMFLOAT4X4 MakeWorld(const XMFLOAT3& center, const XMFLOAT3& rotation) {
+        XMFLOAT4X4 world;
+        XMStoreFloat4x4(&world, XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z) *
+            XMMatrixTranslation(center.x, center.y, center.z));
+        return world;
+    }
+
+    // 行ベクトルとして回す (ワールド行列の回転部分と同じ向き)
+    XMFLOAT3 Rotate(const XMFLOAT3& v, const XMFLOAT3& rotation) {
+        XMFLOAT3 r;
+        XMStoreFloat3(&r, XMVector3TransformNormal(XMLoadFloat3(&v),
+            XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z)));
+        return r;
+    }
+
+    XMFLOAT3 RandomRotation(Random& rng) {
+        return { rng.Float(-XM_PI, XM_PI), rng.Float(-XM_PI, XM_PI), rng.Float(-XM_PI, XM_PI) };
+    }
+
+    XMFLOAT3 RandomUnit(Random& rng) {
+        XMFLOAT3 v;
+        XMStoreFloat3(&v, XMVector3Normalize(XMVectorSet(
+            rng.Float(-1.0f, 1.0f), rng.Float(-1.0f, 1.0f), rng.Float(-1.0f, 1.0f), 0.0f)));
+        return v;
+    }
+
+    // 反復回数の集計
+    struct IterationStats {
+        int pairs = 0, epaPairs = 0;
+        int gjkMax = 0, epaMax = 0;
+        long long gjkSum = 0, epaSum = 0;
+
+        void Add(const ConvexContact& c) {
+            ++pairs;
+            gjkSum += c.gjkIterations;
+            gjkMax = std::max(gjkMax, c.gjkIterations);
+            if (c.epaIterations > 0) {
+                ++epaPairs;
+                epaSum += c.epaIterations;
+                epaMax = std::max(epaMax, c.epaIterations);
+            }
+        }
+        void Print(const char* label, float maxError) const {
+            std::printf("  %-16s pairs %6d  max err %.6f  gjk avg %.2f max %2d  epa pairs %6d avg %.2f max %2d\n",
+                label, pairs, maxError, pairs ? (double)gjkSum / pairs : 0.0, gjkMax,
+                epaPairs, epaPairs ? (double)epaSum / epaPairs : 0.0, epaMax);
+        }
+    };
+
+    // 球の中心から箱 (ワールド行列の回転部分 + 半サイズ) への答え
+    // 外なら最近点までの距離 - 半径、中なら -(半径 + 一番近い面までの距離)
+    // outTie: 中にいて、一番近い面が2つ以上ある (向きが決まらない)
+    float SphereBoxAnswer(const XMFLOAT3& c, float radius, const XMFLOAT4X4& world, const XMFLOAT3& ext,
+        XMFLOAT3& outNormal, bool& outTie) {
+        const XMFLOAT3 axis[3] = {
+            { world.m[0][0], world.m[0][1], world.m[0][2] },
+            { world.m[1][0], world.m[1][1], world.m[1][2] },
+            { world.m[2][0], world.m[2][1], world.m[2][2] },
+        };
+        const XMFLOAT3 d = Sub(c, { world.m[3][0], world.m[3][1], world.m[3][2] });
+        const float local[3] = { Dot(d, axis[0]), Dot(d, axis[1]), Dot(d, axis[2]) };
+        const float half[3] = { ext.x, ext.y, ext.z };
+
+        float outside[3];
+        bool inside = true;
+        for (int i = 0; i < 3; ++i) {
+            outside[i] = std::fabs(local[i]) - half[i];
+            if (outside[i] > 0.0f) inside = false;
+        }
+        outTie = false;
+        if (!inside) {
+            XMFLOAT3 n = { 0.0f, 0.0f, 0.0f };
+            for (int i = 0; i < 3; ++i) {
+                if (outside[i] > 0.0f) n = { n.x + axis[i].x * std::copysign(outside[i], local[i]),
+                                             n.y + axis[i].y * std::copysign(outside[i], local[i]),
+                                             n.z + axis[i].z * std::copysign(outside[i], local[i]) };
+            }
+            const float dist = Length(n);
+            outNormal = Scale(n, 1.0f / dist);
+            return dist - radius;
+        }
+        int best = 0;
+        for (int i = 1; i < 3; ++i) if (outside[i] > outside[best]) best = i;
+        for (int i = 0; i < 3; ++i) if (i != best && outside[best] - outside[i] < 1e-3f) outTie = true;
+        outNormal = Scale(axis[best], local[best] >= 0.0f ? 1.0f : -1.0f);
+        return outside[best] - radius;
+    }
+
+    // 線分 (カプセルの芯) が箱に入り込んでいる深さ
+    // 芯の差 (箱と線分のミンコフスキー差) の面の向きは、箱の3軸と「線分の向き × 箱の軸」の3本しかないので、
+    // その6本の分離軸で一番浅い重なりが、EPA の求める深さと一致する
+    float SegmentBoxPenetration(const XMFLOAT3& center, const XMFLOAT3& dir, float halfLen,
+        const XMFLOAT4X4& world, const XMFLOAT3& ext) {
+        const XMFLOAT3 axis[3] = {
+            { world.m[0][0], world.m[0][1], world.m[0][2] },
+            { world.m[1][0], world.m[1][1], world.m[1][2] },
+            { world.m[2][0], world.m[2][1], world.m[2][2] },
+        };
+        const XMFLOAT3 d = Sub(center, { world.m[3][0], world.m[3][1], world.m[3][2] });
+        XMFLOAT3 candidates[6];
+        for (int i = 0; i < 3; ++i) {
+            candidates[i] = axis[i];
+            candidates[i + 3] = { dir.y * axis[i].z - dir.z * axis[i].y,
+                                  dir.z * axis[i].x - dir.x * axis[i].z,
+                                  dir.x * axis[i].y - dir.y * axis[i].x };
+        }
+        float depth = FLT_MAX;
+        for (const XMFLOAT3& candidate : candidates) {
+            const float len = Length(candidate);
+            if (len < 1e-3f) continue;  // 線分が箱の軸とほぼ平行 (箱の面の軸と同じになる)
+            const XMFLOAT3 l = Scale(candidate, 1.0f / len);
+            const float boxReach = ext.x * std::fabs(Dot(l, axis[0])) + ext.y * std::fabs(Dot(l, axis[1])) +
+                ext.z * std::fabs(Dot(l, axis[2]));
+            const float segReach = halfLen * std::fabs(Dot(l, dir));
+            depth = std::min(depth, boxReach + segReach - std::fabs(Dot(l, d)));
+        }
+        return depth;
+    }
+
+    // -----------------------------------------------------------------
+    // 答えが分かる配置 (つぶれた単体を含む)
+    // -----------------------------------------------------------------
+    void TestAnalytic() {
+        const XMFLOAT3 up = { 0.0f, 1.0f, 0.0f };
+        const XMFLOAT3 zero = { 0.0f, 0.0f, 0.0f };
+        ConvexContact c;
+
+        // 球同士: 離れている / めり込み / ちょうど接する / 中心が一致 (GJK の最初の向きが決まらない)
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Sphere({ 3.0f, 0.0f, 0.0f }, 1.0f), ConvexShape::Sphere(zero, 0.5f), c));
+        TEST_CHECK_NEAR(c.distance, 1.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.x, 1.0f, 1e-5f);
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere({ 0.0f, 1.0f, 0.0f }, 1.0f), ConvexShape::Sphere(zero, 0.5f), c));
+        TEST_CHECK_NEAR(c.distance, -0.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.y, 1.0f, 1e-5f);
+        Collision::ConvexOverlap(ConvexShape::Sphere({ 0.0f, 0.0f, 1.5f }, 1.0f), ConvexShape::Sphere(zero, 0.5f), c);
+        TEST_CHECK_NEAR(c.distance, 0.0f, 1e-5f);
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere(zero, 1.0f), ConvexShape::Sphere(zero, 0.5f), c));
+        TEST_CHECK_NEAR(c.distance, -1.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.y, 1.0f, 1e-5f);
+        TEST_CHECK(c.epaIterations == 0);
+
+        // GJK の最近点: 球の中心と、箱の上で一番近い点
+        const XMFLOAT4X4 unit = MakeWorld(zero, zero);
+        const ConvexShape box = ConvexShape::Box(unit, { 1.0f, 1.0f, 1.0f });
+        float dist;
+        XMFLOAT3 pa, pb;
+        TEST_CHECK(Collision::GjkClosestPoints(ConvexShape::Sphere({ 3.0f, 2.0f, 0.5f }, 0.1f), box, dist, pa, pb));
+        TEST_CHECK_NEAR(dist, std::sqrt(5.0f), 1e-5f);
+        TEST_CHECK_NEAR(pa.x, 3.0f, 1e-5f);
+        TEST_CHECK_NEAR(pb.x, 1.0f, 1e-5f);
+        TEST_CHECK_NEAR(pb.y, 1.0f, 1e-5f);
+        TEST_CHECK_NEAR(pb.z, 0.5f, 1e-5f);
+
+        // 箱の面の上 / 辺の上 / 頂点の上にある球の中心 (芯の距離が 0 で EPA に入る)
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere({ 1.0f, 0.2f, -0.3f }, 0.25f), box, c));
+        TEST_CHECK_NEAR(c.distance, -0.25f, TOL);
+        TEST_CHECK_NEAR(c.normal.x, 1.0f, TOL);
+        TEST_CHECK(c.epaIterations < EPA_MAX_ITERATIONS);
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere({ 1.0f, 1.0f, 0.4f }, 0.25f), box, c));
+        TEST_CHECK_NEAR(c.distance, -0.25f, TOL);
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere({ -1.0f, 1.0f, -1.0f }, 0.25f), box, c));
+        TEST_CHECK_NEAR(c.distance, -0.25f, TOL);
+        // 箱の中心と一致 (6面が同じ深さ)
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere(zero, 0.25f), box, c));
+        TEST_CHECK_NEAR(c.distance, -1.25f, TOL);
+
+        // 箱同士の面と面がちょうど接する (サポート点が同じ面から何度も出て足踏みする)
+        const ConvexShape boxRight = ConvexShape::Box(MakeWorld({ 2.0f, 0.5f, 0.0f }, zero), { 1.0f, 1.0f, 1.0f });
+        Collision::ConvexOverlap(boxRight, box, c);
+        TEST_CHECK_NEAR(c.distance, 0.0f, TOL);
+        TEST_CHECK(c.gjkIterations < GJK_MAX_ITERATIONS);
+
+        // カプセル同士: 平行に並ぶ (最近点が1点に決まらない)
+        const ConvexShape capA = ConvexShape::Capsule(zero, up, 1.0f, 0.3f);
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Capsule({ 1.0f, 0.5f, 0.0f }, up, 1.0f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, 0.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.x, 1.0f, 1e-5f);
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Capsule({ 0.4f, -0.5f, 0.0f }, up, 1.0f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, -0.1f, 1e-5f);
+
+        // 同一直線上で離れている (芯の差が線分になる)
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Capsule({ 0.0f, 3.0f, 0.0f }, up, 1.0f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, 0.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.y, 1.0f, 1e-5f);
+        // 同一直線上で芯が重なる (芯の差が線分で体積がない)
+        // 一番浅いのは横に押し出す向きで、深さは半径の和。EPA は使わない
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Capsule({ 0.0f, 0.5f, 0.0f }, up, 1.0f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, -0.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.y, 0.0f, 1e-5f);
+        TEST_CHECK_NEAR(Length(c.normal), 1.0f, 1e-5f);
+        TEST_CHECK(c.epaIterations == 0);
+        // 平行で芯がずれずに重なる (同じく芯の差が線分) → 中心の差の横成分の向き
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Capsule({ 0.0f, 0.5f, 0.0f }, up, 0.2f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, -0.5f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.y, 0.0f, 1e-5f);
+
+        // 十字に交わる (芯の差が平たい平行四辺形) → 交わる面の法線の向きに半径の和
+        const XMFLOAT3 right = { 1.0f, 0.0f, 0.0f };
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Capsule({ 0.0f, 0.0f, 0.0f }, right, 2.0f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, -0.5f, 1e-5f);
+        TEST_CHECK_NEAR(std::fabs(c.normal.z), 1.0f, 1e-5f);
+        TEST_CHECK(c.epaIterations == 0);
+        // 球の中心がカプセルの芯の上
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere({ 0.0f, 0.7f, 0.0f }, 0.4f), capA, c));
+        TEST_CHECK_NEAR(c.distance, -0.7f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.y, 0.0f, 1e-5f);
+        // 十字で少し離れている (芯の差の面に原点が乗らない)
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Capsule({ 0.0f, 0.0f, 0.8f }, right, 2.0f, 0.2f), capA, c));
+        TEST_CHECK_NEAR(c.distance, 0.3f, 1e-5f);
+        TEST_CHECK_NEAR(c.normal.z, 1.0f, 1e-5f);
+
+        // 軸のそろったカプセルの芯が箱の中 → 芯の差も箱なので厳密に出る
+        // 深さ = 半径 + min(x: 1-0.2, y: 1+0.5-0.3, z: 1-0.1)
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Capsule({ 0.2f, 0.3f, 0.1f }, up, 0.5f, 0.25f), box, c));
+        TEST_CHECK_NEAR(c.distance, -(0.25f + 0.8f), TOL);
+        TEST_CHECK_NEAR(c.normal.x, 1.0f, TOL);
+        TEST_CHECK(c.epaIterations < EPA_MAX_ITERATIONS);
+
+        // 正八面体 (倍率 s) と球: 面の中心・辺の中点・頂点の向き
+        // (面までの距離 s/√3、辺まで s/√2、頂点まで s)
+        const float s = 2.0f;
+        const ConvexShape octa = ConvexShape::Hull(unit, { s, s, s }, OCTA_POINTS, 6);
+        const float k3 = 1.0f / std::sqrt(3.0f), k2 = 1.0f / std::sqrt(2.0f);
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Sphere(Scale({ k3, k3, k3 }, 3.0f), 0.5f), octa, c));
+        TEST_CHECK_NEAR(c.distance, 3.0f - s * k3 - 0.5f, 1e-4f);
+        TEST_CHECK_NEAR(c.normal.x, k3, 1e-4f);
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Sphere(Scale({ k2, -k2, 0.0f }, 3.0f), 0.5f), octa, c));
+        TEST_CHECK_NEAR(c.distance, 3.0f - s * k2 - 0.5f, 1e-4f);
+        TEST_CHECK(!Collision::ConvexOverlap(ConvexShape::Sphere({ 0.0f, 0.0f, -3.0f }, 0.5f), octa, c));
+        TEST_CHECK_NEAR(c.distance, 3.0f - s - 0.5f, 1e-4f);
+        // 面の内側 (中心から 0.3) → 深さ = 面までの距離 + 半径
+        TEST_CHECK(Collision::ConvexOverlap(ConvexShape::Sphere(Scale({ -k3, k3, -k3 }, 0.3f), 0.5f), octa, c));
+        TEST_CHECK_NEAR(c.distance, -(s * k3 - 0.3f + 0.5f), TOL);
+        TEST_CHECK_NEAR(c.normal.y, k3, TOL);
+        TEST_CHECK(c.epaIterations < EPA_MAX_ITERATIONS);
+    }
+
+    // -----------------------------------------------------------------
+    // 球 vs 箱 (回転した箱、中心が箱の中の組も含む)
+    // -----------------------------------------------------------------
+    void TestSphereBox(Random& rng) {
+        IterationStats stats;
+        float maxError = 0.0f;
+        for (int i = 0; i < 50000; ++i) {
+            const XMFLOAT3 ext = { rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f) };
+            const XMFLOAT4X4 world = MakeWorld({ rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f) },
+                RandomRotation(rng));
+            const float radius = rng.Float(0.1f, 1.5f);
+            const float reach = std::max({ ext.x, ext.y, ext.z }) + radius;
+            const XMFLOAT3 center = { world.m[3][0] + rng.Float(-reach, reach),
+                                      world.m[3][1] + rng.Float(-reach, reach),
+                                      world.m[3][2] + rng.Float(-reach, reach) };
+
+            XMFLOAT3 normal;
+            bool tie;
+            const float answer = SphereBoxAnswer(center, radius, world, ext, normal, tie);
+
+            ConvexContact c;
+            const bool hit = Collision::ConvexOverlap(ConvexShape::Sphere(center, radius), ConvexShape::Box(world, ext), c);
+            stats.Add(c);
+            TEST_CHECK(c.gjkIterations < GJK_MAX_ITERATIONS);
+            TEST_CHECK(c.epaIterations < EPA_MAX_ITERATIONS);
+            TEST_CHECK_NEAR(c.distance, answer, TOL);
+            maxError = std::max(maxError, std::fabs(c.distance - answer));
+            if (std::fabs(answer) > TOL) TEST_CHECK(hit == (answer < 0.0f));
+            // 中心が箱の表面ぎりぎり (辺・頂点では向きが決まらない) と、面が同じ深さの時は向きを見ない
+            if (!tie && std::fabs(answer + radius) > 1e-3f) TEST_CHECK(Dot(c.normal, normal) > 0.999f);
+        }
+        stats.Print("sphere-box", maxError);
+    }
+
+    // -----------------------------------------------------------------
+    // 箱 vs 箱 (軸のそろった組を作り、2つまとめて同じだけ回す)
+    // 軸がそろっていれば芯の差も箱なので、離れていれば各軸の隙間の長さ、
+    // 重なっていれば一番浅い軸の重なりが答え。まとめて回しても答えは変わらない
+    // -----------------------------------------------------------------
+    void TestBoxBox(Random& rng) {
+        IterationStats stats;
+        float maxError = 0.0f;
+        for (int i = 0; i < 50000; ++i) {
+            const XMFLOAT3 extA = { rng.Float(0.2f, 2.0f), rng.Float(0.2f, 2.0f), rng.Float(0.2f, 2.0f) };
+            const XMFLOAT3 extB = { rng.Float(0.2f, 2.0f), rng.Float(0.2f, 2.0f), rng.Float(0.2f, 2.0f) };
+            const XMFLOAT3 delta = {
+                rng.Float(-1.2f, 1.2f) * (extA.x + extB.x),
+                rng.Float(-1.2f, 1.2f) * (extA.y + extB.y),
+                rng.Float(-1.2f, 1.2f) * (extA.z + extB.z),
+            };
+            const float gap[3] = {
+                std::fabs(delta.x) - (extA.x + extB.x),
+                std::fabs(delta.y) - (extA.y + extB.y),
+                std::fabs(delta.z) - (extA.z + extB.z),
+            };
+            const float sign[3] = { delta.x >= 0.0f ? 1.0f : -1.0f, delta.y >= 0.0f ? 1.0f : -1.0f, delta.z >= 0.0f ? 1.0f : -1.0f };
+
+            float answer;
+            XMFLOAT3 normal = { 0.0f, 0.0f, 0.0f };
+            bool tie = false;
+            if (gap[0] > 0.0f || gap[1] > 0.0f || gap[2] > 0.0f) {
+                const XMFLOAT3 v = { std::max(gap[0], 0.0f) * sign[0], std::max(gap[1], 0.0f) * sign[1], std::max(gap[2], 0.0f) * sign[2] };
+                answer = Length(v);
+                normal = Scale(v, 1.0f / answer);
+            }
+            else {
+                int best = 0;
+                for (int k = 1; k < 3; ++k) if (gap[k] > gap[best]) best = k;
+                for (int k = 0; k < 3; ++k) if (k != best && gap[best] - gap[k] < 1e-3f) tie = true;
+                answer = gap[best];
+                (&normal.x)[best] = sign[best];
+            }
+
+            // 2つまとめて回す (B の中心を原点の近くに置いて、A は delta だけずらす)
+            const XMFLOAT3 rot = RandomRotation(rng);
+            const XMFLOAT3 centerB = { rng.Float(-3.0f, 3.0f), rng.Float(-3.0f, 3.0f), rng.Float(-3.0f, 3.0f) };
+            const XMFLOAT3 rd = Rotate(delta, rot);
+            const XMFLOAT3 centerA = { centerB.x + rd.x, centerB.y + rd.y, centerB.z + rd.z };
+            normal = Rotate(normal, rot);
+
+            ConvexContact c;
+            const bool hit = Collision::ConvexOverlap(
+                ConvexShape::Box(MakeWorld(centerA, rot), extA), ConvexShape::Box(MakeWorld(centerB, rot), extB), c);
+            stats.Add(c);
+            TEST_CHECK(c.gjkIterations < GJK_MAX_ITERATIONS);
+            TEST_CHECK(c.epaIterations < EPA_MAX_ITERATIONS);
+            TEST_CHECK_NEAR(c.distance, answer, TOL);
+            maxError = std::max(maxError, std::fabs(c.distance - answer));
+            if (std::fabs(answer) > TOL) {
+                TEST_CHECK(hit == (answer < 0.0f));
+                if (!tie) TEST_CHECK(Dot(c.normal, normal) > 0.999f);
+            }
+        }
+        stats.Print("box-box", maxError);
+    }
+
+    // -----------------------------------------------------------------
+    // カプセル vs 箱
+    // 芯が箱の外なら CapsuleOBBContact の隙間と一致する。芯が箱に入っていれば
+    // 分離軸で求めた深さと比べる (CapsuleOBBContact は一番深い点から面の向きに
+    // 押すだけなので、この時は一番浅い向きとは限らない)
+    // -----------------------------------------------------------------
+    void TestCapsuleBox(Random& rng) {
+        IterationStats stats;
+        float maxError = 0.0f;
+        int deep = 0;
+        for (int i = 0; i < 50000; ++i) {
+            const XMFLOAT3 ext = { rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f) };
+            const XMFLOAT3 rot = RandomRotation(rng);
+            const XMFLOAT3 boxCenter = { rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f) };
+            const XMFLOAT4X4 world = MakeWorld(boxCenter, rot);
+            XMFLOAT4X4 invWorld;
+            XMVECTOR det;
+            XMStoreFloat4x4(&invWorld, XMMatrixInverse(&det, XMLoadFloat4x4(&world)));
+
+            const XMFLOAT3 axis = RandomUnit(rng);
+            const float radius = rng.Float(0.1f, 1.0f);
+            const float halfLen = rng.Float(0.0f, 1.5f);
+            const float reach = std::max({ ext.x, ext.y, ext.z }) + radius + halfLen * 0.5f;
+            const XMFLOAT3 center = { boxCenter.x + rng.Float(-reach, reach),
+                                      boxCenter.y + rng.Float(-reach, reach),
+                                      boxCenter.z + rng.Float(-reach, reach) };
+
+            XMFLOAT3 push;
+            float gap;
+            Collision::CapsuleOBBContact(Sub(center, Scale(axis, halfLen)), { center.x + axis.x * halfLen,
+                center.y + axis.y * halfLen, center.z + axis.z * halfLen }, radius, world, invWorld, ext, push, gap);
+
+            ConvexContact c;
+            Collision::ConvexOverlap(ConvexShape::Capsule(center, axis, halfLen, radius), ConvexShape::Box(world, ext), c);
+            stats.Add(c);
+            TEST_CHECK(c.gjkIterations < GJK_MAX_ITERATIONS);
+            TEST_CHECK(c.epaIterations < EPA_MAX_ITERATIONS);
+
+            if (gap > -radius + 1e-4f) {
+                TEST_CHECK_NEAR(c.distance, gap, TOL);
+                maxError = std::max(maxError, std::fabs(c.distance - gap));
+                // 芯がほぼ触れている (芯の距離 0.01 未満) と最近点の差から作る向きが揺れるので見ない
+                const float depth = Length(push);
+                if (depth > 1e-3f && gap + radius > 1e-2f) TEST_CHECK(Dot(c.normal, push) / depth > 0.999f);
+            }
+            else {
+                ++deep;
+                const float answer = -(SegmentBoxPenetration(center, axis, halfLen, world, ext) + radius);
+                TEST_CHECK_NEAR(c.distance, answer, TOL);
+                maxError = std::max(maxError, std::fabs(c.distance - answer));
+            }
+        }
+        stats.Print("capsule-box", maxError);
+        std::printf("  %-16s core in box %d (checked against separating axes)\n", "", deep);
+    }
+
+    // -----------------------------------------------------------------
+    // カプセル同士 (芯の線分同士の距離と比べる)
+    // 芯が交わる組は、芯の差に体積がないので深さは半径の和になる
+    // -----------------------------------------------------------------
+    void TestCapsuleCapsule(Random& rng) {
+        IterationStats stats;
+        float maxError = 0.0f;
+        int crossing = 0;
+        for (int i = 0; i < 50000; ++i) {
+            const XMFLOAT3 axisA = RandomUnit(rng), axisB = RandomUnit(rng);
+            // 長さ 0.003 未満の線分は Legacy 側が始点1点として扱うので、0 (球) か 0.01 以上にする
+            const float halfA = (rng.UInt(4) == 0) ? 0.0f : rng.Float(0.01f, 1.5f);
+            const float halfB = (rng.UInt(4) == 0) ? 0.0f : rng.Float(0.01f, 1.5f);
+            const float radA = rng.Float(0.1f, 0.8f), radB = rng.Float(0.1f, 0.8f);
+            const XMFLOAT3 centerB = { rng.Float(-3.0f, 3.0f), rng.Float(-3.0f, 3.0f), rng.Float(-3.0f, 3.0f) };
+            const float reach = halfA + halfB + radA + radB;
+            const XMFLOAT3 centerA = { centerB.x + rng.Float(-reach, reach) * 0.6f,
+                                       centerB.y + rng.Float(-reach, reach) * 0.6f,
+                                       centerB.z + rng.Float(-reach, reach) * 0.6f };
+
+            XMVECTOR onA, onB;
+            const float coreDist = std::sqrt(Legacy::SegmentToSegmentDistSq(
+                XMLoadFloat3(&centerA) - XMLoadFloat3(&axisA) * halfA, XMLoadFloat3(&centerA) + XMLoadFloat3(&axisA) * halfA,
+                XMLoadFloat3(&centerB) - XMLoadFloat3(&axisB) * halfB, XMLoadFloat3(&centerB) + XMLoadFloat3(&axisB) * halfB,
+                onA, onB));
+            const float answer = coreDist - radA - radB;
+
+            ConvexContact c;
+            Collision::ConvexOverlap(ConvexShape::Capsule(centerA, axisA, halfA, radA),
+                ConvexShape::Capsule(centerB, axisB, halfB, radB), c);
+            stats.Add(c);
+            TEST_CHECK(c.gjkIterations < GJK_MAX_ITERATIONS);
+
+            if (coreDist > 1e-4f) {
+                TEST_CHECK_NEAR(c.distance, answer, TOL);
+                maxError = std::max(maxError, std::fabs(c.distance - answer));
+            }
+            else {
+                ++crossing;
+                TEST_CHECK_NEAR(c.distance, answer, TOL);
+                maxError = std::max(maxError, std::fabs(c.distance - answer));
+            }
+        }
+        stats.Print("capsule-capsule", maxError);
+        std::printf("  %-16s cores crossing %d\n", "", crossing);
+    }
+
+    // -----------------------------------------------------------------
+    // 凸包 (立方体の8頂点) vs 球・カプセル: 同じ大きさの箱と同じ答えになる
+    // -----------------------------------------------------------------
+    void TestHull(Random& rng) {
+        IterationStats stats;
+        float maxError = 0.0f;
+        for (int i = 0; i < 50000; ++i) {
+            const XMFLOAT3 ext = { rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f) };
+            const XMFLOAT4X4 world = MakeWorld({ rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f) },
+                RandomRotation(rng));
+            const ConvexShape hull = ConvexShape::Hull(world, { ext.x * 2.0f, ext.y * 2.0f, ext.z * 2.0f }, CUBE_POINTS, 8);
+            const ConvexShape box = ConvexShape::Box(world, ext);
+
+            const float radius = rng.Float(0.1f, 1.0f);
+            const float halfLen = (i & 1) ? rng.Float(0.0f, 1.5f) : 0.0f;
+            const float reach = std::max({ ext.x, ext.y, ext.z }) + radius + halfLen * 0.5f;
+            const XMFLOAT3 center = { world.m[3][0] + rng.Float(-reach, reach),
+                                      world.m[3][1] + rng.Float(-reach, reach),
+                                      world.m[3][2] + rng.Float(-reach, reach) };
+            const ConvexShape shape = (halfLen > 0.0f)
+                ? ConvexShape::Capsule(center, RandomUnit(rng), halfLen, radius)
+                : ConvexShape::Sphere(center, radius);
+
+            ConvexContact withHull, withBox;
+            Collision::ConvexOverlap(shape, hull, withHull);
+            Collision::ConvexOverlap(shape, box, withBox);
+            stats.Add(withHull);
+            TEST_CHECK(withHull.gjkIterations < GJK_MAX_ITERATIONS);
+            TEST_CHECK(withHull.epaIterations < EPA_MAX_ITERATIONS);
+            TEST_CHECK_NEAR(withHull.distance, withBox.distance, TOL);
+            maxError = std::max(maxError, std::fabs(withHull.distance - withBox.distance));
+            if (withBox.distance > -radius + TOL) TEST_CHECK(Dot(withHull.normal, withBox.normal) > 0.999f);
+        }
+        stats.Print("hull-sphere/cap", maxError);
+    }
+
+    // -----------------------------------------------------------------
+    // 1組あたりの手間 (同じ組を OBB 専用の判定と GJK/EPA で)
+    // -----------------------------------------------------------------
+    void Bench(Random& rng) {
+        constexpr int PAIRS = 20000;
+        constexpr int REPEAT = 10;
+
+        struct Pair {
+            XMFLOAT4X4 world, invWorld;
+            XMFLOAT3 ext;
+            XMFLOAT3 center, axis;
+            float halfLen, radius;
+        };
+        std::vector<Pair> pairs(PAIRS);
+        Collision::OBBSoA boxes;
+        boxes.Reserve(PAIRS);
+        for (int i = 0; i < PAIRS; ++i) {
+            Pair& p = pairs[i];
+            p.ext = { rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f), rng.Float(0.2f, 3.0f) };
+            const XMFLOAT3 boxCenter = { rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f), rng.Float(-5.0f, 5.0f) };
+            p.world = MakeWorld(boxCenter, RandomRotation(rng));
+            XMVECTOR det;
+            XMStoreFloat4x4(&p.invWorld, XMMatrixInverse(&det, XMLoadFloat4x4(&p.world)));
+            boxes.Add((uint32_t)i, boxCenter, p.ext, p.world);
+            p.axis = { 0.0f, 1.0f, 0.0f };
+            p.radius = rng.Float(0.2f, 1.0f);
+            p.halfLen = rng.Float(0.0f, 1.5f);
+            const float reach = std::max({ p.ext.x, p.ext.y, p.ext.z }) + p.radius + p.halfLen * 0.5f;
+            p.center = { boxCenter.x + rng.Float(-reach, reach), boxCenter.y + rng.Float(-reach, reach),
+                         boxCenter.z + rng.Float(-reach, reach) };
+        }
+        const double count = (double)PAIRS * REPEAT;
+        float acc = 0.0f;
+        ConvexContact c;
+
+        Test::Timer timer;
+        for (int r = 0; r < REPEAT; ++r) {
+            for (int i = 0; i < PAIRS; ++i) {
+                float pen;
+                if (Collision::SphereOverlapOBB(boxes, i, pairs[i].center, pairs[i].radius, pen)) acc += pen;
+            }
+        }
+        Test::PrintBench("SphereOverlapOBB", timer.ElapsedNs(), count, "pair");
+
+        timer.Reset();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const Pair& p : pairs) {
+                if (Collision::ConvexOverlap(ConvexShape::Sphere(p.center, p.radius), ConvexShape::Box(p.world, p.ext), c)) acc += c.distance;
+            }
+        }
+        Test::PrintBench("ConvexOverlap sphere-box", timer.ElapsedNs(), count, "pair");
+
+        timer.Reset();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const Pair& p : pairs) {
+                XMFLOAT3 push;
+                float gap;
+                const XMFLOAT3 s = { p.center.x, p.center.y - p.halfLen, p.center.z };
+                const XMFLOAT3 e = { p.center.x, p.center.y + p.halfLen, p.center.z };
+                if (Collision::CapsuleOBBContact(s, e, p.radius, p.world, p.invWorld, p.ext, push, gap)) acc += push.y;
+            }
+        }
+        Test::PrintBench("CapsuleOBBContact", timer.ElapsedNs(), count, "pair");
+
+        timer.Reset();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const Pair& p : pairs) {
+                if (Collision::ConvexOverlap(ConvexShape::Capsule(p.center, p.axis, p.halfLen, p.radius),
+                    ConvexShape::Box(p.world, p.ext), c)) acc += c.distance;
+            }
+        }
+        Test::PrintBench("ConvexOverlap capsule-box", timer.ElapsedNs(), count, "pair");
+
+        timer.Reset();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const Pair& p : pairs) {
+                const ConvexShape hull = ConvexShape::Hull(p.world, { p.ext.x * 2.0f, p.ext.y * 2.0f, p.ext.z * 2.0f }, CUBE_POINTS, 8);
+                if (Collision::ConvexOverlap(ConvexShape::Capsule(p.center, p.axis, p.halfLen, p.radius), hull, c)) acc += c.distance;
+            }
+        }
+        Test::PrintBench("ConvexOverlap capsule-hull (8 points)", timer.ElapsedNs(), count, "pair");
+
+        timer.Reset();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (int i = 0; i < PAIRS; ++i) {
+                const Pair& p = pairs[i];
+                const Pair& q = pairs[(i + 1) % PAIRS];
+                // 隣の組の箱を、この組の球の位置へ持ってくる
+                XMFLOAT4X4 w = q.world;
+                w.m[3][0] = p.center.x; w.m[3][1] = p.center.y; w.m[3][2] = p.center.z;
+                if (Collision::ConvexOverlap(ConvexShape::Box(w, q.ext), ConvexShape::Box(p.world, p.ext), c)) acc += c.distance;
+            }
+        }
+        Test::PrintBench("ConvexOverlap box-box", timer.ElapsedNs(), count, "pair");
+        Test::sink = Test::sink + acc;
+    }
+}
+
+void RunConvexCollisionTests() {
+    TestAnalytic();
+
+    Random rng(39, 0);
+    TestSphereBox(rng);
+    TestBoxBox(rng);
+    TestCapsuleBox(rng);
+    TestCapsuleCapsule(rng);
+    TestHull(rng);
+    Bench(rng);
+}
@@ -0,0 +1,234 @@
+/*===================================================================
+// ファイル: LegacyCollision.cpp
+// 概要: 置き換える前の当たり判定（実装部）
+//       計算は元のコードのまま (押し出し以外のダメージ・速度の処理は除いた)
+=====================================================================*/
+#include "LegacyCollision.h"
+#include <DirectXCollision.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace Legacy {
+
+    // -----------------------------------------------------------------
+    // 線分(p1-q1) と 線分(p2-q2) の最短距離の2乗
+    // -----------------------------------------------------------------
+    float SegmentToSegmentDistSq(
+        XMVECTOR p1, XMVECTOR q1,
+        XMVECTOR p2, XMVECTOR q2,
+        XMVECTOR& outC1, XMVECTOR& outC2)
+    {
+        XMVECTOR d1 = q1 - p1;
+        XMVECTOR d2 = q2 - p2;
+        XMVECTOR r = p1 - p2;
+        float a = XMVectorGetX(XMVector3Dot(d1, d1));
+        float e = XMVectorGetX(XMVector3Dot(d2, d2));
+        float f = XMVectorGetX(XMVector3Dot(d2, r));
+
+        if (a <= 0.00001f && e <= 0.00001f) {
+            outC1 = p1; outC2 = p2;
+            return XMVectorGetX(XMVector3LengthSq(p1 - p2));
+        }
+        if (a <= 0.00001f) {
+            outC1 = p1;
+            float t = std::max(0.0f, std::min(1.0f, f / e));
+            outC2 = p2 + d2 * t;
+            return XMVectorGetX(XMVector3LengthSq(outC1 - outC2));
+        }
+        if (e <= 0.00001f) {
+            outC2 = p2;
+            float t = std::max(0.0f, std::min(1.0f, -XMVectorGetX(XMVector3Dot(d1, r)) / a));
+            outC1 = p1 + d1 * t;
+            return XMVectorGetX(XMVector3LengthSq(outC1 - outC2));
+        }
+
+        float c = XMVectorGetX(XMVector3Dot(d1, r));
+        float b = XMVectorGetX(XMVector3Dot(d1, d2));
+        float denom = a * e - b * b;
+
+        float s, t;
+        if (denom != 0.0f) {
+            s = std::max(0.0f, std::min(1.0f, (b * f - c * e) / denom));
+        }
+        else {
+            s = 0.0f;
+        }
+
+        t = (b * s + f) / e;
+        if (t < 0.0f) {
+            t = 0.0f;
+            s = std::max(0.0f, std::min(1.0f, -c / a));
+        }
+        else if (t > 1.0f) {
+            t = 1.0f;
+            s = std::max(0.0f, std::min(1.0f, (b - c) / a));
+        }
+
+        outC1 = p1 + d1 * s;
+        outC2 = p2 + d2 * t;
+        return XMVectorGetX(XMVector3LengthSq(outC1 - outC2));
+    }
+
+    // -----------------------------------------------------------------
+    // カプセル vs OBB (サンプリング)
+    // -----------------------------------------------------------------
+    bool CapsuleOBBSampled(const XMFLOAT3& segStart, const XMFLOAT3& segEnd, float radius,
+        const XMFLOAT4X4& boxWorldF, const XMFLOAT3& extents, XMFLOAT3& outPush)
+    {
+        XMMATRIX boxWorld = XMLoadFloat4x4(&boxWorldF);
+        XMVECTOR det;
+        XMMATRIX boxInvWorld = XMMatrixInverse(&det, boxWorld);
+
+        XMVECTOR pStartW = XMLoadFloat3(&segStart);
+        XMVECTOR pEndW = XMLoadFloat3(&segEnd);
+
+        float maxPenetration = -1.0f;
+        XMVECTOR finalPushW = XMVectorZero();
+        bool isHit = false;
+
+        // --- [判定A] カプセル線分 vs 箱 (ローカル空間) ---
+        XMVECTOR pStartL = XMVector3TransformCoord(pStartW, boxInvWorld);
+        XMVECTOR pEndL = XMVector3TransformCoord(pEndW, boxInvWorld);
+        float hx = extents.x;
+        float hy = extents.y;
+        float hz = extents.z;
+
+        XMVECTOR segmentVec = pEndL - pStartL;
+        float segLen = XMVectorGetX(XMVector3Length(segmentVec));
+        // 判定密度
+        int steps = static_cast<int>(segLen / (radius * 0.05f)) + 2;
+
+        for (int i = 0; i < steps; ++i) {
+            float t = (float)i / (steps - 1);
+            if (steps <= 1) t = 0.5f;
+            XMVECTOR pointL = pStartL + segmentVec * t;
+            XMFLOAT3 p; XMStoreFloat3(&p, pointL);
+
+            float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
+            float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
+            float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
+
+            float dx = p.x - cx; float dy = p.y - cy; float dz = p.z - cz;
+            float distSq = dx * dx + dy * dy + dz * dz;
+
+            if (distSq < (radius * radius) + 0.0001f) {
+                float dist = std::sqrt(distSq);
+                float pen = radius - dist;
+                if (pen <= 0.0f) pen = 0.001f;
+                XMVECTOR pushL;
+                if (dist > 0.00001f) {
+                    pushL = XMVectorSet(dx / dist, dy / dist, dz / dist, 0);
+                }
+                else {
+                    float dX = hx - std::abs(p.x); float dY = hy - std::abs(p.y); float dZ = hz - std::abs(p.z);
+                    if (dX < dY && dX < dZ) pushL = XMVectorSet((p.x > 0 ? 1.0f : -1.0f), 0, 0, 0);
+                    else if (dY < dZ)       pushL = XMVectorSet(0, (p.y > 0 ? 1.0f : -1.0f), 0, 0);
+                    else                    pushL = XMVectorSet(0, 0, (p.z > 0 ? 1.0f : -1.0f), 0);
+                    pen = radius + std::min({ dX, dY, dZ });
+                }
+                if (pen > maxPenetration) {
+                    maxPenetration = pen;
+                    finalPushW = XMVector3TransformNormal(pushL, boxWorld) * pen;
+                    isHit = true;
+                }
+            }
+        }
+
+        // --- [判定B & C] 箱の12本の辺 vs カプセルの芯 (ワールド空間) ---
+        XMFLOAT3 c[8] = {
+            {-hx,-hy,-hz}, { hx,-hy,-hz}, {-hx, hy,-hz}, { hx, hy,-hz},
+            {-hx,-hy, hz}, { hx,-hy, hz}, {-hx, hy, hz}, { hx, hy, hz}
+        };
+        XMVECTOR v[8];
+        for (int i = 0; i < 8; ++i) v[i] = XMVector3TransformCoord(XMLoadFloat3(&c[i]), boxWorld);
+
+        int edges[12][2] = {
+            {0,1}, {2,3}, {4,5}, {6,7}, // X
+            {0,2}, {1,3}, {4,6}, {5,7}, // Y
+            {0,4}, {1,5}, {2,6}, {3,7}  // Z
+        };
+
+        for (int i = 0; i < 12; ++i) {
+            XMVECTOR edgeP1 = v[edges[i][0]];
+            XMVECTOR edgeP2 = v[edges[i][1]];
+
+            XMVECTOR ptOnCapsule, ptOnBoxEdge;
+            float distSq = SegmentToSegmentDistSq(pStartW, pEndW, edgeP1, edgeP2, ptOnCapsule, ptOnBoxEdge);
+
+            if (distSq < radius * radius) {
+                float dist = std::sqrt(distSq);
+                float pen = radius - dist;
+
+                XMVECTOR pushDirW;
+                if (dist > 0.00001f) {
+                    pushDirW = (ptOnCapsule - ptOnBoxEdge) / dist;
+                }
+                else {
+                    XMVECTOR center = XMVector3TransformCoord(XMVectorZero(), boxWorld);
+                    pushDirW = XMVector3Normalize(ptOnCapsule - center);
+                }
+
+                if (pen > maxPenetration) {
+                    maxPenetration = pen;
+                    finalPushW = pushDirW * pen;
+                    isHit = true;
+                }
+            }
+        }
+
+        XMStoreFloat3(&outPush, finalPushW);
+        return isHit;
+    }
+
+    // -----------------------------------------------------------------
+    // レイ vs OBB (BoundingOrientedBox)
+    // -----------------------------------------------------------------
+    bool RaycastBoundingOBB(const XMFLOAT3& center, const XMFLOAT3& extents, const XMFLOAT3& rotation,
+        const XMFLOAT3& origin, const XMFLOAT3& direction, float& outDist)
+    {
+        BoundingOrientedBox obb;
+        obb.Center = center;
+        obb.Extents = extents;
+        // 回転 (Quaternion)
+        XMVECTOR Q = XMQuaternionRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
+        XMStoreFloat4(&obb.Orientation, Q);
+
+        float dist = 0.0f;
+        if (!obb.Intersects(XMLoadFloat3(&origin), XMLoadFloat3(&direction), dist)) return false;
+        outDist = dist;
+        return true;
+    }
+
+    // -----------------------------------------------------------------
+    // 球 vs OBB (逆行列)
+    // -----------------------------------------------------------------
+    bool SphereOverlapInverse(const XMFLOAT3& center, const XMFLOAT3& extents, const XMFLOAT3& rotation,
+        const XMFLOAT3& sphereCenter, float radius, float& outPenetration)
+    {
+        // GetOBB と同じ行列
+        XMMATRIX R = XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
+        XMMATRIX T = XMMatrixTranslation(center.x, center.y, center.z);
+        XMMATRIX targetWorld = R * T;
+        XMVECTOR det;
+        XMMATRIX targetInvWorld = XMMatrixInverse(&det, targetWorld);
+
+        XMVECTOR centerL = XMVector3TransformCoord(XMLoadFloat3(&sphereCenter), targetInvWorld);
+        XMFLOAT3 p; XMStoreFloat3(&p, centerL);
+
+        float hx = extents.x;
+        float hy = extents.y;
+        float hz = extents.z;
+
+        float cx = std::max<float>(-hx, std::min<float>(p.x, hx));
+        float cy = std::max<float>(-hy, std::min<float>(p.y, hy));
+        float cz = std::max<float>(-hz, std::min<float>(p.z, hz));
+
+        float dx = p.x - cx; float dy = p.y - cy; float dz = p.z - cz;
+        float distSq = dx * dx + dy * dy + dz * dz;
+
+        outPenetration = radius - std::sqrt(distSq);
+        return distSq < radius * radius;
+    }
+}
@@ -0,0 +1,365 @@
+/*===================================================================
+// ファイル: PhysicsParallelTest.cpp
+// 概要: 物理の並列ナローフェーズ (押し合いの FindContact・弾の掃引) のテスト
+//       1. メインスレッドだけで回した時と、ワーカー N 本で回した時の
+//          イベント列 (ダメージ・ノックバック・消滅・エフェクト・トリガー) が1つ残らず同じか
+//          (並列で見つけた接触は順番を決めてから適用するので、スレッド数で結果が変わってはいけない)
+//       2. 弾1000発・敵300体でのスレッド数ごとの1ステップの時間
+//       敵・弾の補充・攻撃球の出し入れ・パーティクルの片付けは、ゲームでは他の System の
+//       仕事なのでここで代わりにやる。Game は作らない (TestGameStubs.cpp)
+=====================================================================*/
+#include "TestCommon.h"
+#include "App/Main.h"
+#include "ECS/World.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "ECS/Components/TransformComponent.h"
+#include "ECS/Components/ColliderComponent.h"
+#include "ECS/Components/EnemyComponent.h"
+#include "ECS/Components/PlayerComponent.h"
+#include "ECS/Components/StatusComponent.h"
+#include "ECS/Components/PhysicsComponent.h"
+#include "ECS/Components/BulletComponent.h"
+#include "ECS/Components/ParticleComponent.h"
+#include "ECS/Components/AttackSphereComponent.h"
+#include "Engine/JobSystem.h"
+#include "Engine/Random.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+
+using namespace DirectX;
+
+namespace {
+
+    constexpr int ENEMY_COUNT = 300;
+    constexpr int BULLET_COUNT = 1000;
+    constexpr int SPHERES_PER_STEP = 3;     // 毎ステップ出して消す攻撃球 (トリガーの経路を通す)
+    constexpr int STEPS = 180;
+    constexpr float DT = 1.0f / 60.0f;
+    constexpr float ARENA = 50.0f;          // 敵・弾を置く範囲 (±)
+    constexpr float BULLET_RANGE = 70.0f;   // これより外に出た弾は消して補充する
+
+    // 物理の1ステップで起きたこと
+    enum class EventKind : uint8_t {
+        Damage,     // id の HP が value になった
+        Knockback,  // id が vec の速度で飛ばされた
+        Destroyed,  // id が消えた (value: 0=弾 1=敵)
+        Effect,     // id のパーティクルが vec に出た
+        Trigger,    // id (攻撃球) と other の重なり (value: TriggerPhase)
+        Count
+    };
+    const char* const EVENT_NAMES[] = { "Damage", "Knockback", "Destroyed", "Effect", "Trigger" };
+
+    struct PhysicsEvent {
+        int step;
+        EventKind kind;
+        EntityID id;
+        EntityID other;
+        int value;
+        XMFLOAT3 vec;
+    };
+
+    // 浮動小数もビットまで同じか見る (計算の順番が変わると最後の桁がずれるので)
+    bool SameEvent(const PhysicsEvent& a, const PhysicsEvent& b) {
+        return a.step == b.step && a.kind == b.kind && a.id == b.id && a.other == b.other &&
+            a.value == b.value && std::memcmp(&a.vec, &b.vec, sizeof(XMFLOAT3)) == 0;
+    }
+
+    // 敵・弾・壁のある1場面。コンストラクタの引数以外は同じ乱数で作るので、何度作っても同じになる
+    class PhysicsScene {
+    public:
+        // jobs: nullptr ならメインスレッドだけで回す
+        explicit PhysicsScene(JobSystem* jobs) : rng(34, 0) {
+            world.SetRandomSeed(34);
+            registry = world.GetRegistry();
+            physics = world.AddFixedSystem<PhysicsSystem>();
+            physics->Init(&world);
+            physics->SetJobSystem(jobs);
+
+            // 床と外壁
+            AddBox({ 0.0f, -0.5f, 0.0f }, { 200.0f, 1.0f, 200.0f });
+            AddBox({ 0.0f, 5.0f, 60.0f }, { 120.0f, 10.0f, 1.0f });
+            AddBox({ 0.0f, 5.0f, -60.0f }, { 120.0f, 10.0f, 1.0f });
+            AddBox({ 60.0f, 5.0f, 0.0f }, { 1.0f, 10.0f, 120.0f });
+            AddBox({ -60.0f, 5.0f, 0.0f }, { 1.0f, 10.0f, 120.0f });
+            // 弾が当たって消える障害物
+            for (int i = 0; i < 40; ++i) {
+                AddBox({ rng.Float(-ARENA, ARENA), 1.0f, rng.Float(-ARENA, ARENA) }, { 2.0f, 2.0f, 2.0f });
+            }
+
+            // 攻撃球の持ち主 (攻撃球は持ち主がプレイヤーの時だけ敵に当たる)
+            playerID = world.CreateEntity().Build();
+            world.AddComponent<TransformComponent>(playerID, TransformComponent{ .position = { 0.0f, 100.0f, 0.0f } });
+            world.AddComponent<PlayerComponent>(playerID);
+            world.AddComponent<StatusComponent>(playerID, StatusComponent{ .hp = 100, .maxHp = 100 });
+
+            for (int i = 0; i < ENEMY_COUNT; ++i) {
+                EntityID id = world.CreateEntity().Build();
+                world.AddComponent<TransformComponent>(id, TransformComponent{ .position = { rng.Float(-ARENA, ARENA), 0.5f, rng.Float(-ARENA, ARENA) } });
+                world.AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Enemy });
+                world.AddComponent<EnemyComponent>(id);
+                world.AddComponent<StatusComponent>(id, StatusComponent{ .hp = 400, .maxHp = 400 });
+                world.AddComponent<PhysicsComponent>(id);
+            }
+        }
+
+        // 1ステップ進める。events があれば起きたことを ID の昇順で足す
+        // 戻り値は物理の Update だけの時間 (ns)
+        double Step(std::vector<PhysicsEvent>* events) {
+            Prepare();
+            Snapshot();
+
+            Test::Timer timer;
+            physics->Update(DT);
+            const double ns = timer.ElapsedNs();
+
+            if (events) Collect(*events);
+            ++step;
+            return ns;
+        }
+
+        // 敵と弾の状態 (位置・速度・HP) をまとめた値
+        uint64_t StateHash() {
+            uint64_t h = 1469598103934665603ull;
+            auto mix = [&](const void* p, size_t n) {
+                const unsigned char* b = (const unsigned char*)p;
+                for (size_t i = 0; i < n; ++i) { h ^= b[i]; h *= 1099511628211ull; }
+            };
+            for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+                const bool enemy = registry->HasComponent<EnemyComponent>(id);
+                const bool bullet = registry->HasComponent<BulletComponent>(id);
+                if (!enemy && !bullet) continue;
+                mix(&id, sizeof(id));
+                mix(&registry->GetComponent<TransformComponent>(id).position, sizeof(XMFLOAT3));
+                mix(&registry->GetComponent<PhysicsComponent>(id).velocity, sizeof(XMFLOAT3));
+                if (enemy) mix(&registry->GetComponent<StatusComponent>(id).hp, sizeof(int));
+            }
+            return h;
+        }
+
+        int CountEnemies() {
+            int count = 0;
+            for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+                if (registry->HasComponent<EnemyComponent>(id)) ++count;
+            }
+            return count;
+        }
+
+        const PhysicsCounters& GetCounters() const { return physics->GetCounters(); }
+
+    private:
+        void AddBox(XMFLOAT3 position, XMFLOAT3 scale) {
+            EntityID id = world.CreateEntity().Build();
+            world.AddComponent<TransformComponent>(id, TransformComponent{ .position = position, .scale = scale });
+            world.AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Static });
+        }
+
+        // 他の System の代わり: 片付け・弾の補充・攻撃球の出し入れ
+        void Prepare() {
+            int bullets = 0;
+            for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+                if (registry->HasComponent<ParticleComponent>(id) ||
+                    registry->HasComponent<AttackSphereComponent>(id)) {
+                    world.DestroyEntity(id);
+                    continue;
+                }
+                if (registry->HasComponent<EnemyComponent>(id)) {
+                    // ノックバックの時間は敵の System が減らす。ここでは毎ステップ戻して、立ったらイベントにする
+                    registry->GetComponent<EnemyComponent>(id).knockbackTimer = 0.0f;
+                    continue;
+                }
+                if (!registry->HasComponent<BulletComponent>(id)) continue;
+                const auto& pos = registry->GetComponent<TransformComponent>(id).position;
+                if (std::fabs(pos.x) > BULLET_RANGE || std::fabs(pos.z) > BULLET_RANGE) {
+                    world.DestroyEntity(id);
+                    continue;
+                }
+                ++bullets;
+            }
+
+            for (; bullets < BULLET_COUNT; ++bullets) {
+                EntityID id = world.CreateEntity().Build();
+                const float angle = rng.Float(0.0f, XM_2PI);
+                world.AddComponent<TransformComponent>(id, TransformComponent{
+                    .position = { rng.Float(-ARENA, ARENA), 1.0f, rng.Float(-ARENA, ARENA) }, .scale = { 0.3f, 0.3f, 0.3f } });
+                world.AddComponent<ColliderComponent>(id, ColliderComponent{
+                    .type = ColliderType::Type_Sphere, .radius = 0.3f, .layer = CollisionLayer::PlayerBullet });
+                world.AddComponent<BulletComponent>(id, BulletComponent{ .damage = 25, .lifeTime = 3.0f, .isActive = true, .fromPlayer = true });
+                world.AddComponent<PhysicsComponent>(id, PhysicsComponent{
+                    .velocity = { std::cos(angle) * 40.0f, 0.0f, std::sin(angle) * 40.0f }, .useGravity = false });
+            }
+
+            for (int i = 0; i < SPHERES_PER_STEP; ++i) {
+                EntityID id = world.CreateEntity().Build();
+                world.AddComponent<TransformComponent>(id, TransformComponent{ .position = { rng.Float(-ARENA, ARENA), 0.5f, rng.Float(-ARENA, ARENA) } });
+                world.AddComponent<AttackSphereComponent>(id, AttackSphereComponent{ .ownerID = (int)playerID, .damage = 30, .currentRadius = 4.0f });
+                // ゲームと同じく当たり判定も付ける (物理はコライダーを持つものだけを回す)
+                world.AddComponent<ColliderComponent>(id, ColliderComponent{
+                    .type = ColliderType::Type_Sphere, .radius = 0.5f, .layer = CollisionLayer::AttackSphere });
+            }
+        }
+
+        // ステップ前の状態 (差分をイベントにする)
+        void Snapshot() {
+            isEnemy.assign(ECSConfig::MAX_ENTITIES, 0);
+            isBullet.assign(ECSConfig::MAX_ENTITIES, 0);
+            hp.assign(ECSConfig::MAX_ENTITIES, 0);
+            for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+                if (registry->HasComponent<EnemyComponent>(id)) {
+                    isEnemy[id] = 1;
+                    hp[id] = registry->GetComponent<StatusComponent>(id).hp;
+                }
+                else if (registry->HasComponent<BulletComponent>(id)) {
+                    isBullet[id] = 1;
+                }
+            }
+        }
+
+        void Collect(std::vector<PhysicsEvent>& events) {
+            // 消えた ID にはステップ中にパーティクルが入ることがあるので、種類が変わったかで見る
+            for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+                if (isEnemy[id]) {
+                    if (!registry->HasComponent<EnemyComponent>(id)) {
+                        events.push_back({ step, EventKind::Destroyed, id, ECSConfig::INVALID_ID, 1, {} });
+                        continue;
+                    }
+                    const int after = registry->GetComponent<StatusComponent>(id).hp;
+                    if (after != hp[id]) {
+                        events.push_back({ step, EventKind::Damage, id, ECSConfig::INVALID_ID, after, {} });
+                    }
+                    if (registry->GetComponent<EnemyComponent>(id).knockbackTimer > 0.0f) {
+                        events.push_back({ step, EventKind::Knockback, id, ECSConfig::INVALID_ID, 0,
+                            registry->GetComponent<PhysicsComponent>(id).velocity });
+                    }
+                }
+                else if (isBullet[id] && !registry->HasComponent<BulletComponent>(id)) {
+                    events.push_back({ step, EventKind::Destroyed, id, ECSConfig::INVALID_ID, 0, {} });
+                }
+                if (registry->HasComponent<ParticleComponent>(id)) {
+                    events.push_back({ step, EventKind::Effect, id, ECSConfig::INVALID_ID, 0,
+                        registry->GetComponent<TransformComponent>(id).position });
+                }
+            }
+            for (const TriggerEvent& ev : physics->GetTriggerEvents()) {
+                events.push_back({ step, EventKind::Trigger, ev.triggerID, ev.otherID, (int)ev.phase, {} });
+            }
+        }
+
+        World world;
+        Registry* registry = nullptr;
+        PhysicsSystem* physics = nullptr;
+        Random rng;
+        EntityID playerID = ECSConfig::INVALID_ID;
+        int step = 0;
+
+        std::vector<uint8_t> isEnemy;
+        std::vector<uint8_t> isBullet;
+        std::vector<int> hp;
+    };
+
+    struct RunResult {
+        std::vector<PhysicsEvent> events;
+        uint64_t hash = 0;
+        int enemiesLeft = 0;
+    };
+
+    RunResult Run(JobSystem* jobs) {
+        PhysicsScene scene(jobs);
+        RunResult result;
+        for (int i = 0; i < STEPS; ++i) scene.Step(&result.events);
+        result.hash = scene.StateHash();
+        result.enemiesLeft = scene.CountEnemies();
+        return result;
+    }
+
+    // 最初に食い違ったイベントを出す (どのステップのどの種類から崩れたかが分かるように)
+    void CompareEvents(const RunResult& serial, const RunResult& parallel, unsigned threads) {
+        const size_t count = std::min(serial.events.size(), parallel.events.size());
+        size_t i = 0;
+        while (i < count && SameEvent(serial.events[i], parallel.events[i])) ++i;
+        const bool same = (i == count) && serial.events.size() == parallel.events.size();
+        if (!same) {
+            if (i < count) {
+                const PhysicsEvent& a = serial.events[i];
+                const PhysicsEvent& b = parallel.events[i];
+                std::printf("  threads=%u: event %zu differs: step %d %s id=%u / step %d %s id=%u\n",
+                    threads, i, a.step, EVENT_NAMES[(int)a.kind], (unsigned)a.id,
+                    b.step, EVENT_NAMES[(int)b.kind], (unsigned)b.id);
+            }
+            else {
+                std::printf("  threads=%u: %zu events, serial has %zu\n", threads, parallel.events.size(), serial.events.size());
+            }
+        }
+        TEST_CHECK(same);
+        TEST_CHECK(serial.hash == parallel.hash);
+    }
+
+    void TestSerialMatchesWorkers() {
+        const RunResult serial = Run(nullptr);
+
+        // 全部の種類のイベントが出ていないと、比べても意味がない
+        constexpr int KIND_COUNT = (int)EventKind::Count;
+        int kinds[KIND_COUNT] = {};
+        for (const PhysicsEvent& ev : serial.events) ++kinds[(int)ev.kind];
+        std::printf("  %d steps: %zu events (", STEPS, serial.events.size());
+        for (int k = 0; k < KIND_COUNT; ++k) std::printf("%s%s %d", k ? ", " : "", EVENT_NAMES[k], kinds[k]);
+        std::printf("), enemies left %d/%d\n", serial.enemiesLeft, ENEMY_COUNT);
+        for (int k = 0; k < KIND_COUNT; ++k) TEST_CHECK(kinds[k] > 0);
+
+        // 同じスレッド数でも回すたびに仕事の取り合い方は変わるので、2回ずつ回す
+        // (JobSystem の引数は呼び出し元以外の本数。0 はコア数に合わせる)
+        for (unsigned workers : { 1u, 3u, 7u, 0u }) {
+            for (int repeat = 0; repeat < 2; ++repeat) {
+                JobSystem jobs(workers);
+                const RunResult parallel = Run(&jobs);
+                CompareEvents(serial, parallel, jobs.GetThreadCount());
+            }
+        }
+    }
+
+    // ---------------------------------------------------------
+    // ベンチマーク: 弾1000発・敵300体の1ステップ
+    // (コア数より多いスレッド数は速くならない。ns/step はリリースビルドで見ること)
+    // ---------------------------------------------------------
+    void BenchThreadScaling() {
+        constexpr int WARMUP = 30;
+        constexpr int MEASURE = 120;
+        const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        std::printf("  hardware threads: %u\n", cores);
+
+        double serialNs = 0.0;
+        for (unsigned threads : { 0u, 2u, 4u, 8u }) {
+            std::unique_ptr<JobSystem> jobs;
+            if (threads > 0) jobs = std::make_unique<JobSystem>(threads - 1);
+            PhysicsScene scene(jobs.get());
+            for (int i = 0; i < WARMUP; ++i) scene.Step(nullptr);
+
+            double total = 0.0, enemyContacts = 0.0, bullet = 0.0;
+            for (int i = 0; i < MEASURE; ++i) {
+                total += scene.Step(nullptr);
+                const PhysicsCounters& c = scene.GetCounters();
+                enemyContacts += c.phaseMs[(size_t)PhysicsPhase::EnemyContacts] * 1.0e6;
+                bullet += c.phaseMs[(size_t)PhysicsPhase::Bullet] * 1.0e6;
+            }
+            if (threads == 0) serialNs = total;
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "step (%s%u)", threads ? "threads=" : "serial", threads ? threads : 1u);
+            Test::PrintBench(name, total, MEASURE, "step");
+            std::snprintf(name, sizeof(name), "  EnemyContacts");
+            Test::PrintBench(name, enemyContacts, MEASURE, "step");
+            std::snprintf(name, sizeof(name), "  Bullet");
+            Test::PrintBench(name, bullet, MEASURE, "step");
+            if (threads > 0) std::printf("  %-44s %9.2fx\n", "  speedup vs serial", serialNs / total);
+        }
+    }
+}
+
+void RunPhysicsParallelTests() {
+    TestSerialMatchesWorkers();
+    BenchThreadScaling();
+}
@@ -0,0 +1,283 @@
+/*===================================================================
+// ファイル: SweptCollisionTest.cpp
+// 概要: 連続衝突判定 (弾の掃引・キャラクターコントローラー) のテスト
+//       1. 1ステップで薄い壁の厚みより長く進む弾が、壁の表面で消えるか
+//          (当たった時刻の位置 = 壁の面 - 弾の半径 にエフェクトが出て、壁の奥の敵には当たらない)
+//       2. 高速で吹き飛ばされた敵が、薄い壁の表面 (面 - 半径 - スキン) で止まるか
+//       3. 弾の判定の、掃引 (グリッド + 掃引球) と置き換える前の離散判定 (終点での球 vs OBB) の速さ
+//          と、離散判定ですり抜けた・壁越しに当たった数
+=====================================================================*/
+#include "TestCommon.h"
+#include "App/Main.h"
+#include "ECS/World.h"
+#include "ECS/Systems/PhysicsSystem.h"
+#include "ECS/Components/TransformComponent.h"
+#include "ECS/Components/ColliderComponent.h"
+#include "ECS/Components/EnemyComponent.h"
+#include "ECS/Components/StatusComponent.h"
+#include "ECS/Components/PhysicsComponent.h"
+#include "ECS/Components/BulletComponent.h"
+#include "ECS/Components/ParticleComponent.h"
+#include "Engine/Collision.h"
+#include "Engine/Random.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <algorithm>
+
+using namespace DirectX;
+
+namespace {
+
+    constexpr float DT = 1.0f / 60.0f;
+    constexpr float WALL_X = 5.0f;          // 薄い壁の中心
+    constexpr float WALL_THICKNESS = 0.1f;
+    constexpr float WALL_FACE = WALL_X - WALL_THICKNESS * 0.5f; // 手前の面
+    constexpr float BULLET_RADIUS = 0.3f;   // PhysicsSystem と同じ
+    constexpr float CCD_SKIN = 0.02f;       // PhysicsSystem と同じ (壁の手前に残す隙間)
+    const XMFLOAT3 NO_ROTATION = { 0.0f, 0.0f, 0.0f };
+
+    // 床と薄い壁だけの場面
+    class WallScene {
+    public:
+        WallScene() {
+            world.SetRandomSeed(31);
+            registry = world.GetRegistry();
+            physics = world.AddFixedSystem<PhysicsSystem>();
+            physics->Init(&world);
+            physics->SetJobSystem(nullptr);
+
+            AddBox({ 0.0f, -0.5f, 0.0f }, { 40.0f, 1.0f, 40.0f });
+            AddBox({ WALL_X, 1.5f, 0.0f }, { WALL_THICKNESS, 3.0f, 10.0f });
+        }
+
+        EntityID AddEnemy(XMFLOAT3 position) {
+            EntityID id = world.CreateEntity().Build();
+            world.AddComponent<TransformComponent>(id, TransformComponent{ .position = position });
+            world.AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Enemy });
+            world.AddComponent<EnemyComponent>(id);
+            world.AddComponent<StatusComponent>(id, StatusComponent{ .hp = 100, .maxHp = 100 });
+            world.AddComponent<PhysicsComponent>(id);
+            return id;
+        }
+
+        EntityID AddBullet(XMFLOAT3 position, XMFLOAT3 velocity) {
+            EntityID id = world.CreateEntity().Build();
+            world.AddComponent<TransformComponent>(id, TransformComponent{ .position = position, .scale = { 0.3f, 0.3f, 0.3f } });
+            world.AddComponent<ColliderComponent>(id, ColliderComponent{
+                .type = ColliderType::Type_Sphere, .radius = BULLET_RADIUS, .layer = CollisionLayer::PlayerBullet });
+            world.AddComponent<BulletComponent>(id, BulletComponent{ .damage = 25, .lifeTime = 3.0f, .isActive = true, .fromPlayer = true });
+            world.AddComponent<PhysicsComponent>(id, PhysicsComponent{ .velocity = velocity, .useGravity = false });
+            return id;
+        }
+
+        void Step() { physics->Update(DT); }
+
+        // ステップ中に出たパーティクルの位置
+        std::vector<XMFLOAT3> Particles() {
+            std::vector<XMFLOAT3> out;
+            for (EntityID id = 0; id < ECSConfig::MAX_ENTITIES; ++id) {
+                if (registry->HasComponent<ParticleComponent>(id)) {
+                    out.push_back(registry->GetComponent<TransformComponent>(id).position);
+                }
+            }
+            return out;
+        }
+
+        World world;
+        Registry* registry = nullptr;
+        PhysicsSystem* physics = nullptr;
+
+    private:
+        void AddBox(XMFLOAT3 position, XMFLOAT3 scale) {
+            EntityID id = world.CreateEntity().Build();
+            world.AddComponent<TransformComponent>(id, TransformComponent{ .position = position, .scale = scale });
+            world.AddComponent<ColliderComponent>(id, ColliderComponent{ .layer = CollisionLayer::Static });
+        }
+    };
+
+    // 壁と同じ大きさの OBB (離散判定ならどうなっていたかを見る)
+    Collision::OBBSoA WallBox() {
+        Collision::OBBSoA box;
+        box.Add(0, { WALL_X, 1.5f, 0.0f }, { WALL_THICKNESS * 0.5f, 1.5f, 5.0f }, NO_ROTATION);
+        return box;
+    }
+
+    // -----------------------------------------------------------------
+    // 速い弾: 1ステップ 5m で厚さ 0.1m の壁を越える位置まで進む
+    // -----------------------------------------------------------------
+    void TestFastBullet() {
+        WallScene scene;
+        const XMFLOAT3 start = { 2.0f, 1.0f, 0.0f };
+        const XMFLOAT3 velocity = { 300.0f, 0.0f, 0.0f };
+        const XMFLOAT3 end = { start.x + velocity.x * DT, start.y, start.z };
+        const EntityID enemy = scene.AddEnemy({ end.x, 0.5f, 0.0f }); // 弾の終点にいる、壁の奥の敵
+        const EntityID bullet = scene.AddBullet(start, velocity);
+
+        // 終点だけを見る判定では、壁の奥の敵に当たり、壁には当たらない
+        Collision::OBBSoA enemyBox;
+        enemyBox.Add(0, { end.x, 0.5f, 0.0f }, { 0.5f, 0.5f, 0.5f }, NO_ROTATION);
+        float pen = 0.0f;
+        TEST_CHECK(Collision::SphereOverlapOBB(enemyBox, 0, end, BULLET_RADIUS, pen));
+        TEST_CHECK(!Collision::SphereOverlapOBB(WallBox(), 0, end, BULLET_RADIUS, pen));
+
+        scene.Step();
+
+        // 壁の面で消えて、当たった位置にエフェクトが出る
+        TEST_CHECK(!scene.registry->HasComponent<BulletComponent>(bullet));
+        const std::vector<XMFLOAT3> particles = scene.Particles();
+        TEST_CHECK(!particles.empty());
+        const float contactX = WALL_FACE - BULLET_RADIUS;
+        const float toi = (contactX - start.x) / (end.x - start.x);
+        for (const XMFLOAT3& p : particles) {
+            TEST_CHECK_NEAR(p.x, contactX, 1e-4f);
+            TEST_CHECK_NEAR(p.x, start.x + (end.x - start.x) * toi, 1e-4f);
+            TEST_CHECK_NEAR(p.y, start.y, 1e-4f);
+            TEST_CHECK_NEAR(p.z, start.z, 1e-4f);
+        }
+        // 壁の奥の敵には当たらない
+        TEST_CHECK(scene.registry->GetComponent<StatusComponent>(enemy).hp == 100);
+        std::printf("  bullet     5.0m/step, stopped at x=%.4f (face %.2f, toi %.3f)\n",
+            particles.empty() ? 0.0f : particles[0].x, WALL_FACE, toi);
+    }
+
+    // -----------------------------------------------------------------
+    // 吹き飛ばされた敵: 1ステップ 2.5m (厚さ 0.1m の壁の奥まで) の速度
+    // -----------------------------------------------------------------
+    void TestKnockbackIntoWall() {
+        WallScene scene;
+        const float radius = 0.5f; // 敵のコライダー (半径 0.5・高さ 1 なので球)
+        const float startX = WALL_FACE - 1.5f;
+        const EntityID enemy = scene.AddEnemy({ startX, 0.5f, 0.0f });
+
+        // 最初のステップで着地させる (コントローラーは前のステップの位置から掃引する)
+        scene.Step();
+        auto& trans = scene.registry->GetComponent<TransformComponent>(enemy);
+        auto& phys = scene.registry->GetComponent<PhysicsComponent>(enemy);
+        TEST_CHECK_NEAR(trans.position.x, startX, 1e-5f);
+
+        phys.velocity = { 150.0f, 0.0f, 0.0f };
+        const float endX = startX + 150.0f * DT;
+        TEST_CHECK(endX > WALL_X + radius); // 終点は壁の奥で、壁と重ならない
+        float pen = 0.0f;
+        TEST_CHECK(!Collision::SphereOverlapOBB(WallBox(), 0, { endX, 0.5f, 0.0f }, radius, pen));
+
+        scene.Step();
+        const float clampX = WALL_FACE - radius - CCD_SKIN;
+        TEST_CHECK_NEAR(trans.position.x, clampX, 1e-4f);
+        TEST_CHECK(phys.velocity.x == 0.0f); // 壁に向かう速度は消える
+        std::printf("  knockback  2.5m/step, stopped at x=%.4f (face %.2f - r %.2f - skin %.2f)\n",
+            trans.position.x, WALL_FACE, radius, CCD_SKIN);
+
+        // 止まった後も壁の手前に残る
+        for (int i = 0; i < 10; ++i) scene.Step();
+        TEST_CHECK(trans.position.x <= WALL_FACE - radius + 1e-4f);
+        TEST_CHECK(trans.position.x >= clampX - 1e-4f);
+
+        // 斜めに飛ばされた時は、壁に沿って滑る
+        phys.velocity = { 150.0f, 0.0f, 60.0f };
+        const float beforeZ = trans.position.z;
+        scene.Step();
+        TEST_CHECK(trans.position.x <= WALL_FACE - radius + 1e-4f);
+        TEST_CHECK(trans.position.z > beforeZ + 0.5f);
+        TEST_CHECK(phys.velocity.x == 0.0f);
+        TEST_CHECK(phys.velocity.z > 0.0f);
+    }
+
+    // -----------------------------------------------------------------
+    // 手間: 弾の判定を、掃引 (今) と終点だけの球 vs OBB (置き換える前) で
+    // 壁 (厚さ 0.2m) 48枚・敵 300体・弾 1024発 (ゲームの弾と速い弾の1ステップ分)
+    // -----------------------------------------------------------------
+    void Bench() {
+        constexpr int WALLS = 48;
+        constexpr int ENEMIES = 300;
+        constexpr int BULLETS = 1024;
+        constexpr int REPEAT = 20;
+        constexpr float ARENA = 50.0f;
+        Random rng(31, 0);
+
+        Collision::OBBSoA walls, targets;
+        for (int i = 0; i < WALLS; ++i) {
+            const XMFLOAT3 center = { rng.Float(-ARENA, ARENA), 1.5f, rng.Float(-ARENA, ARENA) };
+            const XMFLOAT3 rotation = { 0.0f, rng.Float(0.0f, XM_PI), 0.0f };
+            walls.Add((uint32_t)i, center, { 3.0f, 1.5f, 0.1f }, rotation);
+        }
+        for (int i = 0; i < ENEMIES; ++i) {
+            targets.Add((uint32_t)i, { rng.Float(-ARENA, ARENA), 0.5f, rng.Float(-ARENA, ARENA) }, { 0.5f, 0.5f, 0.5f }, NO_ROTATION);
+        }
+        Collision::UniformGrid grid;
+        grid.Build(walls, 4.0f);
+
+        std::vector<uint8_t> mask(targets.Size() + 8);
+        std::vector<float> value(targets.Size() + 8);
+        std::vector<uint32_t> candidates;
+        float acc = 0.0f;
+
+        for (float speed : { 40.0f, 200.0f }) {
+            std::vector<XMFLOAT3> from(BULLETS), to(BULLETS);
+            for (int b = 0; b < BULLETS; ++b) {
+                const float angle = rng.Float(0.0f, XM_2PI);
+                from[b] = { rng.Float(-ARENA, ARENA), 1.0f, rng.Float(-ARENA, ARENA) };
+                to[b] = { from[b].x + std::cos(angle) * speed * DT, 1.0f, from[b].z + std::sin(angle) * speed * DT };
+            }
+
+            // 置き換える前: 終点の球と敵の OBB (壁は見ない)
+            int discreteHits = 0;
+            std::vector<uint8_t> discreteHit(BULLETS, 0);
+            Test::Timer timer;
+            for (int r = 0; r < REPEAT; ++r) {
+                for (int b = 0; b < BULLETS; ++b) {
+                    const size_t n = Collision::SphereOverlapBatch(targets, to[b], BULLET_RADIUS, mask.data(), value.data());
+                    discreteHit[b] = n > 0;
+                    acc += (float)n;
+                }
+            }
+            const double discreteNs = timer.ElapsedNs();
+
+            // 今: 壁をグリッドで引いて掃引し、壁より手前の敵を掃引球でまとめて
+            int sweptHits = 0, tunneled = 0, throughWall = 0;
+            timer.Reset();
+            for (int r = 0; r < REPEAT; ++r) {
+                for (int b = 0; b < BULLETS; ++b) {
+                    XMVECTOR move = XMLoadFloat3(&to[b]) - XMLoadFloat3(&from[b]);
+                    const float len = XMVectorGetX(XMVector3Length(move));
+                    Collision::RayQuery ray;
+                    ray.origin = from[b];
+                    XMStoreFloat3(&ray.direction, move / len);
+                    ray.radius = BULLET_RADIUS;
+                    ray.maxDist = len;
+
+                    grid.QuerySegment(from[b], to[b], BULLET_RADIUS, candidates);
+                    for (uint32_t index : candidates) {
+                        float d;
+                        if (Collision::RaycastOBB(walls, index, ray, d) && d < ray.maxDist) ray.maxDist = std::max(d, 0.0f);
+                    }
+                    const bool hit = Collision::SweepSphereBatch(targets, ray, mask.data(), value.data()) > 0;
+                    acc += ray.maxDist;
+                    if (r != 0) continue;
+                    if (hit) ++sweptHits;
+                    if (discreteHit[b]) ++discreteHits;
+                    if (hit && !discreteHit[b]) ++tunneled;
+                    if (!hit && discreteHit[b]) ++throughWall;
+                }
+            }
+            const double sweptNs = timer.ElapsedNs();
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "%.0fm/s discrete end sphere (old)", speed);
+            Test::PrintBench(name, discreteNs, (double)BULLETS * REPEAT, "bullet");
+            std::snprintf(name, sizeof(name), "%.0fm/s swept grid + SweepSphereBatch", speed);
+            Test::PrintBench(name, sweptNs, (double)BULLETS * REPEAT, "bullet");
+            std::printf("  %.0fm/s hits: swept %d / discrete %d, missed by discrete %d, hit through a wall %d\n",
+                speed, sweptHits, discreteHits, tunneled, throughWall);
+            // 掃引は終点での重なりを含むので、壁がなければ離散判定の当たりは全部拾う
+            TEST_CHECK(sweptHits + throughWall >= discreteHits);
+        }
+        Test::sink = Test::sink + acc;
+    }
+}
+
+void RunSweptCollisionTests() {
+    TestFastBullet();
+    TestKnockbackIntoWall();
+    Bench();
+}
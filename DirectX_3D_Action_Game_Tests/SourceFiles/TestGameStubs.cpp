@@ -0,0 +1,31 @@
+/*===================================================================
+// ファイル: TestGameStubs.cpp
+// 概要: 物理 (PhysicsSystem / World) をウィンドウ・デバイスなしで動かすための代役
+//       Game は作らない (GetInstance は nullptr のまま)。物理と EntityFactory は
+//       Game がない時はワーカー・効果音・GPUバッファを使わずに進む
+//       ここにあるのはリンクを通すためだけのもので、描画・音・入力は何もしない
+=====================================================================*/
+#include "App/Main.h"
+#include "App/Game.h"
+#include "Engine/Graphics.h"
+#include "Engine/Input.h"
+#include "Engine/Audio.h"
+
+// ログは捨てる (テストの出力は printf で出す)
+namespace AppLog {
+    std::vector<std::string> logs;
+    void AddLog(const char*, ...) {}
+    void Clear() { logs.clear(); }
+}
+
+Game* Game::instance = nullptr;
+
+// Game がないので呼ばれない (EntityFactory は Graphics が取れない時は作らない)
+bool Graphics::CreateVertexBuffer(const std::vector<Vertex>&, ID3D11Buffer**) { return false; }
+bool Graphics::CreateIndexBuffer(const std::vector<UINT>&, ID3D11Buffer**) { return false; }
+
+// World::Update の固定ステップの区切り (Input がない時は呼ばれない)
+void Input::EndFixedStep() {}
+
+// 効果音 (Game がない時は鳴らさない)
+void Audio::Play(const std::string&, bool, float) {}
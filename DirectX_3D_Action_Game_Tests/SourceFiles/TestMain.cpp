@@ -0,0 +1,65 @@
+/*===================================================================
+// ファイル: TestMain.cpp
+// 概要: 当たり判定・物理のテストとベンチマークのエントリーポイント
+//       引数なしで全部、引数があれば名前に含む組だけ実行する
+//       例: DirectX_3D_Action_Game_Tests.exe batch
+//       x64 は /arch:AVX2 (8レーン)、Win32 は SSE2 (4レーン) でビルドするので、
+//       両方のプラットフォームで走らせると一括判定の両方の経路を通る
+//       (計時はリリースビルドで見ること。デバッグビルドでは判定だけ意味がある)
+=====================================================================*/
+#include "TestCommon.h"
+#include <cstring>
+
+namespace Test {
+    int failures = 0;
+    int passes = 0;
+    volatile float sink = 0.0f;
+
+    void ReportFailure(const char* file, int line, const char* message) {
+        ++failures;
+        // 同じ判定が何千回も落ちた時に画面を埋めないよう、最初の数件だけ出す
+        if (failures <= 20) std::printf("  FAILED %s(%d): %s\n", file, line, message);
+    }
+}
+
+// 各ファイルのテストの組
+void RunCapsuleOBBTests();
+void RunCollisionBatchTests();
+void RunConvexCollisionTests();
+void RunSweptCollisionTests();
+void RunPhysicsParallelTests();
+void RunBossEmitterTests();
+
+struct TestGroup {
+    const char* name;
+    void (*run)();
+};
+
+static const TestGroup GROUPS[] = {
+    { "capsule_obb", RunCapsuleOBBTests },
+    { "collision_batch", RunCollisionBatchTests },
+    { "convex", RunConvexCollisionTests },
+    { "ccd", RunSweptCollisionTests },
+    { "physics_parallel", RunPhysicsParallelTests },
+    { "boss_emitter", RunBossEmitterTests },
+};
+
+int main(int argc, char** argv) {
+    const char* filter = (argc > 1) ? argv[1] : nullptr;
+#if defined(__AVX2__)
+    std::printf("SIMD: AVX2 (8 lanes)\n");
+#else
+    std::printf("SIMD: SSE2 (4 lanes)\n");
+#endif
+
+    for (const TestGroup& group : GROUPS) {
+        if (filter && !std::strstr(group.name, filter)) continue;
+        std::printf("[%s]\n", group.name);
+        const int before = Test::failures;
+        group.run();
+        std::printf("  -> %s\n", (Test::failures == before) ? "ok" : "FAILED");
+    }
+
+    std::printf("\n%d checks passed, %d failed\n", Test::passes, Test::failures);
+    return (Test::failures == 0) ? 0 : 1;
+}